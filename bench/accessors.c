@@ -0,0 +1,281 @@
+/******************************************************************************
+ * File: accessors.c
+ * Created: 2026-10-17
+ * Last Updated: 2026-10-17
+ * Creator: Aaron Oman (a.k.a GrooveStomp)
+ * Notice: (C) Copyright 2016 by Aaron Oman
+ *-----------------------------------------------------------------------------
+ *
+ * Generated accessor microbenchmark.
+ * Compiled together with one generated source or --header header, named by
+ * BENCH_SOURCE, whose struct is "bench" in the default c style. Times _init,
+ * _has_key and _get in ns/op, then the same lookups against a gs_hash_map
+ * holding the same keys and values.
+ *
+ ******************************************************************************/
+#define _POSIX_C_SOURCE 200809L /* clock_gettime */
+#define GSCFG_IMPLEMENTATION
+
+#include BENCH_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h> /* EXIT_SUCCESS, malloc */
+#include <alloca.h>
+#include <libgen.h> /* POSIX basename */
+#include <time.h> /* clock_gettime */
+#include "../gs.h"
+
+#define MICRO_QUERIES 16384 /* Keys drawn per distribution, then cycled through. */
+#define MICRO_BLOCK 256 /* Operations between clock reads. */
+#define MICRO_MAP_LIMIT 10000 /* gs_hash_map scans every slot on a miss, including while being filled. */
+
+typedef enum micro_query_e
+{
+        MICRO_QUERY_HIT_UNIFORM,
+        MICRO_QUERY_MISS_UNIFORM,
+        MICRO_QUERY_HIT_SKEWED,
+        MICRO_QUERY_MISS_SKEWED,
+        MICRO_QUERY_MISS_INNER,
+        MICRO_QUERY_MISS_UNRELATED,
+        MICRO_QUERY_COUNT
+} micro_query_e;
+
+typedef struct micro
+{
+        bench *Config;
+        gs_hash_map *Map;
+        char **Hits; /* Copies of every key, so no lookup can match by pointer. */
+        char **Misses; /* Every key with its last character replaced. */
+        char **InnerMisses; /* Every key with a character a quarter of the way in replaced. */
+        char **UnrelatedMisses; /* Random lowercase strings as long as each key. */
+        char **Queries[MICRO_QUERY_COUNT];
+        double Seconds; /* Minimum time spent per measurement. */
+        unsigned int Seed;
+        volatile uintptr_t Sink;
+} micro;
+
+typedef uintptr_t (*micro_op)(micro *Self, char *Key);
+
+double
+MicroNow(void)
+{
+        struct timespec Time;
+        clock_gettime(CLOCK_MONOTONIC, &Time);
+        return(Time.tv_sec + Time.tv_nsec * 1e-9);
+}
+
+unsigned int
+MicroRandom(micro *Self)
+{
+        /* Numerical Recipes LCG, as in corpus.c. */
+        Self->Seed = Self->Seed * 1664525 + 1013904223;
+        return(Self->Seed >> 8);
+}
+
+double /* Uniform in [0, 1). */
+MicroUniform(micro *Self)
+{
+        return((MicroRandom(Self) & 0xffffff) / (double)0x1000000);
+}
+
+/*
+  Draws MICRO_QUERIES keys from Keys for each distribution. Skewed draws
+  follow Zipf's law with exponent 1, so the hottest key takes about 1 / ln(N)
+  of all lookups, and ranks are shuffled so the hot keys aren't simply the
+  first ones generated.
+*/
+void
+MicroQueriesInit(micro *Self, unsigned int KeyCount)
+{
+        unsigned int *Ranks = (unsigned int *)malloc(sizeof(unsigned int) * KeyCount);
+        double *Cumulative = (double *)malloc(sizeof(double) * KeyCount);
+        double Total = 0;
+        for(unsigned int I = 0; I < KeyCount; I++)
+        {
+                Ranks[I] = I;
+                Total += 1.0 / (I + 1);
+                Cumulative[I] = Total;
+        }
+        for(unsigned int I = KeyCount - 1; I > 0; I--)
+        {
+                unsigned int Other = MicroRandom(Self) % (I + 1);
+                unsigned int Swap = Ranks[I];
+                Ranks[I] = Ranks[Other];
+                Ranks[Other] = Swap;
+        }
+
+        for(int Query = 0; Query < MICRO_QUERY_COUNT; Query++)
+        {
+                Self->Queries[Query] = (char **)malloc(sizeof(char *) * MICRO_QUERIES);
+        }
+        for(unsigned int I = 0; I < MICRO_QUERIES; I++)
+        {
+                unsigned int Uniform = MicroRandom(Self) % KeyCount;
+                Self->Queries[MICRO_QUERY_HIT_UNIFORM][I] = Self->Hits[Uniform];
+                Self->Queries[MICRO_QUERY_MISS_UNIFORM][I] = Self->Misses[Uniform];
+                Self->Queries[MICRO_QUERY_MISS_INNER][I] = Self->InnerMisses[Uniform];
+                Self->Queries[MICRO_QUERY_MISS_UNRELATED][I] = Self->UnrelatedMisses[Uniform];
+
+                double Wanted = MicroUniform(Self) * Total;
+                unsigned int Low = 0, High = KeyCount - 1;
+                while(Low < High)
+                {
+                        unsigned int Middle = Low + (High - Low) / 2;
+                        if(Cumulative[Middle] < Wanted) Low = Middle + 1;
+                        else High = Middle;
+                }
+                Self->Queries[MICRO_QUERY_HIT_SKEWED][I] = Self->Hits[Ranks[Low]];
+                Self->Queries[MICRO_QUERY_MISS_SKEWED][I] = Self->Misses[Ranks[Low]];
+        }
+
+        free(Cumulative);
+        free(Ranks);
+}
+
+/*
+  The miss filter hashes a key's first, middle and last characters, so a
+  last-character miss is its best case. Inner misses change a character it
+  doesn't look at in keys of four or more characters, so they reach the key
+  comparisons; unrelated misses show what it makes of keys sharing nothing.
+*/
+void
+MicroKeysInit(micro *Self)
+{
+        Self->Hits = (char **)malloc(sizeof(char *) * bench_key_count);
+        Self->Misses = (char **)malloc(sizeof(char *) * bench_key_count);
+        Self->InnerMisses = (char **)malloc(sizeof(char *) * bench_key_count);
+        Self->UnrelatedMisses = (char **)malloc(sizeof(char *) * bench_key_count);
+        for(unsigned int I = 0; I < bench_key_count; I++)
+        {
+                const bench_descriptor *Descriptor = &benchdescriptors[I];
+                unsigned int Length = Descriptor->length;
+                Self->Hits[I] = (char *)malloc(Length + 1);
+                memcpy(Self->Hits[I], benchname(Descriptor), Length + 1);
+                Self->Misses[I] = (char *)malloc(Length + 1);
+                memcpy(Self->Misses[I], benchname(Descriptor), Length + 1);
+                Self->Misses[I][Length - 1] = '#';
+                Self->InnerMisses[I] = (char *)malloc(Length + 1);
+                memcpy(Self->InnerMisses[I], benchname(Descriptor), Length + 1);
+                Self->InnerMisses[I][Length / 4] = '#';
+                Self->UnrelatedMisses[I] = (char *)malloc(Length + 1);
+                for(unsigned int C = 0; C < Length; C++)
+                {
+                        Self->UnrelatedMisses[I][C] = 'a' + MicroRandom(Self) % 26;
+                }
+                Self->UnrelatedMisses[I][Length] = '\0';
+        }
+}
+
+gs_hash_map *
+MicroMapInit(micro *Self)
+{
+        unsigned int MaxKeyLength = 0;
+        for(unsigned int I = 0; I < bench_key_count; I++)
+        {
+                MaxKeyLength = GSMax(MaxKeyLength, benchdescriptors[I].length + 1);
+        }
+
+        /* Half full, so colliding keys usually find a free slot soon after their own. */
+        unsigned int Capacity = bench_key_count * 2;
+        gs_hash_map *Map = GSHashMapInit(malloc(GSHashMapAllocSize(MaxKeyLength, Capacity)), MaxKeyLength, Capacity);
+        for(unsigned int I = 0; I < bench_key_count; I++)
+        {
+                if(!GSHashMapSet(Map, Self->Hits[I], benchgetbyid(Self->Config, benchdescriptors[I].id)))
+                        GSAbortWithMessage("Couldn't add %s to the gs_hash_map\n", Self->Hits[I]);
+        }
+
+        return(Map);
+}
+
+uintptr_t MicroHasKey(micro *Self, char *Key) { return(benchhaskey(Self->Config, Key)); }
+uintptr_t MicroGet(micro *Self, char *Key) { return((uintptr_t)benchget(Self->Config, Key)); }
+uintptr_t MicroMapHasKey(micro *Self, char *Key) { return(GSHashMapHasKey(Self->Map, Key)); }
+uintptr_t MicroMapGet(micro *Self, char *Key) { return((uintptr_t)GSHashMapGet(Self->Map, Key)); }
+uintptr_t MicroInit(micro *Self, char *Key) { (void)Key; benchinit(Self->Config); return(0); }
+
+void /* Runs Op over Queries, cycling, for at least Self->Seconds and prints its mean cost. */
+MicroMeasure(micro *Self, char *Name, micro_op Op, char **Queries)
+{
+        unsigned long Ops = 0;
+        double Begin = MicroNow(), Elapsed;
+        do
+        {
+                for(unsigned int I = 0; I < MICRO_BLOCK; I++)
+                {
+                        Self->Sink += Op(Self, Queries[(Ops + I) % MICRO_QUERIES]);
+                }
+                Ops += MICRO_BLOCK;
+                Elapsed = MicroNow() - Begin;
+        }
+        while(Elapsed < Self->Seconds);
+
+        printf("  %-36s %12.1f ns/op\n", Name, Elapsed / Ops * 1e9);
+}
+
+void
+Usage(char *ProgramName)
+{
+        printf("Usage: %s [options]\n", basename(ProgramName));
+        puts("");
+        puts("Times the accessors of the generated source this was compiled with.");
+        puts("");
+        puts("Options:");
+        puts("\t--map: Also time a gs_hash_map holding the same keys and values.");
+        puts("\t--milliseconds: Minimum time per measurement. Defaults to 100.");
+        puts("\t--seed: Seed for the key distributions. Defaults to 1.");
+        exit(EXIT_SUCCESS);
+}
+
+int
+main(int ArgCount, char **Arguments)
+{
+        gs_args *Args;
+        Args = GSArgsInit(alloca(GSArgsAllocSize()), ArgCount, Arguments);
+        if(GSArgsHelpWanted(Args)) Usage(GSArgsProgramName(Args));
+
+        micro Micro;
+        Micro.Seconds = 0.1;
+        if(GSArgsIsPresent(Args, "--milliseconds")) Micro.Seconds = strtoul(GSArgsAfter(Args, "--milliseconds"), NULL, 10) / 1000.0;
+        Micro.Seed = 1;
+        if(GSArgsIsPresent(Args, "--seed")) Micro.Seed = strtoul(GSArgsAfter(Args, "--seed"), NULL, 10);
+        Micro.Sink = 0;
+
+        Micro.Config = (bench *)malloc(sizeof(bench));
+        benchinit(Micro.Config);
+        MicroKeysInit(&Micro);
+        MicroQueriesInit(&Micro, bench_key_count);
+
+        char **Hits = Micro.Queries[MICRO_QUERY_HIT_UNIFORM];
+        char **Misses = Micro.Queries[MICRO_QUERY_MISS_UNIFORM];
+        char **SkewedHits = Micro.Queries[MICRO_QUERY_HIT_SKEWED];
+        char **SkewedMisses = Micro.Queries[MICRO_QUERY_MISS_SKEWED];
+        char **InnerMisses = Micro.Queries[MICRO_QUERY_MISS_INNER];
+        char **UnrelatedMisses = Micro.Queries[MICRO_QUERY_MISS_UNRELATED];
+
+        MicroMeasure(&Micro, "_init", MicroInit, Hits);
+        MicroMeasure(&Micro, "_has_key hit", MicroHasKey, Hits);
+        MicroMeasure(&Micro, "_has_key miss", MicroHasKey, Misses);
+        MicroMeasure(&Micro, "_has_key inner miss", MicroHasKey, InnerMisses);
+        MicroMeasure(&Micro, "_has_key unrelated miss", MicroHasKey, UnrelatedMisses);
+        MicroMeasure(&Micro, "_get uniform", MicroGet, Hits);
+        MicroMeasure(&Micro, "_get skewed", MicroGet, SkewedHits);
+        MicroMeasure(&Micro, "_get skewed miss", MicroGet, SkewedMisses);
+
+        if(GSArgsIsPresent(Args, "--map") && bench_key_count > MICRO_MAP_LIMIT)
+        {
+                printf("  gs_hash_map skipped over %u keys\n", MICRO_MAP_LIMIT);
+        }
+        else if(GSArgsIsPresent(Args, "--map"))
+        {
+                Micro.Map = MicroMapInit(&Micro);
+                MicroMeasure(&Micro, "gs_hash_map has_key hit", MicroMapHasKey, Hits);
+                MicroMeasure(&Micro, "gs_hash_map has_key miss", MicroMapHasKey, Misses);
+                MicroMeasure(&Micro, "gs_hash_map has_key inner miss", MicroMapHasKey, InnerMisses);
+                MicroMeasure(&Micro, "gs_hash_map has_key unrelated miss", MicroMapHasKey, UnrelatedMisses);
+                MicroMeasure(&Micro, "gs_hash_map get uniform", MicroMapGet, Hits);
+                MicroMeasure(&Micro, "gs_hash_map get skewed", MicroMapGet, SkewedHits);
+                MicroMeasure(&Micro, "gs_hash_map get skewed miss", MicroMapGet, SkewedMisses);
+        }
+
+        return(EXIT_SUCCESS);
+}
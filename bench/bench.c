@@ -0,0 +1,231 @@
+/******************************************************************************
+ * File: bench.c
+ * Created: 2026-10-17
+ * Last Updated: 2026-10-17
+ * Creator: Aaron Oman (a.k.a GrooveStomp)
+ * Notice: (C) Copyright 2016 by Aaron Oman
+ *-----------------------------------------------------------------------------
+ *
+ * Generator benchmark harness.
+ * Runs gscfg's generator in-process over each config file given and times
+ * it end-to-end and per phase: read, tokenize, emit and write.
+ * Results can be saved as a baseline and compared against on later runs.
+ *
+ ******************************************************************************/
+#define main GSCfgMain
+#include "../main.c"
+#undef main
+
+#include <time.h> /* clock_gettime */
+
+typedef enum bench_phase_e
+{
+        BENCH_PHASE_READ,
+        BENCH_PHASE_TOKENIZE,
+        BENCH_PHASE_EMIT,
+        BENCH_PHASE_WRITE,
+        BENCH_PHASE_TOTAL,
+        BENCH_PHASE_COUNT
+} bench_phase_e;
+
+char *BenchPhaseNames[BENCH_PHASE_COUNT] = { "read", "tokenize", "emit", "write", "total" };
+
+typedef struct bench_result
+{
+        char *FileName;
+        size_t Bytes;
+        unsigned int Keys;
+        double Seconds[BENCH_PHASE_COUNT]; /* Best of all runs. */
+} bench_result;
+
+double
+BenchNow(void)
+{
+        struct timespec Time;
+        clock_gettime(CLOCK_MONOTONIC, &Time);
+        return(Time.tv_sec + Time.tv_nsec * 1e-9);
+}
+
+void
+BenchFile(config *Config, char *FileName, unsigned int Runs, gs_arena *Arena, bench_result *Result)
+{
+        Result->FileName = FileName;
+        for(int I = 0; I < BENCH_PHASE_COUNT; I++) Result->Seconds[I] = -1;
+
+        for(unsigned int Run = 0; Run < Runs; Run++)
+        {
+                double Times[BENCH_PHASE_COUNT + 1];
+                GSArenaReset(Arena);
+
+                Times[BENCH_PHASE_READ] = BenchNow();
+                input_file Input;
+                if(!InputFileOpen(&Input, FileName, Arena))
+                        GSAbortWithMessage("Couldn't read %s\n", FileName);
+                /* Fault the mapping in here so its cost isn't charged to the tokenizer. */
+                volatile char Sink = 0;
+                for(size_t Offset = 0; Offset < Input.Buffer.Length; Offset += 4096)
+                        Sink += Input.Buffer.Start[Offset];
+
+                Times[BENCH_PHASE_TOKENIZE] = BenchNow();
+                config_lines Lines;
+                ConfigLinesInit(&Lines, Arena, 256);
+                Tokenize(&Input.Buffer, &Lines);
+
+                Times[BENCH_PHASE_EMIT] = BenchNow();
+                section Source;
+                generator_stats Stats;
+                memset(&Stats, 0, sizeof(Stats));
+                GenerateSource(Config, &Lines, Input.Buffer.Length, Arena, &Source, &Stats);
+
+                Times[BENCH_PHASE_WRITE] = BenchNow();
+                WriteSourceFile(&Source, "bench_output.c");
+
+                Times[BENCH_PHASE_TOTAL] = BenchNow();
+                Result->Bytes = Input.Buffer.Length;
+                Result->Keys = Stats.Keys;
+                InputFileClose(&Input);
+
+                for(int Phase = 0; Phase < BENCH_PHASE_TOTAL; Phase++)
+                {
+                        double Seconds = Times[Phase + 1] - Times[Phase];
+                        if(Result->Seconds[Phase] < 0 || Seconds < Result->Seconds[Phase])
+                                Result->Seconds[Phase] = Seconds;
+                }
+                double Total = Times[BENCH_PHASE_TOTAL] - Times[BENCH_PHASE_READ];
+                if(Result->Seconds[BENCH_PHASE_TOTAL] < 0 || Total < Result->Seconds[BENCH_PHASE_TOTAL])
+                        Result->Seconds[BENCH_PHASE_TOTAL] = Total;
+        }
+        remove("bench_output.c");
+}
+
+double /* Returns a negative number if there's no matching baseline entry. */
+BenchBaselineSeconds(char *BaselineFile, char *FileName, char *Phase)
+{
+        if(BaselineFile == NULL) return(-1);
+        FILE *File = fopen(BaselineFile, "r");
+        if(File == NULL) return(-1);
+
+        char Name[4096], PhaseName[64];
+        double Seconds, Result = -1;
+        while(fscanf(File, "%4095s %63s %lf %*u %*u", Name, PhaseName, &Seconds) == 3)
+        {
+                if(strcmp(Name, FileName) == 0 && strcmp(PhaseName, Phase) == 0) Result = Seconds;
+        }
+        fclose(File);
+
+        return(Result);
+}
+
+void
+BenchReport(bench_result *Result, char *BaselineFile)
+{
+        double Megabytes = GSBytesToMegabytes((double)Result->Bytes);
+        printf("%s: %.2f MB, %u keys\n", Result->FileName, Megabytes, Result->Keys);
+
+        for(int Phase = 0; Phase < BENCH_PHASE_COUNT; Phase++)
+        {
+                double Seconds = Result->Seconds[Phase];
+                printf("  %-9s %10.6f s %10.1f MB/s %12.0f keys/s",
+                       BenchPhaseNames[Phase], Seconds,
+                       Megabytes / Seconds, Result->Keys / Seconds);
+
+                double Baseline = BenchBaselineSeconds(BaselineFile, Result->FileName, BenchPhaseNames[Phase]);
+                if(Baseline > 0)
+                {
+                        printf(" %+7.1f%% vs baseline", (Seconds - Baseline) / Baseline * 100.0);
+                }
+                puts("");
+        }
+}
+
+void
+BenchSave(bench_result *Results, unsigned int Count, char *FileName)
+{
+        FILE *File = fopen(FileName, "w");
+        if(File == NULL) GSAbortWithMessage("Couldn't open %s for writing\n", FileName);
+
+        for(unsigned int I = 0; I < Count; I++)
+        {
+                for(int Phase = 0; Phase < BENCH_PHASE_COUNT; Phase++)
+                {
+                        fprintf(File, "%s %s %.9f %lu %u\n",
+                                Results[I].FileName, BenchPhaseNames[Phase], Results[I].Seconds[Phase],
+                                (unsigned long)Results[I].Bytes, Results[I].Keys);
+                }
+        }
+        fclose(File);
+}
+
+void
+BenchUsage(char *ProgramName)
+{
+        printf("Usage: %s config-file... [options]\n", basename(ProgramName));
+        puts("");
+        puts("Times gscfg's generator over each config file, reporting the best of");
+        puts("several runs for each phase.");
+        puts("");
+        puts("Options:");
+        puts("\t--runs: Number of runs per config file. Defaults to 5.");
+        puts("\t--save: Write results to this baseline file.");
+        puts("\t--baseline: Compare results against this baseline file.");
+        puts("\t--indent: As for gscfg. Defaults to 8.");
+        exit(EXIT_SUCCESS);
+}
+
+int
+main(int ArgCount, char **Arguments)
+{
+        gs_args *Args;
+        Args = GSArgsInit(alloca(GSArgsAllocSize()), ArgCount, Arguments);
+        if(GSArgsHelpWanted(Args) || ArgCount == 1) BenchUsage(GSArgsProgramName(Args));
+
+        unsigned int Runs = 5;
+        if(GSArgsIsPresent(Args, "--runs")) Runs = GSMax(1, strtoul(GSArgsAfter(Args, "--runs"), NULL, 10));
+        char *SaveFile = GSArgsAfter(Args, "--save");
+        char *BaselineFile = GSArgsAfter(Args, "--baseline");
+
+        config Config;
+        Config.StructName = "bench";
+        Config.FunctionPrefix = "bench";
+        Config.SourceStyle = SOURCE_STYLE_C;
+        Config.Lookup = LOOKUP_CHAIN;
+        Config.Layout = LAYOUT_POINTER;
+        Config.IsTyped = false;
+        Config.IsStatic = false;
+        Config.IsInstrumented = false;
+        Config.IsHeader = false;
+        Config.ProfileFile = NULL;
+        Config.Indent = 8;
+        if(GSArgsIsPresent(Args, "--indent")) Config.Indent = strtoul(GSArgsAfter(Args, "--indent"), NULL, 10);
+
+        size_t ArenaSize = 64 * 1024 * 1024;
+        void *ArenaMemory = malloc(ArenaSize);
+        if(ArenaMemory == NULL) GSAbortWithMessage("Couldn't allocate %lu bytes\n", ArenaSize);
+        gs_arena Arena;
+        GSArenaInit(&Arena, ArenaMemory, ArenaSize);
+        GSArenaAllowGrowth(&Arena, malloc, free, 0);
+
+        bench_result *Results = (bench_result *)malloc(sizeof(bench_result) * ArgCount);
+        unsigned int ResultCount = 0;
+        for(int I = 1; I < ArgCount; I++)
+        {
+                char *Arg = GSArgsAtIndex(Args, I);
+                if(Arg[0] == '-' && Arg[1] == '-')
+                {
+                        I++; /* Skip the option's value. */
+                        continue;
+                }
+
+                BenchFile(&Config, Arg, Runs, &Arena, &Results[ResultCount]);
+                BenchReport(&Results[ResultCount], BaselineFile);
+                ResultCount++;
+        }
+
+        if(SaveFile != NULL) BenchSave(Results, ResultCount, SaveFile);
+
+        free(Results);
+        GSArenaReset(&Arena);
+        free(ArenaMemory);
+
+        return(EXIT_SUCCESS);
+}
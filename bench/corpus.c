@@ -0,0 +1,150 @@
+/******************************************************************************
+ * File: corpus.c
+ * Created: 2026-10-17
+ * Last Updated: 2026-10-17
+ * Creator: Aaron Oman (a.k.a GrooveStomp)
+ * Notice: (C) Copyright 2016 by Aaron Oman
+ *-----------------------------------------------------------------------------
+ *
+ * Synthetic config generator for benchmarking gscfg.
+ * Writes a config with a given number of keys, nesting depth, key length,
+ * value length and line ending style.
+ *
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h> /* EXIT_SUCCESS, strtoul */
+#include <alloca.h>
+#include <libgen.h> /* POSIX basename */
+#include "../gs.h"
+
+typedef struct corpus
+{
+        unsigned long Keys;
+        unsigned int Depth;
+        unsigned int Fanout;
+        unsigned int KeyLength;
+        unsigned int ValueLength;
+        unsigned int Indent;
+        char *LineEnding;
+        unsigned int Seed;
+} corpus;
+
+unsigned int
+CorpusRandom(corpus *Self)
+{
+        /* Numerical Recipes LCG. Good enough for filler text. */
+        Self->Seed = Self->Seed * 1664525 + 1013904223;
+        return(Self->Seed >> 8);
+}
+
+void
+CorpusPrintName(corpus *Self, FILE *Out, char Prefix, unsigned long Index)
+{
+        int Length = fprintf(Out, "%c%lu", Prefix, Index);
+        for(; Length < Self->KeyLength; Length++) fputc('_', Out);
+}
+
+void
+CorpusPrintIndent(corpus *Self, FILE *Out, unsigned int Depth)
+{
+        for(unsigned int I = 0; I < Depth * Self->Indent; I++) fputc(' ', Out);
+}
+
+/*
+  Leaves are written in blocks of Fanout keys. Each block sits one level
+  deeper than the last until Depth is reached, then the nesting unwinds back
+  to the top level and starts over. Every key and struct name is unique.
+*/
+void
+CorpusWrite(corpus *Self, FILE *Out)
+{
+        static const char Alphabet[] = "abcdefghijklmnopqrstuvwxyz0123456789";
+        unsigned long StructIndex = 0;
+        unsigned int CurrentDepth = 0;
+
+        for(unsigned long Key = 0; Key < Self->Keys; Key++)
+        {
+                unsigned long Block = Key / Self->Fanout;
+                unsigned int Depth = (Self->Depth == 0) ? 0 : Block % (Self->Depth + 1);
+
+                if(Key % Self->Fanout == 0)
+                {
+                        if(Depth <= CurrentDepth) CurrentDepth = 0;
+                        while(CurrentDepth < Depth)
+                        {
+                                CorpusPrintIndent(Self, Out, CurrentDepth);
+                                CorpusPrintName(Self, Out, 's', StructIndex++);
+                                fprintf(Out, ":%s", Self->LineEnding);
+                                CurrentDepth++;
+                        }
+                }
+
+                CorpusPrintIndent(Self, Out, CurrentDepth);
+                CorpusPrintName(Self, Out, 'k', Key);
+                fputs(": ", Out);
+                for(unsigned int I = 0; I < Self->ValueLength; I++)
+                {
+                        fputc(Alphabet[CorpusRandom(Self) % (sizeof(Alphabet) - 1)], Out);
+                }
+                fputs(Self->LineEnding, Out);
+        }
+}
+
+void
+Usage(char *ProgramName)
+{
+        printf("Usage: %s output-file [options]\n", basename(ProgramName));
+        puts("");
+        puts("Writes a synthetic config file for benchmarking gscfg.");
+        puts("");
+        puts("Options:");
+        puts("\t--keys: Number of leaf keys. Defaults to 1000.");
+        puts("\t--depth: Maximum nesting depth. Defaults to 2.");
+        puts("\t--fanout: Keys per nesting level before going deeper. Defaults to 8.");
+        puts("\t--key-length: Minimum length of each key. Defaults to 8.");
+        puts("\t--value-length: Length of each value. Defaults to 16.");
+        puts("\t--indent: Spaces per nesting level. Defaults to 4.");
+        puts("\t--line-ending: One of: lf, crlf. Defaults to lf.");
+        puts("\t--seed: Seed for generated values. Defaults to 1.");
+        exit(EXIT_SUCCESS);
+}
+
+unsigned long
+ArgOrDefault(gs_args *Args, char *Name, unsigned long Default)
+{
+        char *Value = GSArgsAfter(Args, Name);
+        if(Value == NULL) return(Default);
+        return(strtoul(Value, NULL, 10));
+}
+
+int
+main(int ArgCount, char **Arguments)
+{
+        gs_args *Args;
+        Args = GSArgsInit(alloca(GSArgsAllocSize()), ArgCount, Arguments);
+        if(GSArgsHelpWanted(Args) || ArgCount == 1) Usage(GSArgsProgramName(Args));
+
+        corpus Corpus;
+        Corpus.Keys = ArgOrDefault(Args, "--keys", 1000);
+        Corpus.Depth = ArgOrDefault(Args, "--depth", 2);
+        Corpus.Fanout = GSMax(1, ArgOrDefault(Args, "--fanout", 8));
+        Corpus.KeyLength = ArgOrDefault(Args, "--key-length", 8);
+        Corpus.ValueLength = GSMax(1, ArgOrDefault(Args, "--value-length", 16));
+        Corpus.Indent = GSMax(1, ArgOrDefault(Args, "--indent", 4));
+        Corpus.Seed = ArgOrDefault(Args, "--seed", 1);
+
+        Corpus.LineEnding = "\n";
+        char *LineEnding = GSArgsAfter(Args, "--line-ending");
+        if(LineEnding != NULL && GSStringIsEqual("crlf", LineEnding, GSStringLength("crlf")))
+        {
+                Corpus.LineEnding = "\r\n";
+        }
+
+        char *FileName = GSArgsAtIndex(Args, 1);
+        FILE *Out = fopen(FileName, "w");
+        if(Out == NULL) GSAbortWithMessage("Couldn't open %s for writing\n", FileName);
+        CorpusWrite(&Corpus, Out);
+        fclose(Out);
+
+        return(EXIT_SUCCESS);
+}
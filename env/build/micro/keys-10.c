@@ -0,0 +1,294 @@
+#include <string.h> /* memcmp, strlen */
+#include <stddef.h> /* offsetof, size_t */
+#include <stdint.h> /* uint32_t, uint64_t, int64_t */
+typedef struct bench
+{
+        char *k0______;
+        char *k1______;
+        char *k2______;
+        char *k3______;
+        char *k4______;
+        char *k5______;
+        char *k6______;
+        char *k7______;
+        struct
+        {
+                char *k8______;
+                char *k9______;
+        } s0______;
+} bench;
+typedef enum bench_key
+{
+        BENCH_K0______,
+        BENCH_K1______,
+        BENCH_K2______,
+        BENCH_K3______,
+        BENCH_K4______,
+        BENCH_K5______,
+        BENCH_K6______,
+        BENCH_K7______,
+        BENCH_S0_______K8______,
+        BENCH_S0_______K9______,
+        BENCH_KEY_COUNT
+} bench_key;
+static const size_t benchoffsets[BENCH_KEY_COUNT] =
+{
+        offsetof(bench, k0______),
+        offsetof(bench, k1______),
+        offsetof(bench, k2______),
+        offsetof(bench, k3______),
+        offsetof(bench, k4______),
+        offsetof(bench, k5______),
+        offsetof(bench, k6______),
+        offsetof(bench, k7______),
+        offsetof(bench, s0______.k8______),
+        offsetof(bench, s0______.k9______),
+};
+typedef enum bench_type
+{
+        BENCH_TYPE_STRING,
+        BENCH_TYPE_INT,
+        BENCH_TYPE_FLOAT,
+        BENCH_TYPE_BOOL
+} bench_type;
+typedef struct bench_descriptor
+{
+        uint32_t name; /* Into benchnames. */
+        uint32_t length;
+        uint32_t offset; /* Of the field in bench. */
+        int id;
+        unsigned char type; /* bench_type */
+} bench_descriptor;
+typedef int (*bench_visitor)(const bench_descriptor *descriptor, const void *field, void *context);
+typedef struct bench_node
+{
+        uint32_t begin; /* Descriptors [begin, end) are under the node. */
+        uint32_t end;
+        uint32_t length; /* Of the node's name and the '.' after it. */
+} bench_node;
+static const char benchnames[] =
+        "k0______\0"
+        "k1______\0"
+        "k2______\0"
+        "k3______\0"
+        "k4______\0"
+        "k5______\0"
+        "k6______\0"
+        "k7______\0"
+        "s0______.k8______\0"
+        "s0______.k9______\0";
+#define benchname(descriptor) (benchnames + (descriptor)->name)
+static const bench_descriptor benchdescriptors[BENCH_KEY_COUNT] =
+{
+        { 0, 8, offsetof(bench, k0______), BENCH_K0______, BENCH_TYPE_STRING },
+        { 9, 8, offsetof(bench, k1______), BENCH_K1______, BENCH_TYPE_STRING },
+        { 18, 8, offsetof(bench, k2______), BENCH_K2______, BENCH_TYPE_STRING },
+        { 27, 8, offsetof(bench, k3______), BENCH_K3______, BENCH_TYPE_STRING },
+        { 36, 8, offsetof(bench, k4______), BENCH_K4______, BENCH_TYPE_STRING },
+        { 45, 8, offsetof(bench, k5______), BENCH_K5______, BENCH_TYPE_STRING },
+        { 54, 8, offsetof(bench, k6______), BENCH_K6______, BENCH_TYPE_STRING },
+        { 63, 8, offsetof(bench, k7______), BENCH_K7______, BENCH_TYPE_STRING },
+        { 72, 17, offsetof(bench, s0______.k8______), BENCH_S0_______K8______, BENCH_TYPE_STRING },
+        { 90, 17, offsetof(bench, s0______.k9______), BENCH_S0_______K9______, BENCH_TYPE_STRING },
+};
+void
+benchinit(bench *self)
+{
+        self->k0______ = "jv3obbzxoiylvmlm";
+        self->k1______ = "qa76jroghzcox8cz";
+        self->k2______ = "y1zrgzpivlu43mbv";
+        self->k3______ = "p56143utsu0vdklw";
+        self->k4______ = "oger0vmklbmfkz44";
+        self->k5______ = "jrys8bjab4vaqtv9";
+        self->k6______ = "j6iqxzgt8d56k7u1";
+        self->k7______ = "exmftrdrt2vxf996";
+        self->s0______.k8______ = "t81h9faqfjtptjb7";
+        self->s0______.k9______ = "5z9y23ics8r979er";
+}
+static const uint32_t benchdisplacements[3] =
+{
+        1, 30, 0,
+};
+static const struct { char *name; uint32_t length; int id; } benchslots[10] =
+{
+        { "k5______", 8, BENCH_K5______ },
+        { "k7______", 8, BENCH_K7______ },
+        { "k6______", 8, BENCH_K6______ },
+        { "s0______.k8______", 17, BENCH_S0_______K8______ },
+        { "k1______", 8, BENCH_K1______ },
+        { "k2______", 8, BENCH_K2______ },
+        { "s0______.k9______", 17, BENCH_S0_______K9______ },
+        { "k4______", 8, BENCH_K4______ },
+        { "k3______", 8, BENCH_K3______ },
+        { "k0______", 8, BENCH_K0______ },
+};
+static uint32_t
+benchslot(const char *string, size_t length)
+{
+        uint64_t hash = 14695981039346656037ULL;
+        for(size_t i = 0; i < length; i++) hash = (hash ^ (unsigned char)string[i]) * 1099511628211ULL;
+        uint64_t mix = hash ^ (hash >> 33);
+        mix *= 0xff51afd7ed558ccdULL;
+        mix ^= mix >> 33;
+        mix = hash ^ (benchdisplacements[mix % 3] * 0x9e3779b97f4a7c15ULL);
+        mix ^= mix >> 33;
+        mix *= 0xff51afd7ed558ccdULL;
+        mix ^= mix >> 33;
+        return((uint32_t)(mix % 10));
+}
+static int
+benchprobe(uint32_t slot, const char *string, size_t length)
+{
+        if(benchslots[slot].length == length &&
+           memcmp(benchslots[slot].name, string, length) == 0)
+        {
+                return(benchslots[slot].id);
+        }
+        return(-1);
+}
+int
+benchkeyidn(const char *string, size_t length)
+{
+        return(benchprobe(benchslot(string, length), string, length));
+}
+int
+benchkeyid(char *string)
+{
+        return(benchkeyidn(string, strlen(string)));
+}
+char *
+benchgetbyid(const bench *self, int id)
+{
+        return(*(char * const *)((const char *)self + benchoffsets[id]));
+}
+unsigned int
+benchfindn(const bench *self, const char *string, size_t length, char **value)
+{
+        int id = benchkeyidn(string, length);
+        if(id < 0)
+        {
+                return(0);
+        }
+        *value = benchgetbyid(self, id);
+        return(!0);
+}
+unsigned int
+benchfind(const bench *self, char *string, char **value)
+{
+        return(benchfindn(self, string, strlen(string), value));
+}
+unsigned int
+benchhaskeyn(const bench *self, const char *string, size_t length)
+{
+        (void)self;
+        return(benchkeyidn(string, length) >= 0);
+}
+unsigned int
+benchhaskey(const bench *self, char *string)
+{
+        return(benchhaskeyn(self, string, strlen(string)));
+}
+char *
+benchgetn(const bench *self, const char *string, size_t length)
+{
+        char *value = NULL;
+        benchfindn(self, string, length, &value);
+        return(value);
+}
+char *
+benchget(const bench *self, char *string)
+{
+        return(benchgetn(self, string, strlen(string)));
+}
+int
+benchvisit(const bench *self, bench_visitor visit, void *context)
+{
+        for(int i = 0; i < BENCH_KEY_COUNT; i++)
+        {
+                const bench_descriptor *descriptor = &benchdescriptors[i];
+                int result = visit(descriptor, (const char *)self + descriptor->offset, context);
+                if(result != 0)
+                {
+                        return(result);
+                }
+        }
+        return(0);
+}
+static uint32_t /* First of descriptors [Begin, End) not sorting before String then Next, past Skip bytes of each name. No Next if negative. */
+benchlowerbound(uint32_t begin, uint32_t end, uint32_t skip, const char *string, size_t length, int next)
+{
+        while(begin < end)
+        {
+                uint32_t middle = begin + (end - begin) / 2;
+                const bench_descriptor *descriptor = &benchdescriptors[middle];
+                const char *name = benchnames + descriptor->name + skip;
+                size_t rest = descriptor->length - skip;
+                int order = memcmp(name, string, (rest < length) ? rest : length);
+                if(order == 0 && rest > length && next >= 0) order = (unsigned char)name[length] - next;
+                else if(order == 0 && (rest < length || (rest == length && next >= 0))) order = -1;
+                if(order < 0) begin = middle + 1;
+                else end = middle;
+        }
+        return(begin);
+}
+bench_node
+benchsubtreen(const char *string, size_t length)
+{
+        bench_node node = { 0, BENCH_KEY_COUNT, 0 };
+        if(length == 0)
+        {
+                return(node);
+        }
+        node.begin = benchlowerbound(0, node.end, 0, string, length, '.');
+        node.end = benchlowerbound(node.begin, node.end, 0, string, length, '/');
+        node.length = (uint32_t)length + 1;
+        return(node);
+}
+bench_node
+benchsubtree(char *string)
+{
+        return(benchsubtreen(string, strlen(string)));
+}
+int
+benchchildn(bench_node parent, const char *string, size_t length)
+{
+        uint32_t index = benchlowerbound(parent.begin, parent.end, parent.length, string, length, -1);
+        if(index < parent.end)
+        {
+                const bench_descriptor *descriptor = &benchdescriptors[index];
+                if(descriptor->length == parent.length + length &&
+                   memcmp(benchnames + descriptor->name + parent.length, string, length) == 0)
+                {
+                        return(descriptor->id);
+                }
+        }
+        return(-1);
+}
+int
+benchchild(bench_node parent, char *string)
+{
+        return(benchchildn(parent, string, strlen(string)));
+}
+size_t
+benchgetmany(const bench *self, const char **strings, size_t count, char **values)
+{
+        size_t found = 0;
+        for(size_t begin = 0; begin < count; begin += 64)
+        {
+                size_t end = (count - begin < 64) ? count : begin + 64;
+                size_t lengths[64];
+                uint32_t slots[64];
+                for(size_t i = begin; i < end; i++)
+                {
+                        lengths[i - begin] = strlen(strings[i]);
+                        slots[i - begin] = benchslot(strings[i], lengths[i - begin]);
+                }
+                for(size_t i = begin; i < end; i++)
+                {
+                        int id = benchprobe(slots[i - begin], strings[i], lengths[i - begin]);
+                        values[i] = (id < 0) ? NULL : benchgetbyid(self, id);
+                        if(values[i] != NULL) found++;
+                }
+        }
+        return(found);
+}
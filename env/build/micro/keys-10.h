@@ -0,0 +1,371 @@
+#ifndef bench_h
+#define bench_h
+#include <string.h> /* memcmp, strlen */
+#include <stddef.h> /* offsetof, size_t */
+#include <stdint.h> /* uint32_t, uint64_t, int64_t */
+typedef struct bench
+{
+        char *k0______;
+        char *k1______;
+        char *k2______;
+        char *k3______;
+        char *k4______;
+        char *k5______;
+        char *k6______;
+        char *k7______;
+        struct
+        {
+                char *k8______;
+                char *k9______;
+        } s0______;
+} bench;
+typedef enum bench_key
+{
+        BENCH_K0______,
+        BENCH_K1______,
+        BENCH_K2______,
+        BENCH_K3______,
+        BENCH_K4______,
+        BENCH_K5______,
+        BENCH_K6______,
+        BENCH_K7______,
+        BENCH_S0_______K8______,
+        BENCH_S0_______K9______,
+        bench_key_count
+} bench_key;
+static const size_t benchoffsets[bench_key_count] =
+{
+        offsetof(bench, k0______),
+        offsetof(bench, k1______),
+        offsetof(bench, k2______),
+        offsetof(bench, k3______),
+        offsetof(bench, k4______),
+        offsetof(bench, k5______),
+        offsetof(bench, k6______),
+        offsetof(bench, k7______),
+        offsetof(bench, s0______.k8______),
+        offsetof(bench, s0______.k9______),
+};
+typedef enum bench_type
+{
+        bench_type_string,
+        bench_type_int,
+        bench_type_float,
+        bench_type_bool
+} bench_type;
+typedef struct bench_descriptor
+{
+        uint32_t name; /* Into benchnames. */
+        uint32_t length;
+        uint32_t offset; /* Of the field in bench. */
+        int id;
+        unsigned char type; /* bench_type */
+} bench_descriptor;
+typedef int (*bench_visitor)(const bench_descriptor *descriptor, const void *field, void *context);
+typedef struct bench_node
+{
+        uint32_t begin; /* Descriptors [begin, end) are under the node. */
+        uint32_t end;
+        uint32_t length; /* Of the node's name and the '.' after it. */
+} bench_node;
+static const char benchnames[] =
+        "k0______\0"
+        "k1______\0"
+        "k2______\0"
+        "k3______\0"
+        "k4______\0"
+        "k5______\0"
+        "k6______\0"
+        "k7______\0"
+        "s0______.k8______\0"
+        "s0______.k9______\0";
+#define benchname(descriptor) (benchnames + (descriptor)->name)
+static const bench_descriptor benchdescriptors[bench_key_count] =
+{
+        { 0, 8, offsetof(bench, k0______), BENCH_K0______, bench_type_string },
+        { 9, 8, offsetof(bench, k1______), BENCH_K1______, bench_type_string },
+        { 18, 8, offsetof(bench, k2______), BENCH_K2______, bench_type_string },
+        { 27, 8, offsetof(bench, k3______), BENCH_K3______, bench_type_string },
+        { 36, 8, offsetof(bench, k4______), BENCH_K4______, bench_type_string },
+        { 45, 8, offsetof(bench, k5______), BENCH_K5______, bench_type_string },
+        { 54, 8, offsetof(bench, k6______), BENCH_K6______, bench_type_string },
+        { 63, 8, offsetof(bench, k7______), BENCH_K7______, bench_type_string },
+        { 72, 17, offsetof(bench, s0______.k8______), BENCH_S0_______K8______, bench_type_string },
+        { 90, 17, offsetof(bench, s0______.k9______), BENCH_S0_______K9______, bench_type_string },
+};
+static const uint64_t benchfilter[4] =
+{
+        0x2000000000000000ULL, 0x0000000000000010ULL, 0x0000400000000000ULL, 0x0200000000000000ULL,
+};
+static inline int
+benchmayhavekey(const char *string, size_t length)
+{
+        if(length == 0)
+        {
+                return(0);
+        }
+        uint64_t hash = (((uint64_t)(length & 0xff) << 24) |
+                         ((uint64_t)(unsigned char)string[0] << 16) |
+                         ((uint64_t)(unsigned char)string[length / 2] << 8) |
+                         (uint64_t)(unsigned char)string[length - 1]) * 0x9e3779b97f4a7c15ULL;
+        uint64_t first = hash >> 56;
+        uint64_t second = (hash >> 48) & 0xffULL;
+        return((benchfilter[first / 64] >> (first % 64) & 1) &&
+               (benchfilter[second / 64] >> (second % 64) & 1));
+}
+void benchinit(bench *self);
+#if defined(GSCFG_IMPLEMENTATION)
+void
+benchinit(bench *self)
+{
+        self->k0______ = "jv3obbzxoiylvmlm";
+        self->k1______ = "qa76jroghzcox8cz";
+        self->k2______ = "y1zrgzpivlu43mbv";
+        self->k3______ = "p56143utsu0vdklw";
+        self->k4______ = "oger0vmklbmfkz44";
+        self->k5______ = "jrys8bjab4vaqtv9";
+        self->k6______ = "j6iqxzgt8d56k7u1";
+        self->k7______ = "exmftrdrt2vxf996";
+        self->s0______.k8______ = "t81h9faqfjtptjb7";
+        self->s0______.k9______ = "5z9y23ics8r979er";
+}
+#endif
+static inline int
+benchkeyidn(const char *string, size_t length)
+{
+        if(!benchmayhavekey(string, length))
+        {
+                return(-1);
+        }
+        if(length == 8 && memcmp(string, "k0______", 8) == 0)
+        {
+                return(BENCH_K0______);
+        }
+        if(length == 8 && memcmp(string, "k1______", 8) == 0)
+        {
+                return(BENCH_K1______);
+        }
+        if(length == 8 && memcmp(string, "k2______", 8) == 0)
+        {
+                return(BENCH_K2______);
+        }
+        if(length == 8 && memcmp(string, "k3______", 8) == 0)
+        {
+                return(BENCH_K3______);
+        }
+        if(length == 8 && memcmp(string, "k4______", 8) == 0)
+        {
+                return(BENCH_K4______);
+        }
+        if(length == 8 && memcmp(string, "k5______", 8) == 0)
+        {
+                return(BENCH_K5______);
+        }
+        if(length == 8 && memcmp(string, "k6______", 8) == 0)
+        {
+                return(BENCH_K6______);
+        }
+        if(length == 8 && memcmp(string, "k7______", 8) == 0)
+        {
+                return(BENCH_K7______);
+        }
+        if(length == 17 && memcmp(string, "s0______.k8______", 17) == 0)
+        {
+                return(BENCH_S0_______K8______);
+        }
+        if(length == 17 && memcmp(string, "s0______.k9______", 17) == 0)
+        {
+                return(BENCH_S0_______K9______);
+        }
+        return(-1);
+}
+static inline int
+benchkeyid(char *string)
+{
+        return(benchkeyidn(string, strlen(string)));
+}
+static inline char *
+benchgetbyid(const bench *self, int id)
+{
+        return(*(char * const *)((const char *)self + benchoffsets[id]));
+}
+static inline unsigned int
+benchfindn(const bench *self, const char *string, size_t length, char **value)
+{
+        int id = benchkeyidn(string, length);
+        if(id < 0)
+        {
+                return(0);
+        }
+        *value = benchgetbyid(self, id);
+        return(!0);
+}
+static inline unsigned int
+benchfind(const bench *self, char *string, char **value)
+{
+        return(benchfindn(self, string, strlen(string), value));
+}
+static inline unsigned int
+benchhaskeyn(const bench *self, const char *string, size_t length)
+{
+        (void)self;
+        return(benchkeyidn(string, length) >= 0);
+}
+static inline unsigned int
+benchhaskey(const bench *self, char *string)
+{
+        return(benchhaskeyn(self, string, strlen(string)));
+}
+static inline char *
+benchgetn(const bench *self, const char *string, size_t length)
+{
+        char *value = NULL;
+        benchfindn(self, string, length, &value);
+        return(value);
+}
+static inline char *
+benchget(const bench *self, char *string)
+{
+        return(benchgetn(self, string, strlen(string)));
+}
+int benchvisit(const bench *self, bench_visitor visit, void *context);
+#if defined(GSCFG_IMPLEMENTATION)
+int
+benchvisit(const bench *self, bench_visitor visit, void *context)
+{
+        for(int i = 0; i < bench_key_count; i++)
+        {
+                const bench_descriptor *descriptor = &benchdescriptors[i];
+                int result = visit(descriptor, (const char *)self + descriptor->offset, context);
+                if(result != 0)
+                {
+                        return(result);
+                }
+        }
+        return(0);
+}
+#endif
+static inline uint32_t /* First of descriptors [Begin, End) not sorting before String then Next, past Skip bytes of each name. No Next if negative. */
+benchlowerbound(uint32_t begin, uint32_t end, uint32_t skip, const char *string, size_t length, int next)
+{
+        while(begin < end)
+        {
+                uint32_t middle = begin + (end - begin) / 2;
+                const bench_descriptor *descriptor = &benchdescriptors[middle];
+                const char *name = benchnames + descriptor->name + skip;
+                size_t rest = descriptor->length - skip;
+                int order = memcmp(name, string, (rest < length) ? rest : length);
+                if(order == 0 && rest > length && next >= 0) order = (unsigned char)name[length] - next;
+                else if(order == 0 && (rest < length || (rest == length && next >= 0))) order = -1;
+                if(order < 0) begin = middle + 1;
+                else end = middle;
+        }
+        return(begin);
+}
+static inline bench_node
+benchsubtreen(const char *string, size_t length)
+{
+        bench_node node = { 0, bench_key_count, 0 };
+        if(length == 0)
+        {
+                return(node);
+        }
+        node.begin = benchlowerbound(0, node.end, 0, string, length, '.');
+        node.end = benchlowerbound(node.begin, node.end, 0, string, length, '/');
+        node.length = (uint32_t)length + 1;
+        return(node);
+}
+static inline bench_node
+benchsubtree(char *string)
+{
+        return(benchsubtreen(string, strlen(string)));
+}
+static inline int
+benchchildn(bench_node parent, const char *string, size_t length)
+{
+        uint32_t index = benchlowerbound(parent.begin, parent.end, parent.length, string, length, -1);
+        if(index < parent.end)
+        {
+                const bench_descriptor *descriptor = &benchdescriptors[index];
+                if(descriptor->length == parent.length + length &&
+                   memcmp(benchnames + descriptor->name + parent.length, string, length) == 0)
+                {
+                        return(descriptor->id);
+                }
+        }
+        return(-1);
+}
+static inline int
+benchchild(bench_node parent, char *string)
+{
+        return(benchchildn(parent, string, strlen(string)));
+}
+size_t benchgetmany(const bench *self, const char **strings, size_t count, char **values);
+#if defined(GSCFG_IMPLEMENTATION)
+size_t
+benchgetmany(const bench *self, const char **strings, size_t count, char **values)
+{
+        size_t found = 0;
+        for(size_t begin = 0; begin < count; begin += 64)
+        {
+                size_t end = (count - begin < 64) ? count : begin + 64;
+                size_t lengths[64];
+                uint64_t prefixes[64];
+                size_t sorted[64];
+                size_t sortedcount = 0;
+                for(size_t i = begin; i < end; i++)
+                {
+                        size_t length = lengths[i - begin] = strlen(strings[i]);
+                        if(!benchmayhavekey(strings[i], length))
+                        {
+                                values[i] = NULL;
+                                continue;
+                        }
+                        uint64_t prefix = 0;
+                        for(size_t k = 0; k < 8; k++) prefix = (prefix << 8) | ((k < length) ? (unsigned char)strings[i][k] : 0);
+                        prefixes[i - begin] = prefix;
+                        size_t j = sortedcount++;
+                        for(; j > 0; j--)
+                        {
+                                size_t other = sorted[j - 1];
+                                if(prefixes[other - begin] < prefix) break;
+                                if(prefixes[other - begin] == prefix)
+                                {
+                                        size_t otherlength = lengths[other - begin];
+                                        size_t shorter = (otherlength < length) ? otherlength : length;
+                                        int order = (shorter > 8) ? memcmp(strings[other] + 8, strings[i] + 8, shorter - 8) : 0;
+                                        if(order < 0 || (order == 0 && otherlength <= length)) break;
+                                }
+                                sorted[j] = other;
+                        }
+                        sorted[j] = i;
+                }
+                uint32_t cursor = 0;
+                for(size_t j = 0; j < sortedcount; j++)
+                {
+                        size_t i = sorted[j];
+                        size_t length = lengths[i - begin];
+                        uint32_t limit = cursor;
+                        uint32_t step = 1;
+                        while(limit < bench_key_count && benchlowerbound(limit, limit + 1, 0, strings[i], length, -1) > limit)
+                        {
+                                cursor = limit + 1;
+                                limit = cursor + step - 1;
+                                step *= 2;
+                        }
+                        if(limit > bench_key_count) limit = bench_key_count;
+                        cursor = benchlowerbound(cursor, limit, 0, strings[i], length, -1);
+                        int id = -1;
+                        if(cursor < bench_key_count)
+                        {
+                                const bench_descriptor *descriptor = &benchdescriptors[cursor];
+                                if(descriptor->length == length && memcmp(benchnames + descriptor->name, strings[i], length) == 0) id = descriptor->id;
+                        }
+                        values[i] = (id < 0) ? NULL : benchgetbyid(self, id);
+                        if(values[i] != NULL) found++;
+                }
+        }
+        return(found);
+}
+#endif
+#endif
@@ -0,0 +1,7485 @@
+#include <string.h> /* memcmp, strlen */
+#include <stddef.h> /* offsetof, size_t */
+#include <stdint.h> /* uint32_t, uint64_t, int64_t */
+typedef struct bench
+{
+        char *k0______;
+        char *k1______;
+        char *k2______;
+        char *k3______;
+        char *k4______;
+        char *k5______;
+        char *k6______;
+        char *k7______;
+        struct
+        {
+                char *k8______;
+                char *k9______;
+                char *k10_____;
+                char *k11_____;
+                char *k12_____;
+                char *k13_____;
+                char *k14_____;
+                char *k15_____;
+                struct
+                {
+                        char *k16_____;
+                        char *k17_____;
+                        char *k18_____;
+                        char *k19_____;
+                        char *k20_____;
+                        char *k21_____;
+                        char *k22_____;
+                        char *k23_____;
+                } s1______;
+        } s0______;
+        char *k24_____;
+        char *k25_____;
+        char *k26_____;
+        char *k27_____;
+        char *k28_____;
+        char *k29_____;
+        char *k30_____;
+        char *k31_____;
+        struct
+        {
+                char *k32_____;
+                char *k33_____;
+                char *k34_____;
+                char *k35_____;
+                char *k36_____;
+                char *k37_____;
+                char *k38_____;
+                char *k39_____;
+                struct
+                {
+                        char *k40_____;
+                        char *k41_____;
+                        char *k42_____;
+                        char *k43_____;
+                        char *k44_____;
+                        char *k45_____;
+                        char *k46_____;
+                        char *k47_____;
+                } s3______;
+        } s2______;
+        char *k48_____;
+        char *k49_____;
+        char *k50_____;
+        char *k51_____;
+        char *k52_____;
+        char *k53_____;
+        char *k54_____;
+        char *k55_____;
+        struct
+        {
+                char *k56_____;
+                char *k57_____;
+                char *k58_____;
+                char *k59_____;
+                char *k60_____;
+                char *k61_____;
+                char *k62_____;
+                char *k63_____;
+                struct
+                {
+                        char *k64_____;
+                        char *k65_____;
+                        char *k66_____;
+                        char *k67_____;
+                        char *k68_____;
+                        char *k69_____;
+                        char *k70_____;
+                        char *k71_____;
+                } s5______;
+        } s4______;
+        char *k72_____;
+        char *k73_____;
+        char *k74_____;
+        char *k75_____;
+        char *k76_____;
+        char *k77_____;
+        char *k78_____;
+        char *k79_____;
+        struct
+        {
+                char *k80_____;
+                char *k81_____;
+                char *k82_____;
+                char *k83_____;
+                char *k84_____;
+                char *k85_____;
+                char *k86_____;
+                char *k87_____;
+                struct
+                {
+                        char *k88_____;
+                        char *k89_____;
+                        char *k90_____;
+                        char *k91_____;
+                        char *k92_____;
+                        char *k93_____;
+                        char *k94_____;
+                        char *k95_____;
+                } s7______;
+        } s6______;
+        char *k96_____;
+        char *k97_____;
+        char *k98_____;
+        char *k99_____;
+        char *k100____;
+        char *k101____;
+        char *k102____;
+        char *k103____;
+        struct
+        {
+                char *k104____;
+                char *k105____;
+                char *k106____;
+                char *k107____;
+                char *k108____;
+                char *k109____;
+                char *k110____;
+                char *k111____;
+                struct
+                {
+                        char *k112____;
+                        char *k113____;
+                        char *k114____;
+                        char *k115____;
+                        char *k116____;
+                        char *k117____;
+                        char *k118____;
+                        char *k119____;
+                } s9______;
+        } s8______;
+        char *k120____;
+        char *k121____;
+        char *k122____;
+        char *k123____;
+        char *k124____;
+        char *k125____;
+        char *k126____;
+        char *k127____;
+        struct
+        {
+                char *k128____;
+                char *k129____;
+                char *k130____;
+                char *k131____;
+                char *k132____;
+                char *k133____;
+                char *k134____;
+                char *k135____;
+                struct
+                {
+                        char *k136____;
+                        char *k137____;
+                        char *k138____;
+                        char *k139____;
+                        char *k140____;
+                        char *k141____;
+                        char *k142____;
+                        char *k143____;
+                } s11_____;
+        } s10_____;
+        char *k144____;
+        char *k145____;
+        char *k146____;
+        char *k147____;
+        char *k148____;
+        char *k149____;
+        char *k150____;
+        char *k151____;
+        struct
+        {
+                char *k152____;
+                char *k153____;
+                char *k154____;
+                char *k155____;
+                char *k156____;
+                char *k157____;
+                char *k158____;
+                char *k159____;
+                struct
+                {
+                        char *k160____;
+                        char *k161____;
+                        char *k162____;
+                        char *k163____;
+                        char *k164____;
+                        char *k165____;
+                        char *k166____;
+                        char *k167____;
+                } s13_____;
+        } s12_____;
+        char *k168____;
+        char *k169____;
+        char *k170____;
+        char *k171____;
+        char *k172____;
+        char *k173____;
+        char *k174____;
+        char *k175____;
+        struct
+        {
+                char *k176____;
+                char *k177____;
+                char *k178____;
+                char *k179____;
+                char *k180____;
+                char *k181____;
+                char *k182____;
+                char *k183____;
+                struct
+                {
+                        char *k184____;
+                        char *k185____;
+                        char *k186____;
+                        char *k187____;
+                        char *k188____;
+                        char *k189____;
+                        char *k190____;
+                        char *k191____;
+                } s15_____;
+        } s14_____;
+        char *k192____;
+        char *k193____;
+        char *k194____;
+        char *k195____;
+        char *k196____;
+        char *k197____;
+        char *k198____;
+        char *k199____;
+        struct
+        {
+                char *k200____;
+                char *k201____;
+                char *k202____;
+                char *k203____;
+                char *k204____;
+                char *k205____;
+                char *k206____;
+                char *k207____;
+                struct
+                {
+                        char *k208____;
+                        char *k209____;
+                        char *k210____;
+                        char *k211____;
+                        char *k212____;
+                        char *k213____;
+                        char *k214____;
+                        char *k215____;
+                } s17_____;
+        } s16_____;
+        char *k216____;
+        char *k217____;
+        char *k218____;
+        char *k219____;
+        char *k220____;
+        char *k221____;
+        char *k222____;
+        char *k223____;
+        struct
+        {
+                char *k224____;
+                char *k225____;
+                char *k226____;
+                char *k227____;
+                char *k228____;
+                char *k229____;
+                char *k230____;
+                char *k231____;
+                struct
+                {
+                        char *k232____;
+                        char *k233____;
+                        char *k234____;
+                        char *k235____;
+                        char *k236____;
+                        char *k237____;
+                        char *k238____;
+                        char *k239____;
+                } s19_____;
+        } s18_____;
+        char *k240____;
+        char *k241____;
+        char *k242____;
+        char *k243____;
+        char *k244____;
+        char *k245____;
+        char *k246____;
+        char *k247____;
+        struct
+        {
+                char *k248____;
+                char *k249____;
+                char *k250____;
+                char *k251____;
+                char *k252____;
+                char *k253____;
+                char *k254____;
+                char *k255____;
+                struct
+                {
+                        char *k256____;
+                        char *k257____;
+                        char *k258____;
+                        char *k259____;
+                        char *k260____;
+                        char *k261____;
+                        char *k262____;
+                        char *k263____;
+                } s21_____;
+        } s20_____;
+        char *k264____;
+        char *k265____;
+        char *k266____;
+        char *k267____;
+        char *k268____;
+        char *k269____;
+        char *k270____;
+        char *k271____;
+        struct
+        {
+                char *k272____;
+                char *k273____;
+                char *k274____;
+                char *k275____;
+                char *k276____;
+                char *k277____;
+                char *k278____;
+                char *k279____;
+                struct
+                {
+                        char *k280____;
+                        char *k281____;
+                        char *k282____;
+                        char *k283____;
+                        char *k284____;
+                        char *k285____;
+                        char *k286____;
+                        char *k287____;
+                } s23_____;
+        } s22_____;
+        char *k288____;
+        char *k289____;
+        char *k290____;
+        char *k291____;
+        char *k292____;
+        char *k293____;
+        char *k294____;
+        char *k295____;
+        struct
+        {
+                char *k296____;
+                char *k297____;
+                char *k298____;
+                char *k299____;
+                char *k300____;
+                char *k301____;
+                char *k302____;
+                char *k303____;
+                struct
+                {
+                        char *k304____;
+                        char *k305____;
+                        char *k306____;
+                        char *k307____;
+                        char *k308____;
+                        char *k309____;
+                        char *k310____;
+                        char *k311____;
+                } s25_____;
+        } s24_____;
+        char *k312____;
+        char *k313____;
+        char *k314____;
+        char *k315____;
+        char *k316____;
+        char *k317____;
+        char *k318____;
+        char *k319____;
+        struct
+        {
+                char *k320____;
+                char *k321____;
+                char *k322____;
+                char *k323____;
+                char *k324____;
+                char *k325____;
+                char *k326____;
+                char *k327____;
+                struct
+                {
+                        char *k328____;
+                        char *k329____;
+                        char *k330____;
+                        char *k331____;
+                        char *k332____;
+                        char *k333____;
+                        char *k334____;
+                        char *k335____;
+                } s27_____;
+        } s26_____;
+        char *k336____;
+        char *k337____;
+        char *k338____;
+        char *k339____;
+        char *k340____;
+        char *k341____;
+        char *k342____;
+        char *k343____;
+        struct
+        {
+                char *k344____;
+                char *k345____;
+                char *k346____;
+                char *k347____;
+                char *k348____;
+                char *k349____;
+                char *k350____;
+                char *k351____;
+                struct
+                {
+                        char *k352____;
+                        char *k353____;
+                        char *k354____;
+                        char *k355____;
+                        char *k356____;
+                        char *k357____;
+                        char *k358____;
+                        char *k359____;
+                } s29_____;
+        } s28_____;
+        char *k360____;
+        char *k361____;
+        char *k362____;
+        char *k363____;
+        char *k364____;
+        char *k365____;
+        char *k366____;
+        char *k367____;
+        struct
+        {
+                char *k368____;
+                char *k369____;
+                char *k370____;
+                char *k371____;
+                char *k372____;
+                char *k373____;
+                char *k374____;
+                char *k375____;
+                struct
+                {
+                        char *k376____;
+                        char *k377____;
+                        char *k378____;
+                        char *k379____;
+                        char *k380____;
+                        char *k381____;
+                        char *k382____;
+                        char *k383____;
+                } s31_____;
+        } s30_____;
+        char *k384____;
+        char *k385____;
+        char *k386____;
+        char *k387____;
+        char *k388____;
+        char *k389____;
+        char *k390____;
+        char *k391____;
+        struct
+        {
+                char *k392____;
+                char *k393____;
+                char *k394____;
+                char *k395____;
+                char *k396____;
+                char *k397____;
+                char *k398____;
+                char *k399____;
+                struct
+                {
+                        char *k400____;
+                        char *k401____;
+                        char *k402____;
+                        char *k403____;
+                        char *k404____;
+                        char *k405____;
+                        char *k406____;
+                        char *k407____;
+                } s33_____;
+        } s32_____;
+        char *k408____;
+        char *k409____;
+        char *k410____;
+        char *k411____;
+        char *k412____;
+        char *k413____;
+        char *k414____;
+        char *k415____;
+        struct
+        {
+                char *k416____;
+                char *k417____;
+                char *k418____;
+                char *k419____;
+                char *k420____;
+                char *k421____;
+                char *k422____;
+                char *k423____;
+                struct
+                {
+                        char *k424____;
+                        char *k425____;
+                        char *k426____;
+                        char *k427____;
+                        char *k428____;
+                        char *k429____;
+                        char *k430____;
+                        char *k431____;
+                } s35_____;
+        } s34_____;
+        char *k432____;
+        char *k433____;
+        char *k434____;
+        char *k435____;
+        char *k436____;
+        char *k437____;
+        char *k438____;
+        char *k439____;
+        struct
+        {
+                char *k440____;
+                char *k441____;
+                char *k442____;
+                char *k443____;
+                char *k444____;
+                char *k445____;
+                char *k446____;
+                char *k447____;
+                struct
+                {
+                        char *k448____;
+                        char *k449____;
+                        char *k450____;
+                        char *k451____;
+                        char *k452____;
+                        char *k453____;
+                        char *k454____;
+                        char *k455____;
+                } s37_____;
+        } s36_____;
+        char *k456____;
+        char *k457____;
+        char *k458____;
+        char *k459____;
+        char *k460____;
+        char *k461____;
+        char *k462____;
+        char *k463____;
+        struct
+        {
+                char *k464____;
+                char *k465____;
+                char *k466____;
+                char *k467____;
+                char *k468____;
+                char *k469____;
+                char *k470____;
+                char *k471____;
+                struct
+                {
+                        char *k472____;
+                        char *k473____;
+                        char *k474____;
+                        char *k475____;
+                        char *k476____;
+                        char *k477____;
+                        char *k478____;
+                        char *k479____;
+                } s39_____;
+        } s38_____;
+        char *k480____;
+        char *k481____;
+        char *k482____;
+        char *k483____;
+        char *k484____;
+        char *k485____;
+        char *k486____;
+        char *k487____;
+        struct
+        {
+                char *k488____;
+                char *k489____;
+                char *k490____;
+                char *k491____;
+                char *k492____;
+                char *k493____;
+                char *k494____;
+                char *k495____;
+                struct
+                {
+                        char *k496____;
+                        char *k497____;
+                        char *k498____;
+                        char *k499____;
+                        char *k500____;
+                        char *k501____;
+                        char *k502____;
+                        char *k503____;
+                } s41_____;
+        } s40_____;
+        char *k504____;
+        char *k505____;
+        char *k506____;
+        char *k507____;
+        char *k508____;
+        char *k509____;
+        char *k510____;
+        char *k511____;
+        struct
+        {
+                char *k512____;
+                char *k513____;
+                char *k514____;
+                char *k515____;
+                char *k516____;
+                char *k517____;
+                char *k518____;
+                char *k519____;
+                struct
+                {
+                        char *k520____;
+                        char *k521____;
+                        char *k522____;
+                        char *k523____;
+                        char *k524____;
+                        char *k525____;
+                        char *k526____;
+                        char *k527____;
+                } s43_____;
+        } s42_____;
+        char *k528____;
+        char *k529____;
+        char *k530____;
+        char *k531____;
+        char *k532____;
+        char *k533____;
+        char *k534____;
+        char *k535____;
+        struct
+        {
+                char *k536____;
+                char *k537____;
+                char *k538____;
+                char *k539____;
+                char *k540____;
+                char *k541____;
+                char *k542____;
+                char *k543____;
+                struct
+                {
+                        char *k544____;
+                        char *k545____;
+                        char *k546____;
+                        char *k547____;
+                        char *k548____;
+                        char *k549____;
+                        char *k550____;
+                        char *k551____;
+                } s45_____;
+        } s44_____;
+        char *k552____;
+        char *k553____;
+        char *k554____;
+        char *k555____;
+        char *k556____;
+        char *k557____;
+        char *k558____;
+        char *k559____;
+        struct
+        {
+                char *k560____;
+                char *k561____;
+                char *k562____;
+                char *k563____;
+                char *k564____;
+                char *k565____;
+                char *k566____;
+                char *k567____;
+                struct
+                {
+                        char *k568____;
+                        char *k569____;
+                        char *k570____;
+                        char *k571____;
+                        char *k572____;
+                        char *k573____;
+                        char *k574____;
+                        char *k575____;
+                } s47_____;
+        } s46_____;
+        char *k576____;
+        char *k577____;
+        char *k578____;
+        char *k579____;
+        char *k580____;
+        char *k581____;
+        char *k582____;
+        char *k583____;
+        struct
+        {
+                char *k584____;
+                char *k585____;
+                char *k586____;
+                char *k587____;
+                char *k588____;
+                char *k589____;
+                char *k590____;
+                char *k591____;
+                struct
+                {
+                        char *k592____;
+                        char *k593____;
+                        char *k594____;
+                        char *k595____;
+                        char *k596____;
+                        char *k597____;
+                        char *k598____;
+                        char *k599____;
+                } s49_____;
+        } s48_____;
+        char *k600____;
+        char *k601____;
+        char *k602____;
+        char *k603____;
+        char *k604____;
+        char *k605____;
+        char *k606____;
+        char *k607____;
+        struct
+        {
+                char *k608____;
+                char *k609____;
+                char *k610____;
+                char *k611____;
+                char *k612____;
+                char *k613____;
+                char *k614____;
+                char *k615____;
+                struct
+                {
+                        char *k616____;
+                        char *k617____;
+                        char *k618____;
+                        char *k619____;
+                        char *k620____;
+                        char *k621____;
+                        char *k622____;
+                        char *k623____;
+                } s51_____;
+        } s50_____;
+        char *k624____;
+        char *k625____;
+        char *k626____;
+        char *k627____;
+        char *k628____;
+        char *k629____;
+        char *k630____;
+        char *k631____;
+        struct
+        {
+                char *k632____;
+                char *k633____;
+                char *k634____;
+                char *k635____;
+                char *k636____;
+                char *k637____;
+                char *k638____;
+                char *k639____;
+                struct
+                {
+                        char *k640____;
+                        char *k641____;
+                        char *k642____;
+                        char *k643____;
+                        char *k644____;
+                        char *k645____;
+                        char *k646____;
+                        char *k647____;
+                } s53_____;
+        } s52_____;
+        char *k648____;
+        char *k649____;
+        char *k650____;
+        char *k651____;
+        char *k652____;
+        char *k653____;
+        char *k654____;
+        char *k655____;
+        struct
+        {
+                char *k656____;
+                char *k657____;
+                char *k658____;
+                char *k659____;
+                char *k660____;
+                char *k661____;
+                char *k662____;
+                char *k663____;
+                struct
+                {
+                        char *k664____;
+                        char *k665____;
+                        char *k666____;
+                        char *k667____;
+                        char *k668____;
+                        char *k669____;
+                        char *k670____;
+                        char *k671____;
+                } s55_____;
+        } s54_____;
+        char *k672____;
+        char *k673____;
+        char *k674____;
+        char *k675____;
+        char *k676____;
+        char *k677____;
+        char *k678____;
+        char *k679____;
+        struct
+        {
+                char *k680____;
+                char *k681____;
+                char *k682____;
+                char *k683____;
+                char *k684____;
+                char *k685____;
+                char *k686____;
+                char *k687____;
+                struct
+                {
+                        char *k688____;
+                        char *k689____;
+                        char *k690____;
+                        char *k691____;
+                        char *k692____;
+                        char *k693____;
+                        char *k694____;
+                        char *k695____;
+                } s57_____;
+        } s56_____;
+        char *k696____;
+        char *k697____;
+        char *k698____;
+        char *k699____;
+        char *k700____;
+        char *k701____;
+        char *k702____;
+        char *k703____;
+        struct
+        {
+                char *k704____;
+                char *k705____;
+                char *k706____;
+                char *k707____;
+                char *k708____;
+                char *k709____;
+                char *k710____;
+                char *k711____;
+                struct
+                {
+                        char *k712____;
+                        char *k713____;
+                        char *k714____;
+                        char *k715____;
+                        char *k716____;
+                        char *k717____;
+                        char *k718____;
+                        char *k719____;
+                } s59_____;
+        } s58_____;
+        char *k720____;
+        char *k721____;
+        char *k722____;
+        char *k723____;
+        char *k724____;
+        char *k725____;
+        char *k726____;
+        char *k727____;
+        struct
+        {
+                char *k728____;
+                char *k729____;
+                char *k730____;
+                char *k731____;
+                char *k732____;
+                char *k733____;
+                char *k734____;
+                char *k735____;
+                struct
+                {
+                        char *k736____;
+                        char *k737____;
+                        char *k738____;
+                        char *k739____;
+                        char *k740____;
+                        char *k741____;
+                        char *k742____;
+                        char *k743____;
+                } s61_____;
+        } s60_____;
+        char *k744____;
+        char *k745____;
+        char *k746____;
+        char *k747____;
+        char *k748____;
+        char *k749____;
+        char *k750____;
+        char *k751____;
+        struct
+        {
+                char *k752____;
+                char *k753____;
+                char *k754____;
+                char *k755____;
+                char *k756____;
+                char *k757____;
+                char *k758____;
+                char *k759____;
+                struct
+                {
+                        char *k760____;
+                        char *k761____;
+                        char *k762____;
+                        char *k763____;
+                        char *k764____;
+                        char *k765____;
+                        char *k766____;
+                        char *k767____;
+                } s63_____;
+        } s62_____;
+        char *k768____;
+        char *k769____;
+        char *k770____;
+        char *k771____;
+        char *k772____;
+        char *k773____;
+        char *k774____;
+        char *k775____;
+        struct
+        {
+                char *k776____;
+                char *k777____;
+                char *k778____;
+                char *k779____;
+                char *k780____;
+                char *k781____;
+                char *k782____;
+                char *k783____;
+                struct
+                {
+                        char *k784____;
+                        char *k785____;
+                        char *k786____;
+                        char *k787____;
+                        char *k788____;
+                        char *k789____;
+                        char *k790____;
+                        char *k791____;
+                } s65_____;
+        } s64_____;
+        char *k792____;
+        char *k793____;
+        char *k794____;
+        char *k795____;
+        char *k796____;
+        char *k797____;
+        char *k798____;
+        char *k799____;
+        struct
+        {
+                char *k800____;
+                char *k801____;
+                char *k802____;
+                char *k803____;
+                char *k804____;
+                char *k805____;
+                char *k806____;
+                char *k807____;
+                struct
+                {
+                        char *k808____;
+                        char *k809____;
+                        char *k810____;
+                        char *k811____;
+                        char *k812____;
+                        char *k813____;
+                        char *k814____;
+                        char *k815____;
+                } s67_____;
+        } s66_____;
+        char *k816____;
+        char *k817____;
+        char *k818____;
+        char *k819____;
+        char *k820____;
+        char *k821____;
+        char *k822____;
+        char *k823____;
+        struct
+        {
+                char *k824____;
+                char *k825____;
+                char *k826____;
+                char *k827____;
+                char *k828____;
+                char *k829____;
+                char *k830____;
+                char *k831____;
+                struct
+                {
+                        char *k832____;
+                        char *k833____;
+                        char *k834____;
+                        char *k835____;
+                        char *k836____;
+                        char *k837____;
+                        char *k838____;
+                        char *k839____;
+                } s69_____;
+        } s68_____;
+        char *k840____;
+        char *k841____;
+        char *k842____;
+        char *k843____;
+        char *k844____;
+        char *k845____;
+        char *k846____;
+        char *k847____;
+        struct
+        {
+                char *k848____;
+                char *k849____;
+                char *k850____;
+                char *k851____;
+                char *k852____;
+                char *k853____;
+                char *k854____;
+                char *k855____;
+                struct
+                {
+                        char *k856____;
+                        char *k857____;
+                        char *k858____;
+                        char *k859____;
+                        char *k860____;
+                        char *k861____;
+                        char *k862____;
+                        char *k863____;
+                } s71_____;
+        } s70_____;
+        char *k864____;
+        char *k865____;
+        char *k866____;
+        char *k867____;
+        char *k868____;
+        char *k869____;
+        char *k870____;
+        char *k871____;
+        struct
+        {
+                char *k872____;
+                char *k873____;
+                char *k874____;
+                char *k875____;
+                char *k876____;
+                char *k877____;
+                char *k878____;
+                char *k879____;
+                struct
+                {
+                        char *k880____;
+                        char *k881____;
+                        char *k882____;
+                        char *k883____;
+                        char *k884____;
+                        char *k885____;
+                        char *k886____;
+                        char *k887____;
+                } s73_____;
+        } s72_____;
+        char *k888____;
+        char *k889____;
+        char *k890____;
+        char *k891____;
+        char *k892____;
+        char *k893____;
+        char *k894____;
+        char *k895____;
+        struct
+        {
+                char *k896____;
+                char *k897____;
+                char *k898____;
+                char *k899____;
+                char *k900____;
+                char *k901____;
+                char *k902____;
+                char *k903____;
+                struct
+                {
+                        char *k904____;
+                        char *k905____;
+                        char *k906____;
+                        char *k907____;
+                        char *k908____;
+                        char *k909____;
+                        char *k910____;
+                        char *k911____;
+                } s75_____;
+        } s74_____;
+        char *k912____;
+        char *k913____;
+        char *k914____;
+        char *k915____;
+        char *k916____;
+        char *k917____;
+        char *k918____;
+        char *k919____;
+        struct
+        {
+                char *k920____;
+                char *k921____;
+                char *k922____;
+                char *k923____;
+                char *k924____;
+                char *k925____;
+                char *k926____;
+                char *k927____;
+                struct
+                {
+                        char *k928____;
+                        char *k929____;
+                        char *k930____;
+                        char *k931____;
+                        char *k932____;
+                        char *k933____;
+                        char *k934____;
+                        char *k935____;
+                } s77_____;
+        } s76_____;
+        char *k936____;
+        char *k937____;
+        char *k938____;
+        char *k939____;
+        char *k940____;
+        char *k941____;
+        char *k942____;
+        char *k943____;
+        struct
+        {
+                char *k944____;
+                char *k945____;
+                char *k946____;
+                char *k947____;
+                char *k948____;
+                char *k949____;
+                char *k950____;
+                char *k951____;
+                struct
+                {
+                        char *k952____;
+                        char *k953____;
+                        char *k954____;
+                        char *k955____;
+                        char *k956____;
+                        char *k957____;
+                        char *k958____;
+                        char *k959____;
+                } s79_____;
+        } s78_____;
+        char *k960____;
+        char *k961____;
+        char *k962____;
+        char *k963____;
+        char *k964____;
+        char *k965____;
+        char *k966____;
+        char *k967____;
+        struct
+        {
+                char *k968____;
+                char *k969____;
+                char *k970____;
+                char *k971____;
+                char *k972____;
+                char *k973____;
+                char *k974____;
+                char *k975____;
+                struct
+                {
+                        char *k976____;
+                        char *k977____;
+                        char *k978____;
+                        char *k979____;
+                        char *k980____;
+                        char *k981____;
+                        char *k982____;
+                        char *k983____;
+                } s81_____;
+        } s80_____;
+        char *k984____;
+        char *k985____;
+        char *k986____;
+        char *k987____;
+        char *k988____;
+        char *k989____;
+        char *k990____;
+        char *k991____;
+        struct
+        {
+                char *k992____;
+                char *k993____;
+                char *k994____;
+                char *k995____;
+                char *k996____;
+                char *k997____;
+                char *k998____;
+                char *k999____;
+        } s82_____;
+} bench;
+typedef enum bench_key
+{
+        BENCH_K0______,
+        BENCH_K1______,
+        BENCH_K2______,
+        BENCH_K3______,
+        BENCH_K4______,
+        BENCH_K5______,
+        BENCH_K6______,
+        BENCH_K7______,
+        BENCH_S0_______K8______,
+        BENCH_S0_______K9______,
+        BENCH_S0_______K10_____,
+        BENCH_S0_______K11_____,
+        BENCH_S0_______K12_____,
+        BENCH_S0_______K13_____,
+        BENCH_S0_______K14_____,
+        BENCH_S0_______K15_____,
+        BENCH_S0_______S1_______K16_____,
+        BENCH_S0_______S1_______K17_____,
+        BENCH_S0_______S1_______K18_____,
+        BENCH_S0_______S1_______K19_____,
+        BENCH_S0_______S1_______K20_____,
+        BENCH_S0_______S1_______K21_____,
+        BENCH_S0_______S1_______K22_____,
+        BENCH_S0_______S1_______K23_____,
+        BENCH_K24_____,
+        BENCH_K25_____,
+        BENCH_K26_____,
+        BENCH_K27_____,
+        BENCH_K28_____,
+        BENCH_K29_____,
+        BENCH_K30_____,
+        BENCH_K31_____,
+        BENCH_S2_______K32_____,
+        BENCH_S2_______K33_____,
+        BENCH_S2_______K34_____,
+        BENCH_S2_______K35_____,
+        BENCH_S2_______K36_____,
+        BENCH_S2_______K37_____,
+        BENCH_S2_______K38_____,
+        BENCH_S2_______K39_____,
+        BENCH_S2_______S3_______K40_____,
+        BENCH_S2_______S3_______K41_____,
+        BENCH_S2_______S3_______K42_____,
+        BENCH_S2_______S3_______K43_____,
+        BENCH_S2_______S3_______K44_____,
+        BENCH_S2_______S3_______K45_____,
+        BENCH_S2_______S3_______K46_____,
+        BENCH_S2_______S3_______K47_____,
+        BENCH_K48_____,
+        BENCH_K49_____,
+        BENCH_K50_____,
+        BENCH_K51_____,
+        BENCH_K52_____,
+        BENCH_K53_____,
+        BENCH_K54_____,
+        BENCH_K55_____,
+        BENCH_S4_______K56_____,
+        BENCH_S4_______K57_____,
+        BENCH_S4_______K58_____,
+        BENCH_S4_______K59_____,
+        BENCH_S4_______K60_____,
+        BENCH_S4_______K61_____,
+        BENCH_S4_______K62_____,
+        BENCH_S4_______K63_____,
+        BENCH_S4_______S5_______K64_____,
+        BENCH_S4_______S5_______K65_____,
+        BENCH_S4_______S5_______K66_____,
+        BENCH_S4_______S5_______K67_____,
+        BENCH_S4_______S5_______K68_____,
+        BENCH_S4_______S5_______K69_____,
+        BENCH_S4_______S5_______K70_____,
+        BENCH_S4_______S5_______K71_____,
+        BENCH_K72_____,
+        BENCH_K73_____,
+        BENCH_K74_____,
+        BENCH_K75_____,
+        BENCH_K76_____,
+        BENCH_K77_____,
+        BENCH_K78_____,
+        BENCH_K79_____,
+        BENCH_S6_______K80_____,
+        BENCH_S6_______K81_____,
+        BENCH_S6_______K82_____,
+        BENCH_S6_______K83_____,
+        BENCH_S6_______K84_____,
+        BENCH_S6_______K85_____,
+        BENCH_S6_______K86_____,
+        BENCH_S6_______K87_____,
+        BENCH_S6_______S7_______K88_____,
+        BENCH_S6_______S7_______K89_____,
+        BENCH_S6_______S7_______K90_____,
+        BENCH_S6_______S7_______K91_____,
+        BENCH_S6_______S7_______K92_____,
+        BENCH_S6_______S7_______K93_____,
+        BENCH_S6_______S7_______K94_____,
+        BENCH_S6_______S7_______K95_____,
+        BENCH_K96_____,
+        BENCH_K97_____,
+        BENCH_K98_____,
+        BENCH_K99_____,
+        BENCH_K100____,
+        BENCH_K101____,
+        BENCH_K102____,
+        BENCH_K103____,
+        BENCH_S8_______K104____,
+        BENCH_S8_______K105____,
+        BENCH_S8_______K106____,
+        BENCH_S8_______K107____,
+        BENCH_S8_______K108____,
+        BENCH_S8_______K109____,
+        BENCH_S8_______K110____,
+        BENCH_S8_______K111____,
+        BENCH_S8_______S9_______K112____,
+        BENCH_S8_______S9_______K113____,
+        BENCH_S8_______S9_______K114____,
+        BENCH_S8_______S9_______K115____,
+        BENCH_S8_______S9_______K116____,
+        BENCH_S8_______S9_______K117____,
+        BENCH_S8_______S9_______K118____,
+        BENCH_S8_______S9_______K119____,
+        BENCH_K120____,
+        BENCH_K121____,
+        BENCH_K122____,
+        BENCH_K123____,
+        BENCH_K124____,
+        BENCH_K125____,
+        BENCH_K126____,
+        BENCH_K127____,
+        BENCH_S10______K128____,
+        BENCH_S10______K129____,
+        BENCH_S10______K130____,
+        BENCH_S10______K131____,
+        BENCH_S10______K132____,
+        BENCH_S10______K133____,
+        BENCH_S10______K134____,
+        BENCH_S10______K135____,
+        BENCH_S10______S11______K136____,
+        BENCH_S10______S11______K137____,
+        BENCH_S10______S11______K138____,
+        BENCH_S10______S11______K139____,
+        BENCH_S10______S11______K140____,
+        BENCH_S10______S11______K141____,
+        BENCH_S10______S11______K142____,
+        BENCH_S10______S11______K143____,
+        BENCH_K144____,
+        BENCH_K145____,
+        BENCH_K146____,
+        BENCH_K147____,
+        BENCH_K148____,
+        BENCH_K149____,
+        BENCH_K150____,
+        BENCH_K151____,
+        BENCH_S12______K152____,
+        BENCH_S12______K153____,
+        BENCH_S12______K154____,
+        BENCH_S12______K155____,
+        BENCH_S12______K156____,
+        BENCH_S12______K157____,
+        BENCH_S12______K158____,
+        BENCH_S12______K159____,
+        BENCH_S12______S13______K160____,
+        BENCH_S12______S13______K161____,
+        BENCH_S12______S13______K162____,
+        BENCH_S12______S13______K163____,
+        BENCH_S12______S13______K164____,
+        BENCH_S12______S13______K165____,
+        BENCH_S12______S13______K166____,
+        BENCH_S12______S13______K167____,
+        BENCH_K168____,
+        BENCH_K169____,
+        BENCH_K170____,
+        BENCH_K171____,
+        BENCH_K172____,
+        BENCH_K173____,
+        BENCH_K174____,
+        BENCH_K175____,
+        BENCH_S14______K176____,
+        BENCH_S14______K177____,
+        BENCH_S14______K178____,
+        BENCH_S14______K179____,
+        BENCH_S14______K180____,
+        BENCH_S14______K181____,
+        BENCH_S14______K182____,
+        BENCH_S14______K183____,
+        BENCH_S14______S15______K184____,
+        BENCH_S14______S15______K185____,
+        BENCH_S14______S15______K186____,
+        BENCH_S14______S15______K187____,
+        BENCH_S14______S15______K188____,
+        BENCH_S14______S15______K189____,
+        BENCH_S14______S15______K190____,
+        BENCH_S14______S15______K191____,
+        BENCH_K192____,
+        BENCH_K193____,
+        BENCH_K194____,
+        BENCH_K195____,
+        BENCH_K196____,
+        BENCH_K197____,
+        BENCH_K198____,
+        BENCH_K199____,
+        BENCH_S16______K200____,
+        BENCH_S16______K201____,
+        BENCH_S16______K202____,
+        BENCH_S16______K203____,
+        BENCH_S16______K204____,
+        BENCH_S16______K205____,
+        BENCH_S16______K206____,
+        BENCH_S16______K207____,
+        BENCH_S16______S17______K208____,
+        BENCH_S16______S17______K209____,
+        BENCH_S16______S17______K210____,
+        BENCH_S16______S17______K211____,
+        BENCH_S16______S17______K212____,
+        BENCH_S16______S17______K213____,
+        BENCH_S16______S17______K214____,
+        BENCH_S16______S17______K215____,
+        BENCH_K216____,
+        BENCH_K217____,
+        BENCH_K218____,
+        BENCH_K219____,
+        BENCH_K220____,
+        BENCH_K221____,
+        BENCH_K222____,
+        BENCH_K223____,
+        BENCH_S18______K224____,
+        BENCH_S18______K225____,
+        BENCH_S18______K226____,
+        BENCH_S18______K227____,
+        BENCH_S18______K228____,
+        BENCH_S18______K229____,
+        BENCH_S18______K230____,
+        BENCH_S18______K231____,
+        BENCH_S18______S19______K232____,
+        BENCH_S18______S19______K233____,
+        BENCH_S18______S19______K234____,
+        BENCH_S18______S19______K235____,
+        BENCH_S18______S19______K236____,
+        BENCH_S18______S19______K237____,
+        BENCH_S18______S19______K238____,
+        BENCH_S18______S19______K239____,
+        BENCH_K240____,
+        BENCH_K241____,
+        BENCH_K242____,
+        BENCH_K243____,
+        BENCH_K244____,
+        BENCH_K245____,
+        BENCH_K246____,
+        BENCH_K247____,
+        BENCH_S20______K248____,
+        BENCH_S20______K249____,
+        BENCH_S20______K250____,
+        BENCH_S20______K251____,
+        BENCH_S20______K252____,
+        BENCH_S20______K253____,
+        BENCH_S20______K254____,
+        BENCH_S20______K255____,
+        BENCH_S20______S21______K256____,
+        BENCH_S20______S21______K257____,
+        BENCH_S20______S21______K258____,
+        BENCH_S20______S21______K259____,
+        BENCH_S20______S21______K260____,
+        BENCH_S20______S21______K261____,
+        BENCH_S20______S21______K262____,
+        BENCH_S20______S21______K263____,
+        BENCH_K264____,
+        BENCH_K265____,
+        BENCH_K266____,
+        BENCH_K267____,
+        BENCH_K268____,
+        BENCH_K269____,
+        BENCH_K270____,
+        BENCH_K271____,
+        BENCH_S22______K272____,
+        BENCH_S22______K273____,
+        BENCH_S22______K274____,
+        BENCH_S22______K275____,
+        BENCH_S22______K276____,
+        BENCH_S22______K277____,
+        BENCH_S22______K278____,
+        BENCH_S22______K279____,
+        BENCH_S22______S23______K280____,
+        BENCH_S22______S23______K281____,
+        BENCH_S22______S23______K282____,
+        BENCH_S22______S23______K283____,
+        BENCH_S22______S23______K284____,
+        BENCH_S22______S23______K285____,
+        BENCH_S22______S23______K286____,
+        BENCH_S22______S23______K287____,
+        BENCH_K288____,
+        BENCH_K289____,
+        BENCH_K290____,
+        BENCH_K291____,
+        BENCH_K292____,
+        BENCH_K293____,
+        BENCH_K294____,
+        BENCH_K295____,
+        BENCH_S24______K296____,
+        BENCH_S24______K297____,
+        BENCH_S24______K298____,
+        BENCH_S24______K299____,
+        BENCH_S24______K300____,
+        BENCH_S24______K301____,
+        BENCH_S24______K302____,
+        BENCH_S24______K303____,
+        BENCH_S24______S25______K304____,
+        BENCH_S24______S25______K305____,
+        BENCH_S24______S25______K306____,
+        BENCH_S24______S25______K307____,
+        BENCH_S24______S25______K308____,
+        BENCH_S24______S25______K309____,
+        BENCH_S24______S25______K310____,
+        BENCH_S24______S25______K311____,
+        BENCH_K312____,
+        BENCH_K313____,
+        BENCH_K314____,
+        BENCH_K315____,
+        BENCH_K316____,
+        BENCH_K317____,
+        BENCH_K318____,
+        BENCH_K319____,
+        BENCH_S26______K320____,
+        BENCH_S26______K321____,
+        BENCH_S26______K322____,
+        BENCH_S26______K323____,
+        BENCH_S26______K324____,
+        BENCH_S26______K325____,
+        BENCH_S26______K326____,
+        BENCH_S26______K327____,
+        BENCH_S26______S27______K328____,
+        BENCH_S26______S27______K329____,
+        BENCH_S26______S27______K330____,
+        BENCH_S26______S27______K331____,
+        BENCH_S26______S27______K332____,
+        BENCH_S26______S27______K333____,
+        BENCH_S26______S27______K334____,
+        BENCH_S26______S27______K335____,
+        BENCH_K336____,
+        BENCH_K337____,
+        BENCH_K338____,
+        BENCH_K339____,
+        BENCH_K340____,
+        BENCH_K341____,
+        BENCH_K342____,
+        BENCH_K343____,
+        BENCH_S28______K344____,
+        BENCH_S28______K345____,
+        BENCH_S28______K346____,
+        BENCH_S28______K347____,
+        BENCH_S28______K348____,
+        BENCH_S28______K349____,
+        BENCH_S28______K350____,
+        BENCH_S28______K351____,
+        BENCH_S28______S29______K352____,
+        BENCH_S28______S29______K353____,
+        BENCH_S28______S29______K354____,
+        BENCH_S28______S29______K355____,
+        BENCH_S28______S29______K356____,
+        BENCH_S28______S29______K357____,
+        BENCH_S28______S29______K358____,
+        BENCH_S28______S29______K359____,
+        BENCH_K360____,
+        BENCH_K361____,
+        BENCH_K362____,
+        BENCH_K363____,
+        BENCH_K364____,
+        BENCH_K365____,
+        BENCH_K366____,
+        BENCH_K367____,
+        BENCH_S30______K368____,
+        BENCH_S30______K369____,
+        BENCH_S30______K370____,
+        BENCH_S30______K371____,
+        BENCH_S30______K372____,
+        BENCH_S30______K373____,
+        BENCH_S30______K374____,
+        BENCH_S30______K375____,
+        BENCH_S30______S31______K376____,
+        BENCH_S30______S31______K377____,
+        BENCH_S30______S31______K378____,
+        BENCH_S30______S31______K379____,
+        BENCH_S30______S31______K380____,
+        BENCH_S30______S31______K381____,
+        BENCH_S30______S31______K382____,
+        BENCH_S30______S31______K383____,
+        BENCH_K384____,
+        BENCH_K385____,
+        BENCH_K386____,
+        BENCH_K387____,
+        BENCH_K388____,
+        BENCH_K389____,
+        BENCH_K390____,
+        BENCH_K391____,
+        BENCH_S32______K392____,
+        BENCH_S32______K393____,
+        BENCH_S32______K394____,
+        BENCH_S32______K395____,
+        BENCH_S32______K396____,
+        BENCH_S32______K397____,
+        BENCH_S32______K398____,
+        BENCH_S32______K399____,
+        BENCH_S32______S33______K400____,
+        BENCH_S32______S33______K401____,
+        BENCH_S32______S33______K402____,
+        BENCH_S32______S33______K403____,
+        BENCH_S32______S33______K404____,
+        BENCH_S32______S33______K405____,
+        BENCH_S32______S33______K406____,
+        BENCH_S32______S33______K407____,
+        BENCH_K408____,
+        BENCH_K409____,
+        BENCH_K410____,
+        BENCH_K411____,
+        BENCH_K412____,
+        BENCH_K413____,
+        BENCH_K414____,
+        BENCH_K415____,
+        BENCH_S34______K416____,
+        BENCH_S34______K417____,
+        BENCH_S34______K418____,
+        BENCH_S34______K419____,
+        BENCH_S34______K420____,
+        BENCH_S34______K421____,
+        BENCH_S34______K422____,
+        BENCH_S34______K423____,
+        BENCH_S34______S35______K424____,
+        BENCH_S34______S35______K425____,
+        BENCH_S34______S35______K426____,
+        BENCH_S34______S35______K427____,
+        BENCH_S34______S35______K428____,
+        BENCH_S34______S35______K429____,
+        BENCH_S34______S35______K430____,
+        BENCH_S34______S35______K431____,
+        BENCH_K432____,
+        BENCH_K433____,
+        BENCH_K434____,
+        BENCH_K435____,
+        BENCH_K436____,
+        BENCH_K437____,
+        BENCH_K438____,
+        BENCH_K439____,
+        BENCH_S36______K440____,
+        BENCH_S36______K441____,
+        BENCH_S36______K442____,
+        BENCH_S36______K443____,
+        BENCH_S36______K444____,
+        BENCH_S36______K445____,
+        BENCH_S36______K446____,
+        BENCH_S36______K447____,
+        BENCH_S36______S37______K448____,
+        BENCH_S36______S37______K449____,
+        BENCH_S36______S37______K450____,
+        BENCH_S36______S37______K451____,
+        BENCH_S36______S37______K452____,
+        BENCH_S36______S37______K453____,
+        BENCH_S36______S37______K454____,
+        BENCH_S36______S37______K455____,
+        BENCH_K456____,
+        BENCH_K457____,
+        BENCH_K458____,
+        BENCH_K459____,
+        BENCH_K460____,
+        BENCH_K461____,
+        BENCH_K462____,
+        BENCH_K463____,
+        BENCH_S38______K464____,
+        BENCH_S38______K465____,
+        BENCH_S38______K466____,
+        BENCH_S38______K467____,
+        BENCH_S38______K468____,
+        BENCH_S38______K469____,
+        BENCH_S38______K470____,
+        BENCH_S38______K471____,
+        BENCH_S38______S39______K472____,
+        BENCH_S38______S39______K473____,
+        BENCH_S38______S39______K474____,
+        BENCH_S38______S39______K475____,
+        BENCH_S38______S39______K476____,
+        BENCH_S38______S39______K477____,
+        BENCH_S38______S39______K478____,
+        BENCH_S38______S39______K479____,
+        BENCH_K480____,
+        BENCH_K481____,
+        BENCH_K482____,
+        BENCH_K483____,
+        BENCH_K484____,
+        BENCH_K485____,
+        BENCH_K486____,
+        BENCH_K487____,
+        BENCH_S40______K488____,
+        BENCH_S40______K489____,
+        BENCH_S40______K490____,
+        BENCH_S40______K491____,
+        BENCH_S40______K492____,
+        BENCH_S40______K493____,
+        BENCH_S40______K494____,
+        BENCH_S40______K495____,
+        BENCH_S40______S41______K496____,
+        BENCH_S40______S41______K497____,
+        BENCH_S40______S41______K498____,
+        BENCH_S40______S41______K499____,
+        BENCH_S40______S41______K500____,
+        BENCH_S40______S41______K501____,
+        BENCH_S40______S41______K502____,
+        BENCH_S40______S41______K503____,
+        BENCH_K504____,
+        BENCH_K505____,
+        BENCH_K506____,
+        BENCH_K507____,
+        BENCH_K508____,
+        BENCH_K509____,
+        BENCH_K510____,
+        BENCH_K511____,
+        BENCH_S42______K512____,
+        BENCH_S42______K513____,
+        BENCH_S42______K514____,
+        BENCH_S42______K515____,
+        BENCH_S42______K516____,
+        BENCH_S42______K517____,
+        BENCH_S42______K518____,
+        BENCH_S42______K519____,
+        BENCH_S42______S43______K520____,
+        BENCH_S42______S43______K521____,
+        BENCH_S42______S43______K522____,
+        BENCH_S42______S43______K523____,
+        BENCH_S42______S43______K524____,
+        BENCH_S42______S43______K525____,
+        BENCH_S42______S43______K526____,
+        BENCH_S42______S43______K527____,
+        BENCH_K528____,
+        BENCH_K529____,
+        BENCH_K530____,
+        BENCH_K531____,
+        BENCH_K532____,
+        BENCH_K533____,
+        BENCH_K534____,
+        BENCH_K535____,
+        BENCH_S44______K536____,
+        BENCH_S44______K537____,
+        BENCH_S44______K538____,
+        BENCH_S44______K539____,
+        BENCH_S44______K540____,
+        BENCH_S44______K541____,
+        BENCH_S44______K542____,
+        BENCH_S44______K543____,
+        BENCH_S44______S45______K544____,
+        BENCH_S44______S45______K545____,
+        BENCH_S44______S45______K546____,
+        BENCH_S44______S45______K547____,
+        BENCH_S44______S45______K548____,
+        BENCH_S44______S45______K549____,
+        BENCH_S44______S45______K550____,
+        BENCH_S44______S45______K551____,
+        BENCH_K552____,
+        BENCH_K553____,
+        BENCH_K554____,
+        BENCH_K555____,
+        BENCH_K556____,
+        BENCH_K557____,
+        BENCH_K558____,
+        BENCH_K559____,
+        BENCH_S46______K560____,
+        BENCH_S46______K561____,
+        BENCH_S46______K562____,
+        BENCH_S46______K563____,
+        BENCH_S46______K564____,
+        BENCH_S46______K565____,
+        BENCH_S46______K566____,
+        BENCH_S46______K567____,
+        BENCH_S46______S47______K568____,
+        BENCH_S46______S47______K569____,
+        BENCH_S46______S47______K570____,
+        BENCH_S46______S47______K571____,
+        BENCH_S46______S47______K572____,
+        BENCH_S46______S47______K573____,
+        BENCH_S46______S47______K574____,
+        BENCH_S46______S47______K575____,
+        BENCH_K576____,
+        BENCH_K577____,
+        BENCH_K578____,
+        BENCH_K579____,
+        BENCH_K580____,
+        BENCH_K581____,
+        BENCH_K582____,
+        BENCH_K583____,
+        BENCH_S48______K584____,
+        BENCH_S48______K585____,
+        BENCH_S48______K586____,
+        BENCH_S48______K587____,
+        BENCH_S48______K588____,
+        BENCH_S48______K589____,
+        BENCH_S48______K590____,
+        BENCH_S48______K591____,
+        BENCH_S48______S49______K592____,
+        BENCH_S48______S49______K593____,
+        BENCH_S48______S49______K594____,
+        BENCH_S48______S49______K595____,
+        BENCH_S48______S49______K596____,
+        BENCH_S48______S49______K597____,
+        BENCH_S48______S49______K598____,
+        BENCH_S48______S49______K599____,
+        BENCH_K600____,
+        BENCH_K601____,
+        BENCH_K602____,
+        BENCH_K603____,
+        BENCH_K604____,
+        BENCH_K605____,
+        BENCH_K606____,
+        BENCH_K607____,
+        BENCH_S50______K608____,
+        BENCH_S50______K609____,
+        BENCH_S50______K610____,
+        BENCH_S50______K611____,
+        BENCH_S50______K612____,
+        BENCH_S50______K613____,
+        BENCH_S50______K614____,
+        BENCH_S50______K615____,
+        BENCH_S50______S51______K616____,
+        BENCH_S50______S51______K617____,
+        BENCH_S50______S51______K618____,
+        BENCH_S50______S51______K619____,
+        BENCH_S50______S51______K620____,
+        BENCH_S50______S51______K621____,
+        BENCH_S50______S51______K622____,
+        BENCH_S50______S51______K623____,
+        BENCH_K624____,
+        BENCH_K625____,
+        BENCH_K626____,
+        BENCH_K627____,
+        BENCH_K628____,
+        BENCH_K629____,
+        BENCH_K630____,
+        BENCH_K631____,
+        BENCH_S52______K632____,
+        BENCH_S52______K633____,
+        BENCH_S52______K634____,
+        BENCH_S52______K635____,
+        BENCH_S52______K636____,
+        BENCH_S52______K637____,
+        BENCH_S52______K638____,
+        BENCH_S52______K639____,
+        BENCH_S52______S53______K640____,
+        BENCH_S52______S53______K641____,
+        BENCH_S52______S53______K642____,
+        BENCH_S52______S53______K643____,
+        BENCH_S52______S53______K644____,
+        BENCH_S52______S53______K645____,
+        BENCH_S52______S53______K646____,
+        BENCH_S52______S53______K647____,
+        BENCH_K648____,
+        BENCH_K649____,
+        BENCH_K650____,
+        BENCH_K651____,
+        BENCH_K652____,
+        BENCH_K653____,
+        BENCH_K654____,
+        BENCH_K655____,
+        BENCH_S54______K656____,
+        BENCH_S54______K657____,
+        BENCH_S54______K658____,
+        BENCH_S54______K659____,
+        BENCH_S54______K660____,
+        BENCH_S54______K661____,
+        BENCH_S54______K662____,
+        BENCH_S54______K663____,
+        BENCH_S54______S55______K664____,
+        BENCH_S54______S55______K665____,
+        BENCH_S54______S55______K666____,
+        BENCH_S54______S55______K667____,
+        BENCH_S54______S55______K668____,
+        BENCH_S54______S55______K669____,
+        BENCH_S54______S55______K670____,
+        BENCH_S54______S55______K671____,
+        BENCH_K672____,
+        BENCH_K673____,
+        BENCH_K674____,
+        BENCH_K675____,
+        BENCH_K676____,
+        BENCH_K677____,
+        BENCH_K678____,
+        BENCH_K679____,
+        BENCH_S56______K680____,
+        BENCH_S56______K681____,
+        BENCH_S56______K682____,
+        BENCH_S56______K683____,
+        BENCH_S56______K684____,
+        BENCH_S56______K685____,
+        BENCH_S56______K686____,
+        BENCH_S56______K687____,
+        BENCH_S56______S57______K688____,
+        BENCH_S56______S57______K689____,
+        BENCH_S56______S57______K690____,
+        BENCH_S56______S57______K691____,
+        BENCH_S56______S57______K692____,
+        BENCH_S56______S57______K693____,
+        BENCH_S56______S57______K694____,
+        BENCH_S56______S57______K695____,
+        BENCH_K696____,
+        BENCH_K697____,
+        BENCH_K698____,
+        BENCH_K699____,
+        BENCH_K700____,
+        BENCH_K701____,
+        BENCH_K702____,
+        BENCH_K703____,
+        BENCH_S58______K704____,
+        BENCH_S58______K705____,
+        BENCH_S58______K706____,
+        BENCH_S58______K707____,
+        BENCH_S58______K708____,
+        BENCH_S58______K709____,
+        BENCH_S58______K710____,
+        BENCH_S58______K711____,
+        BENCH_S58______S59______K712____,
+        BENCH_S58______S59______K713____,
+        BENCH_S58______S59______K714____,
+        BENCH_S58______S59______K715____,
+        BENCH_S58______S59______K716____,
+        BENCH_S58______S59______K717____,
+        BENCH_S58______S59______K718____,
+        BENCH_S58______S59______K719____,
+        BENCH_K720____,
+        BENCH_K721____,
+        BENCH_K722____,
+        BENCH_K723____,
+        BENCH_K724____,
+        BENCH_K725____,
+        BENCH_K726____,
+        BENCH_K727____,
+        BENCH_S60______K728____,
+        BENCH_S60______K729____,
+        BENCH_S60______K730____,
+        BENCH_S60______K731____,
+        BENCH_S60______K732____,
+        BENCH_S60______K733____,
+        BENCH_S60______K734____,
+        BENCH_S60______K735____,
+        BENCH_S60______S61______K736____,
+        BENCH_S60______S61______K737____,
+        BENCH_S60______S61______K738____,
+        BENCH_S60______S61______K739____,
+        BENCH_S60______S61______K740____,
+        BENCH_S60______S61______K741____,
+        BENCH_S60______S61______K742____,
+        BENCH_S60______S61______K743____,
+        BENCH_K744____,
+        BENCH_K745____,
+        BENCH_K746____,
+        BENCH_K747____,
+        BENCH_K748____,
+        BENCH_K749____,
+        BENCH_K750____,
+        BENCH_K751____,
+        BENCH_S62______K752____,
+        BENCH_S62______K753____,
+        BENCH_S62______K754____,
+        BENCH_S62______K755____,
+        BENCH_S62______K756____,
+        BENCH_S62______K757____,
+        BENCH_S62______K758____,
+        BENCH_S62______K759____,
+        BENCH_S62______S63______K760____,
+        BENCH_S62______S63______K761____,
+        BENCH_S62______S63______K762____,
+        BENCH_S62______S63______K763____,
+        BENCH_S62______S63______K764____,
+        BENCH_S62______S63______K765____,
+        BENCH_S62______S63______K766____,
+        BENCH_S62______S63______K767____,
+        BENCH_K768____,
+        BENCH_K769____,
+        BENCH_K770____,
+        BENCH_K771____,
+        BENCH_K772____,
+        BENCH_K773____,
+        BENCH_K774____,
+        BENCH_K775____,
+        BENCH_S64______K776____,
+        BENCH_S64______K777____,
+        BENCH_S64______K778____,
+        BENCH_S64______K779____,
+        BENCH_S64______K780____,
+        BENCH_S64______K781____,
+        BENCH_S64______K782____,
+        BENCH_S64______K783____,
+        BENCH_S64______S65______K784____,
+        BENCH_S64______S65______K785____,
+        BENCH_S64______S65______K786____,
+        BENCH_S64______S65______K787____,
+        BENCH_S64______S65______K788____,
+        BENCH_S64______S65______K789____,
+        BENCH_S64______S65______K790____,
+        BENCH_S64______S65______K791____,
+        BENCH_K792____,
+        BENCH_K793____,
+        BENCH_K794____,
+        BENCH_K795____,
+        BENCH_K796____,
+        BENCH_K797____,
+        BENCH_K798____,
+        BENCH_K799____,
+        BENCH_S66______K800____,
+        BENCH_S66______K801____,
+        BENCH_S66______K802____,
+        BENCH_S66______K803____,
+        BENCH_S66______K804____,
+        BENCH_S66______K805____,
+        BENCH_S66______K806____,
+        BENCH_S66______K807____,
+        BENCH_S66______S67______K808____,
+        BENCH_S66______S67______K809____,
+        BENCH_S66______S67______K810____,
+        BENCH_S66______S67______K811____,
+        BENCH_S66______S67______K812____,
+        BENCH_S66______S67______K813____,
+        BENCH_S66______S67______K814____,
+        BENCH_S66______S67______K815____,
+        BENCH_K816____,
+        BENCH_K817____,
+        BENCH_K818____,
+        BENCH_K819____,
+        BENCH_K820____,
+        BENCH_K821____,
+        BENCH_K822____,
+        BENCH_K823____,
+        BENCH_S68______K824____,
+        BENCH_S68______K825____,
+        BENCH_S68______K826____,
+        BENCH_S68______K827____,
+        BENCH_S68______K828____,
+        BENCH_S68______K829____,
+        BENCH_S68______K830____,
+        BENCH_S68______K831____,
+        BENCH_S68______S69______K832____,
+        BENCH_S68______S69______K833____,
+        BENCH_S68______S69______K834____,
+        BENCH_S68______S69______K835____,
+        BENCH_S68______S69______K836____,
+        BENCH_S68______S69______K837____,
+        BENCH_S68______S69______K838____,
+        BENCH_S68______S69______K839____,
+        BENCH_K840____,
+        BENCH_K841____,
+        BENCH_K842____,
+        BENCH_K843____,
+        BENCH_K844____,
+        BENCH_K845____,
+        BENCH_K846____,
+        BENCH_K847____,
+        BENCH_S70______K848____,
+        BENCH_S70______K849____,
+        BENCH_S70______K850____,
+        BENCH_S70______K851____,
+        BENCH_S70______K852____,
+        BENCH_S70______K853____,
+        BENCH_S70______K854____,
+        BENCH_S70______K855____,
+        BENCH_S70______S71______K856____,
+        BENCH_S70______S71______K857____,
+        BENCH_S70______S71______K858____,
+        BENCH_S70______S71______K859____,
+        BENCH_S70______S71______K860____,
+        BENCH_S70______S71______K861____,
+        BENCH_S70______S71______K862____,
+        BENCH_S70______S71______K863____,
+        BENCH_K864____,
+        BENCH_K865____,
+        BENCH_K866____,
+        BENCH_K867____,
+        BENCH_K868____,
+        BENCH_K869____,
+        BENCH_K870____,
+        BENCH_K871____,
+        BENCH_S72______K872____,
+        BENCH_S72______K873____,
+        BENCH_S72______K874____,
+        BENCH_S72______K875____,
+        BENCH_S72______K876____,
+        BENCH_S72______K877____,
+        BENCH_S72______K878____,
+        BENCH_S72______K879____,
+        BENCH_S72______S73______K880____,
+        BENCH_S72______S73______K881____,
+        BENCH_S72______S73______K882____,
+        BENCH_S72______S73______K883____,
+        BENCH_S72______S73______K884____,
+        BENCH_S72______S73______K885____,
+        BENCH_S72______S73______K886____,
+        BENCH_S72______S73______K887____,
+        BENCH_K888____,
+        BENCH_K889____,
+        BENCH_K890____,
+        BENCH_K891____,
+        BENCH_K892____,
+        BENCH_K893____,
+        BENCH_K894____,
+        BENCH_K895____,
+        BENCH_S74______K896____,
+        BENCH_S74______K897____,
+        BENCH_S74______K898____,
+        BENCH_S74______K899____,
+        BENCH_S74______K900____,
+        BENCH_S74______K901____,
+        BENCH_S74______K902____,
+        BENCH_S74______K903____,
+        BENCH_S74______S75______K904____,
+        BENCH_S74______S75______K905____,
+        BENCH_S74______S75______K906____,
+        BENCH_S74______S75______K907____,
+        BENCH_S74______S75______K908____,
+        BENCH_S74______S75______K909____,
+        BENCH_S74______S75______K910____,
+        BENCH_S74______S75______K911____,
+        BENCH_K912____,
+        BENCH_K913____,
+        BENCH_K914____,
+        BENCH_K915____,
+        BENCH_K916____,
+        BENCH_K917____,
+        BENCH_K918____,
+        BENCH_K919____,
+        BENCH_S76______K920____,
+        BENCH_S76______K921____,
+        BENCH_S76______K922____,
+        BENCH_S76______K923____,
+        BENCH_S76______K924____,
+        BENCH_S76______K925____,
+        BENCH_S76______K926____,
+        BENCH_S76______K927____,
+        BENCH_S76______S77______K928____,
+        BENCH_S76______S77______K929____,
+        BENCH_S76______S77______K930____,
+        BENCH_S76______S77______K931____,
+        BENCH_S76______S77______K932____,
+        BENCH_S76______S77______K933____,
+        BENCH_S76______S77______K934____,
+        BENCH_S76______S77______K935____,
+        BENCH_K936____,
+        BENCH_K937____,
+        BENCH_K938____,
+        BENCH_K939____,
+        BENCH_K940____,
+        BENCH_K941____,
+        BENCH_K942____,
+        BENCH_K943____,
+        BENCH_S78______K944____,
+        BENCH_S78______K945____,
+        BENCH_S78______K946____,
+        BENCH_S78______K947____,
+        BENCH_S78______K948____,
+        BENCH_S78______K949____,
+        BENCH_S78______K950____,
+        BENCH_S78______K951____,
+        BENCH_S78______S79______K952____,
+        BENCH_S78______S79______K953____,
+        BENCH_S78______S79______K954____,
+        BENCH_S78______S79______K955____,
+        BENCH_S78______S79______K956____,
+        BENCH_S78______S79______K957____,
+        BENCH_S78______S79______K958____,
+        BENCH_S78______S79______K959____,
+        BENCH_K960____,
+        BENCH_K961____,
+        BENCH_K962____,
+        BENCH_K963____,
+        BENCH_K964____,
+        BENCH_K965____,
+        BENCH_K966____,
+        BENCH_K967____,
+        BENCH_S80______K968____,
+        BENCH_S80______K969____,
+        BENCH_S80______K970____,
+        BENCH_S80______K971____,
+        BENCH_S80______K972____,
+        BENCH_S80______K973____,
+        BENCH_S80______K974____,
+        BENCH_S80______K975____,
+        BENCH_S80______S81______K976____,
+        BENCH_S80______S81______K977____,
+        BENCH_S80______S81______K978____,
+        BENCH_S80______S81______K979____,
+        BENCH_S80______S81______K980____,
+        BENCH_S80______S81______K981____,
+        BENCH_S80______S81______K982____,
+        BENCH_S80______S81______K983____,
+        BENCH_K984____,
+        BENCH_K985____,
+        BENCH_K986____,
+        BENCH_K987____,
+        BENCH_K988____,
+        BENCH_K989____,
+        BENCH_K990____,
+        BENCH_K991____,
+        BENCH_S82______K992____,
+        BENCH_S82______K993____,
+        BENCH_S82______K994____,
+        BENCH_S82______K995____,
+        BENCH_S82______K996____,
+        BENCH_S82______K997____,
+        BENCH_S82______K998____,
+        BENCH_S82______K999____,
+        BENCH_KEY_COUNT
+} bench_key;
+static const size_t benchoffsets[BENCH_KEY_COUNT] =
+{
+        offsetof(bench, k0______),
+        offsetof(bench, k1______),
+        offsetof(bench, k2______),
+        offsetof(bench, k3______),
+        offsetof(bench, k4______),
+        offsetof(bench, k5______),
+        offsetof(bench, k6______),
+        offsetof(bench, k7______),
+        offsetof(bench, s0______.k8______),
+        offsetof(bench, s0______.k9______),
+        offsetof(bench, s0______.k10_____),
+        offsetof(bench, s0______.k11_____),
+        offsetof(bench, s0______.k12_____),
+        offsetof(bench, s0______.k13_____),
+        offsetof(bench, s0______.k14_____),
+        offsetof(bench, s0______.k15_____),
+        offsetof(bench, s0______.s1______.k16_____),
+        offsetof(bench, s0______.s1______.k17_____),
+        offsetof(bench, s0______.s1______.k18_____),
+        offsetof(bench, s0______.s1______.k19_____),
+        offsetof(bench, s0______.s1______.k20_____),
+        offsetof(bench, s0______.s1______.k21_____),
+        offsetof(bench, s0______.s1______.k22_____),
+        offsetof(bench, s0______.s1______.k23_____),
+        offsetof(bench, k24_____),
+        offsetof(bench, k25_____),
+        offsetof(bench, k26_____),
+        offsetof(bench, k27_____),
+        offsetof(bench, k28_____),
+        offsetof(bench, k29_____),
+        offsetof(bench, k30_____),
+        offsetof(bench, k31_____),
+        offsetof(bench, s2______.k32_____),
+        offsetof(bench, s2______.k33_____),
+        offsetof(bench, s2______.k34_____),
+        offsetof(bench, s2______.k35_____),
+        offsetof(bench, s2______.k36_____),
+        offsetof(bench, s2______.k37_____),
+        offsetof(bench, s2______.k38_____),
+        offsetof(bench, s2______.k39_____),
+        offsetof(bench, s2______.s3______.k40_____),
+        offsetof(bench, s2______.s3______.k41_____),
+        offsetof(bench, s2______.s3______.k42_____),
+        offsetof(bench, s2______.s3______.k43_____),
+        offsetof(bench, s2______.s3______.k44_____),
+        offsetof(bench, s2______.s3______.k45_____),
+        offsetof(bench, s2______.s3______.k46_____),
+        offsetof(bench, s2______.s3______.k47_____),
+        offsetof(bench, k48_____),
+        offsetof(bench, k49_____),
+        offsetof(bench, k50_____),
+        offsetof(bench, k51_____),
+        offsetof(bench, k52_____),
+        offsetof(bench, k53_____),
+        offsetof(bench, k54_____),
+        offsetof(bench, k55_____),
+        offsetof(bench, s4______.k56_____),
+        offsetof(bench, s4______.k57_____),
+        offsetof(bench, s4______.k58_____),
+        offsetof(bench, s4______.k59_____),
+        offsetof(bench, s4______.k60_____),
+        offsetof(bench, s4______.k61_____),
+        offsetof(bench, s4______.k62_____),
+        offsetof(bench, s4______.k63_____),
+        offsetof(bench, s4______.s5______.k64_____),
+        offsetof(bench, s4______.s5______.k65_____),
+        offsetof(bench, s4______.s5______.k66_____),
+        offsetof(bench, s4______.s5______.k67_____),
+        offsetof(bench, s4______.s5______.k68_____),
+        offsetof(bench, s4______.s5______.k69_____),
+        offsetof(bench, s4______.s5______.k70_____),
+        offsetof(bench, s4______.s5______.k71_____),
+        offsetof(bench, k72_____),
+        offsetof(bench, k73_____),
+        offsetof(bench, k74_____),
+        offsetof(bench, k75_____),
+        offsetof(bench, k76_____),
+        offsetof(bench, k77_____),
+        offsetof(bench, k78_____),
+        offsetof(bench, k79_____),
+        offsetof(bench, s6______.k80_____),
+        offsetof(bench, s6______.k81_____),
+        offsetof(bench, s6______.k82_____),
+        offsetof(bench, s6______.k83_____),
+        offsetof(bench, s6______.k84_____),
+        offsetof(bench, s6______.k85_____),
+        offsetof(bench, s6______.k86_____),
+        offsetof(bench, s6______.k87_____),
+        offsetof(bench, s6______.s7______.k88_____),
+        offsetof(bench, s6______.s7______.k89_____),
+        offsetof(bench, s6______.s7______.k90_____),
+        offsetof(bench, s6______.s7______.k91_____),
+        offsetof(bench, s6______.s7______.k92_____),
+        offsetof(bench, s6______.s7______.k93_____),
+        offsetof(bench, s6______.s7______.k94_____),
+        offsetof(bench, s6______.s7______.k95_____),
+        offsetof(bench, k96_____),
+        offsetof(bench, k97_____),
+        offsetof(bench, k98_____),
+        offsetof(bench, k99_____),
+        offsetof(bench, k100____),
+        offsetof(bench, k101____),
+        offsetof(bench, k102____),
+        offsetof(bench, k103____),
+        offsetof(bench, s8______.k104____),
+        offsetof(bench, s8______.k105____),
+        offsetof(bench, s8______.k106____),
+        offsetof(bench, s8______.k107____),
+        offsetof(bench, s8______.k108____),
+        offsetof(bench, s8______.k109____),
+        offsetof(bench, s8______.k110____),
+        offsetof(bench, s8______.k111____),
+        offsetof(bench, s8______.s9______.k112____),
+        offsetof(bench, s8______.s9______.k113____),
+        offsetof(bench, s8______.s9______.k114____),
+        offsetof(bench, s8______.s9______.k115____),
+        offsetof(bench, s8______.s9______.k116____),
+        offsetof(bench, s8______.s9______.k117____),
+        offsetof(bench, s8______.s9______.k118____),
+        offsetof(bench, s8______.s9______.k119____),
+        offsetof(bench, k120____),
+        offsetof(bench, k121____),
+        offsetof(bench, k122____),
+        offsetof(bench, k123____),
+        offsetof(bench, k124____),
+        offsetof(bench, k125____),
+        offsetof(bench, k126____),
+        offsetof(bench, k127____),
+        offsetof(bench, s10_____.k128____),
+        offsetof(bench, s10_____.k129____),
+        offsetof(bench, s10_____.k130____),
+        offsetof(bench, s10_____.k131____),
+        offsetof(bench, s10_____.k132____),
+        offsetof(bench, s10_____.k133____),
+        offsetof(bench, s10_____.k134____),
+        offsetof(bench, s10_____.k135____),
+        offsetof(bench, s10_____.s11_____.k136____),
+        offsetof(bench, s10_____.s11_____.k137____),
+        offsetof(bench, s10_____.s11_____.k138____),
+        offsetof(bench, s10_____.s11_____.k139____),
+        offsetof(bench, s10_____.s11_____.k140____),
+        offsetof(bench, s10_____.s11_____.k141____),
+        offsetof(bench, s10_____.s11_____.k142____),
+        offsetof(bench, s10_____.s11_____.k143____),
+        offsetof(bench, k144____),
+        offsetof(bench, k145____),
+        offsetof(bench, k146____),
+        offsetof(bench, k147____),
+        offsetof(bench, k148____),
+        offsetof(bench, k149____),
+        offsetof(bench, k150____),
+        offsetof(bench, k151____),
+        offsetof(bench, s12_____.k152____),
+        offsetof(bench, s12_____.k153____),
+        offsetof(bench, s12_____.k154____),
+        offsetof(bench, s12_____.k155____),
+        offsetof(bench, s12_____.k156____),
+        offsetof(bench, s12_____.k157____),
+        offsetof(bench, s12_____.k158____),
+        offsetof(bench, s12_____.k159____),
+        offsetof(bench, s12_____.s13_____.k160____),
+        offsetof(bench, s12_____.s13_____.k161____),
+        offsetof(bench, s12_____.s13_____.k162____),
+        offsetof(bench, s12_____.s13_____.k163____),
+        offsetof(bench, s12_____.s13_____.k164____),
+        offsetof(bench, s12_____.s13_____.k165____),
+        offsetof(bench, s12_____.s13_____.k166____),
+        offsetof(bench, s12_____.s13_____.k167____),
+        offsetof(bench, k168____),
+        offsetof(bench, k169____),
+        offsetof(bench, k170____),
+        offsetof(bench, k171____),
+        offsetof(bench, k172____),
+        offsetof(bench, k173____),
+        offsetof(bench, k174____),
+        offsetof(bench, k175____),
+        offsetof(bench, s14_____.k176____),
+        offsetof(bench, s14_____.k177____),
+        offsetof(bench, s14_____.k178____),
+        offsetof(bench, s14_____.k179____),
+        offsetof(bench, s14_____.k180____),
+        offsetof(bench, s14_____.k181____),
+        offsetof(bench, s14_____.k182____),
+        offsetof(bench, s14_____.k183____),
+        offsetof(bench, s14_____.s15_____.k184____),
+        offsetof(bench, s14_____.s15_____.k185____),
+        offsetof(bench, s14_____.s15_____.k186____),
+        offsetof(bench, s14_____.s15_____.k187____),
+        offsetof(bench, s14_____.s15_____.k188____),
+        offsetof(bench, s14_____.s15_____.k189____),
+        offsetof(bench, s14_____.s15_____.k190____),
+        offsetof(bench, s14_____.s15_____.k191____),
+        offsetof(bench, k192____),
+        offsetof(bench, k193____),
+        offsetof(bench, k194____),
+        offsetof(bench, k195____),
+        offsetof(bench, k196____),
+        offsetof(bench, k197____),
+        offsetof(bench, k198____),
+        offsetof(bench, k199____),
+        offsetof(bench, s16_____.k200____),
+        offsetof(bench, s16_____.k201____),
+        offsetof(bench, s16_____.k202____),
+        offsetof(bench, s16_____.k203____),
+        offsetof(bench, s16_____.k204____),
+        offsetof(bench, s16_____.k205____),
+        offsetof(bench, s16_____.k206____),
+        offsetof(bench, s16_____.k207____),
+        offsetof(bench, s16_____.s17_____.k208____),
+        offsetof(bench, s16_____.s17_____.k209____),
+        offsetof(bench, s16_____.s17_____.k210____),
+        offsetof(bench, s16_____.s17_____.k211____),
+        offsetof(bench, s16_____.s17_____.k212____),
+        offsetof(bench, s16_____.s17_____.k213____),
+        offsetof(bench, s16_____.s17_____.k214____),
+        offsetof(bench, s16_____.s17_____.k215____),
+        offsetof(bench, k216____),
+        offsetof(bench, k217____),
+        offsetof(bench, k218____),
+        offsetof(bench, k219____),
+        offsetof(bench, k220____),
+        offsetof(bench, k221____),
+        offsetof(bench, k222____),
+        offsetof(bench, k223____),
+        offsetof(bench, s18_____.k224____),
+        offsetof(bench, s18_____.k225____),
+        offsetof(bench, s18_____.k226____),
+        offsetof(bench, s18_____.k227____),
+        offsetof(bench, s18_____.k228____),
+        offsetof(bench, s18_____.k229____),
+        offsetof(bench, s18_____.k230____),
+        offsetof(bench, s18_____.k231____),
+        offsetof(bench, s18_____.s19_____.k232____),
+        offsetof(bench, s18_____.s19_____.k233____),
+        offsetof(bench, s18_____.s19_____.k234____),
+        offsetof(bench, s18_____.s19_____.k235____),
+        offsetof(bench, s18_____.s19_____.k236____),
+        offsetof(bench, s18_____.s19_____.k237____),
+        offsetof(bench, s18_____.s19_____.k238____),
+        offsetof(bench, s18_____.s19_____.k239____),
+        offsetof(bench, k240____),
+        offsetof(bench, k241____),
+        offsetof(bench, k242____),
+        offsetof(bench, k243____),
+        offsetof(bench, k244____),
+        offsetof(bench, k245____),
+        offsetof(bench, k246____),
+        offsetof(bench, k247____),
+        offsetof(bench, s20_____.k248____),
+        offsetof(bench, s20_____.k249____),
+        offsetof(bench, s20_____.k250____),
+        offsetof(bench, s20_____.k251____),
+        offsetof(bench, s20_____.k252____),
+        offsetof(bench, s20_____.k253____),
+        offsetof(bench, s20_____.k254____),
+        offsetof(bench, s20_____.k255____),
+        offsetof(bench, s20_____.s21_____.k256____),
+        offsetof(bench, s20_____.s21_____.k257____),
+        offsetof(bench, s20_____.s21_____.k258____),
+        offsetof(bench, s20_____.s21_____.k259____),
+        offsetof(bench, s20_____.s21_____.k260____),
+        offsetof(bench, s20_____.s21_____.k261____),
+        offsetof(bench, s20_____.s21_____.k262____),
+        offsetof(bench, s20_____.s21_____.k263____),
+        offsetof(bench, k264____),
+        offsetof(bench, k265____),
+        offsetof(bench, k266____),
+        offsetof(bench, k267____),
+        offsetof(bench, k268____),
+        offsetof(bench, k269____),
+        offsetof(bench, k270____),
+        offsetof(bench, k271____),
+        offsetof(bench, s22_____.k272____),
+        offsetof(bench, s22_____.k273____),
+        offsetof(bench, s22_____.k274____),
+        offsetof(bench, s22_____.k275____),
+        offsetof(bench, s22_____.k276____),
+        offsetof(bench, s22_____.k277____),
+        offsetof(bench, s22_____.k278____),
+        offsetof(bench, s22_____.k279____),
+        offsetof(bench, s22_____.s23_____.k280____),
+        offsetof(bench, s22_____.s23_____.k281____),
+        offsetof(bench, s22_____.s23_____.k282____),
+        offsetof(bench, s22_____.s23_____.k283____),
+        offsetof(bench, s22_____.s23_____.k284____),
+        offsetof(bench, s22_____.s23_____.k285____),
+        offsetof(bench, s22_____.s23_____.k286____),
+        offsetof(bench, s22_____.s23_____.k287____),
+        offsetof(bench, k288____),
+        offsetof(bench, k289____),
+        offsetof(bench, k290____),
+        offsetof(bench, k291____),
+        offsetof(bench, k292____),
+        offsetof(bench, k293____),
+        offsetof(bench, k294____),
+        offsetof(bench, k295____),
+        offsetof(bench, s24_____.k296____),
+        offsetof(bench, s24_____.k297____),
+        offsetof(bench, s24_____.k298____),
+        offsetof(bench, s24_____.k299____),
+        offsetof(bench, s24_____.k300____),
+        offsetof(bench, s24_____.k301____),
+        offsetof(bench, s24_____.k302____),
+        offsetof(bench, s24_____.k303____),
+        offsetof(bench, s24_____.s25_____.k304____),
+        offsetof(bench, s24_____.s25_____.k305____),
+        offsetof(bench, s24_____.s25_____.k306____),
+        offsetof(bench, s24_____.s25_____.k307____),
+        offsetof(bench, s24_____.s25_____.k308____),
+        offsetof(bench, s24_____.s25_____.k309____),
+        offsetof(bench, s24_____.s25_____.k310____),
+        offsetof(bench, s24_____.s25_____.k311____),
+        offsetof(bench, k312____),
+        offsetof(bench, k313____),
+        offsetof(bench, k314____),
+        offsetof(bench, k315____),
+        offsetof(bench, k316____),
+        offsetof(bench, k317____),
+        offsetof(bench, k318____),
+        offsetof(bench, k319____),
+        offsetof(bench, s26_____.k320____),
+        offsetof(bench, s26_____.k321____),
+        offsetof(bench, s26_____.k322____),
+        offsetof(bench, s26_____.k323____),
+        offsetof(bench, s26_____.k324____),
+        offsetof(bench, s26_____.k325____),
+        offsetof(bench, s26_____.k326____),
+        offsetof(bench, s26_____.k327____),
+        offsetof(bench, s26_____.s27_____.k328____),
+        offsetof(bench, s26_____.s27_____.k329____),
+        offsetof(bench, s26_____.s27_____.k330____),
+        offsetof(bench, s26_____.s27_____.k331____),
+        offsetof(bench, s26_____.s27_____.k332____),
+        offsetof(bench, s26_____.s27_____.k333____),
+        offsetof(bench, s26_____.s27_____.k334____),
+        offsetof(bench, s26_____.s27_____.k335____),
+        offsetof(bench, k336____),
+        offsetof(bench, k337____),
+        offsetof(bench, k338____),
+        offsetof(bench, k339____),
+        offsetof(bench, k340____),
+        offsetof(bench, k341____),
+        offsetof(bench, k342____),
+        offsetof(bench, k343____),
+        offsetof(bench, s28_____.k344____),
+        offsetof(bench, s28_____.k345____),
+        offsetof(bench, s28_____.k346____),
+        offsetof(bench, s28_____.k347____),
+        offsetof(bench, s28_____.k348____),
+        offsetof(bench, s28_____.k349____),
+        offsetof(bench, s28_____.k350____),
+        offsetof(bench, s28_____.k351____),
+        offsetof(bench, s28_____.s29_____.k352____),
+        offsetof(bench, s28_____.s29_____.k353____),
+        offsetof(bench, s28_____.s29_____.k354____),
+        offsetof(bench, s28_____.s29_____.k355____),
+        offsetof(bench, s28_____.s29_____.k356____),
+        offsetof(bench, s28_____.s29_____.k357____),
+        offsetof(bench, s28_____.s29_____.k358____),
+        offsetof(bench, s28_____.s29_____.k359____),
+        offsetof(bench, k360____),
+        offsetof(bench, k361____),
+        offsetof(bench, k362____),
+        offsetof(bench, k363____),
+        offsetof(bench, k364____),
+        offsetof(bench, k365____),
+        offsetof(bench, k366____),
+        offsetof(bench, k367____),
+        offsetof(bench, s30_____.k368____),
+        offsetof(bench, s30_____.k369____),
+        offsetof(bench, s30_____.k370____),
+        offsetof(bench, s30_____.k371____),
+        offsetof(bench, s30_____.k372____),
+        offsetof(bench, s30_____.k373____),
+        offsetof(bench, s30_____.k374____),
+        offsetof(bench, s30_____.k375____),
+        offsetof(bench, s30_____.s31_____.k376____),
+        offsetof(bench, s30_____.s31_____.k377____),
+        offsetof(bench, s30_____.s31_____.k378____),
+        offsetof(bench, s30_____.s31_____.k379____),
+        offsetof(bench, s30_____.s31_____.k380____),
+        offsetof(bench, s30_____.s31_____.k381____),
+        offsetof(bench, s30_____.s31_____.k382____),
+        offsetof(bench, s30_____.s31_____.k383____),
+        offsetof(bench, k384____),
+        offsetof(bench, k385____),
+        offsetof(bench, k386____),
+        offsetof(bench, k387____),
+        offsetof(bench, k388____),
+        offsetof(bench, k389____),
+        offsetof(bench, k390____),
+        offsetof(bench, k391____),
+        offsetof(bench, s32_____.k392____),
+        offsetof(bench, s32_____.k393____),
+        offsetof(bench, s32_____.k394____),
+        offsetof(bench, s32_____.k395____),
+        offsetof(bench, s32_____.k396____),
+        offsetof(bench, s32_____.k397____),
+        offsetof(bench, s32_____.k398____),
+        offsetof(bench, s32_____.k399____),
+        offsetof(bench, s32_____.s33_____.k400____),
+        offsetof(bench, s32_____.s33_____.k401____),
+        offsetof(bench, s32_____.s33_____.k402____),
+        offsetof(bench, s32_____.s33_____.k403____),
+        offsetof(bench, s32_____.s33_____.k404____),
+        offsetof(bench, s32_____.s33_____.k405____),
+        offsetof(bench, s32_____.s33_____.k406____),
+        offsetof(bench, s32_____.s33_____.k407____),
+        offsetof(bench, k408____),
+        offsetof(bench, k409____),
+        offsetof(bench, k410____),
+        offsetof(bench, k411____),
+        offsetof(bench, k412____),
+        offsetof(bench, k413____),
+        offsetof(bench, k414____),
+        offsetof(bench, k415____),
+        offsetof(bench, s34_____.k416____),
+        offsetof(bench, s34_____.k417____),
+        offsetof(bench, s34_____.k418____),
+        offsetof(bench, s34_____.k419____),
+        offsetof(bench, s34_____.k420____),
+        offsetof(bench, s34_____.k421____),
+        offsetof(bench, s34_____.k422____),
+        offsetof(bench, s34_____.k423____),
+        offsetof(bench, s34_____.s35_____.k424____),
+        offsetof(bench, s34_____.s35_____.k425____),
+        offsetof(bench, s34_____.s35_____.k426____),
+        offsetof(bench, s34_____.s35_____.k427____),
+        offsetof(bench, s34_____.s35_____.k428____),
+        offsetof(bench, s34_____.s35_____.k429____),
+        offsetof(bench, s34_____.s35_____.k430____),
+        offsetof(bench, s34_____.s35_____.k431____),
+        offsetof(bench, k432____),
+        offsetof(bench, k433____),
+        offsetof(bench, k434____),
+        offsetof(bench, k435____),
+        offsetof(bench, k436____),
+        offsetof(bench, k437____),
+        offsetof(bench, k438____),
+        offsetof(bench, k439____),
+        offsetof(bench, s36_____.k440____),
+        offsetof(bench, s36_____.k441____),
+        offsetof(bench, s36_____.k442____),
+        offsetof(bench, s36_____.k443____),
+        offsetof(bench, s36_____.k444____),
+        offsetof(bench, s36_____.k445____),
+        offsetof(bench, s36_____.k446____),
+        offsetof(bench, s36_____.k447____),
+        offsetof(bench, s36_____.s37_____.k448____),
+        offsetof(bench, s36_____.s37_____.k449____),
+        offsetof(bench, s36_____.s37_____.k450____),
+        offsetof(bench, s36_____.s37_____.k451____),
+        offsetof(bench, s36_____.s37_____.k452____),
+        offsetof(bench, s36_____.s37_____.k453____),
+        offsetof(bench, s36_____.s37_____.k454____),
+        offsetof(bench, s36_____.s37_____.k455____),
+        offsetof(bench, k456____),
+        offsetof(bench, k457____),
+        offsetof(bench, k458____),
+        offsetof(bench, k459____),
+        offsetof(bench, k460____),
+        offsetof(bench, k461____),
+        offsetof(bench, k462____),
+        offsetof(bench, k463____),
+        offsetof(bench, s38_____.k464____),
+        offsetof(bench, s38_____.k465____),
+        offsetof(bench, s38_____.k466____),
+        offsetof(bench, s38_____.k467____),
+        offsetof(bench, s38_____.k468____),
+        offsetof(bench, s38_____.k469____),
+        offsetof(bench, s38_____.k470____),
+        offsetof(bench, s38_____.k471____),
+        offsetof(bench, s38_____.s39_____.k472____),
+        offsetof(bench, s38_____.s39_____.k473____),
+        offsetof(bench, s38_____.s39_____.k474____),
+        offsetof(bench, s38_____.s39_____.k475____),
+        offsetof(bench, s38_____.s39_____.k476____),
+        offsetof(bench, s38_____.s39_____.k477____),
+        offsetof(bench, s38_____.s39_____.k478____),
+        offsetof(bench, s38_____.s39_____.k479____),
+        offsetof(bench, k480____),
+        offsetof(bench, k481____),
+        offsetof(bench, k482____),
+        offsetof(bench, k483____),
+        offsetof(bench, k484____),
+        offsetof(bench, k485____),
+        offsetof(bench, k486____),
+        offsetof(bench, k487____),
+        offsetof(bench, s40_____.k488____),
+        offsetof(bench, s40_____.k489____),
+        offsetof(bench, s40_____.k490____),
+        offsetof(bench, s40_____.k491____),
+        offsetof(bench, s40_____.k492____),
+        offsetof(bench, s40_____.k493____),
+        offsetof(bench, s40_____.k494____),
+        offsetof(bench, s40_____.k495____),
+        offsetof(bench, s40_____.s41_____.k496____),
+        offsetof(bench, s40_____.s41_____.k497____),
+        offsetof(bench, s40_____.s41_____.k498____),
+        offsetof(bench, s40_____.s41_____.k499____),
+        offsetof(bench, s40_____.s41_____.k500____),
+        offsetof(bench, s40_____.s41_____.k501____),
+        offsetof(bench, s40_____.s41_____.k502____),
+        offsetof(bench, s40_____.s41_____.k503____),
+        offsetof(bench, k504____),
+        offsetof(bench, k505____),
+        offsetof(bench, k506____),
+        offsetof(bench, k507____),
+        offsetof(bench, k508____),
+        offsetof(bench, k509____),
+        offsetof(bench, k510____),
+        offsetof(bench, k511____),
+        offsetof(bench, s42_____.k512____),
+        offsetof(bench, s42_____.k513____),
+        offsetof(bench, s42_____.k514____),
+        offsetof(bench, s42_____.k515____),
+        offsetof(bench, s42_____.k516____),
+        offsetof(bench, s42_____.k517____),
+        offsetof(bench, s42_____.k518____),
+        offsetof(bench, s42_____.k519____),
+        offsetof(bench, s42_____.s43_____.k520____),
+        offsetof(bench, s42_____.s43_____.k521____),
+        offsetof(bench, s42_____.s43_____.k522____),
+        offsetof(bench, s42_____.s43_____.k523____),
+        offsetof(bench, s42_____.s43_____.k524____),
+        offsetof(bench, s42_____.s43_____.k525____),
+        offsetof(bench, s42_____.s43_____.k526____),
+        offsetof(bench, s42_____.s43_____.k527____),
+        offsetof(bench, k528____),
+        offsetof(bench, k529____),
+        offsetof(bench, k530____),
+        offsetof(bench, k531____),
+        offsetof(bench, k532____),
+        offsetof(bench, k533____),
+        offsetof(bench, k534____),
+        offsetof(bench, k535____),
+        offsetof(bench, s44_____.k536____),
+        offsetof(bench, s44_____.k537____),
+        offsetof(bench, s44_____.k538____),
+        offsetof(bench, s44_____.k539____),
+        offsetof(bench, s44_____.k540____),
+        offsetof(bench, s44_____.k541____),
+        offsetof(bench, s44_____.k542____),
+        offsetof(bench, s44_____.k543____),
+        offsetof(bench, s44_____.s45_____.k544____),
+        offsetof(bench, s44_____.s45_____.k545____),
+        offsetof(bench, s44_____.s45_____.k546____),
+        offsetof(bench, s44_____.s45_____.k547____),
+        offsetof(bench, s44_____.s45_____.k548____),
+        offsetof(bench, s44_____.s45_____.k549____),
+        offsetof(bench, s44_____.s45_____.k550____),
+        offsetof(bench, s44_____.s45_____.k551____),
+        offsetof(bench, k552____),
+        offsetof(bench, k553____),
+        offsetof(bench, k554____),
+        offsetof(bench, k555____),
+        offsetof(bench, k556____),
+        offsetof(bench, k557____),
+        offsetof(bench, k558____),
+        offsetof(bench, k559____),
+        offsetof(bench, s46_____.k560____),
+        offsetof(bench, s46_____.k561____),
+        offsetof(bench, s46_____.k562____),
+        offsetof(bench, s46_____.k563____),
+        offsetof(bench, s46_____.k564____),
+        offsetof(bench, s46_____.k565____),
+        offsetof(bench, s46_____.k566____),
+        offsetof(bench, s46_____.k567____),
+        offsetof(bench, s46_____.s47_____.k568____),
+        offsetof(bench, s46_____.s47_____.k569____),
+        offsetof(bench, s46_____.s47_____.k570____),
+        offsetof(bench, s46_____.s47_____.k571____),
+        offsetof(bench, s46_____.s47_____.k572____),
+        offsetof(bench, s46_____.s47_____.k573____),
+        offsetof(bench, s46_____.s47_____.k574____),
+        offsetof(bench, s46_____.s47_____.k575____),
+        offsetof(bench, k576____),
+        offsetof(bench, k577____),
+        offsetof(bench, k578____),
+        offsetof(bench, k579____),
+        offsetof(bench, k580____),
+        offsetof(bench, k581____),
+        offsetof(bench, k582____),
+        offsetof(bench, k583____),
+        offsetof(bench, s48_____.k584____),
+        offsetof(bench, s48_____.k585____),
+        offsetof(bench, s48_____.k586____),
+        offsetof(bench, s48_____.k587____),
+        offsetof(bench, s48_____.k588____),
+        offsetof(bench, s48_____.k589____),
+        offsetof(bench, s48_____.k590____),
+        offsetof(bench, s48_____.k591____),
+        offsetof(bench, s48_____.s49_____.k592____),
+        offsetof(bench, s48_____.s49_____.k593____),
+        offsetof(bench, s48_____.s49_____.k594____),
+        offsetof(bench, s48_____.s49_____.k595____),
+        offsetof(bench, s48_____.s49_____.k596____),
+        offsetof(bench, s48_____.s49_____.k597____),
+        offsetof(bench, s48_____.s49_____.k598____),
+        offsetof(bench, s48_____.s49_____.k599____),
+        offsetof(bench, k600____),
+        offsetof(bench, k601____),
+        offsetof(bench, k602____),
+        offsetof(bench, k603____),
+        offsetof(bench, k604____),
+        offsetof(bench, k605____),
+        offsetof(bench, k606____),
+        offsetof(bench, k607____),
+        offsetof(bench, s50_____.k608____),
+        offsetof(bench, s50_____.k609____),
+        offsetof(bench, s50_____.k610____),
+        offsetof(bench, s50_____.k611____),
+        offsetof(bench, s50_____.k612____),
+        offsetof(bench, s50_____.k613____),
+        offsetof(bench, s50_____.k614____),
+        offsetof(bench, s50_____.k615____),
+        offsetof(bench, s50_____.s51_____.k616____),
+        offsetof(bench, s50_____.s51_____.k617____),
+        offsetof(bench, s50_____.s51_____.k618____),
+        offsetof(bench, s50_____.s51_____.k619____),
+        offsetof(bench, s50_____.s51_____.k620____),
+        offsetof(bench, s50_____.s51_____.k621____),
+        offsetof(bench, s50_____.s51_____.k622____),
+        offsetof(bench, s50_____.s51_____.k623____),
+        offsetof(bench, k624____),
+        offsetof(bench, k625____),
+        offsetof(bench, k626____),
+        offsetof(bench, k627____),
+        offsetof(bench, k628____),
+        offsetof(bench, k629____),
+        offsetof(bench, k630____),
+        offsetof(bench, k631____),
+        offsetof(bench, s52_____.k632____),
+        offsetof(bench, s52_____.k633____),
+        offsetof(bench, s52_____.k634____),
+        offsetof(bench, s52_____.k635____),
+        offsetof(bench, s52_____.k636____),
+        offsetof(bench, s52_____.k637____),
+        offsetof(bench, s52_____.k638____),
+        offsetof(bench, s52_____.k639____),
+        offsetof(bench, s52_____.s53_____.k640____),
+        offsetof(bench, s52_____.s53_____.k641____),
+        offsetof(bench, s52_____.s53_____.k642____),
+        offsetof(bench, s52_____.s53_____.k643____),
+        offsetof(bench, s52_____.s53_____.k644____),
+        offsetof(bench, s52_____.s53_____.k645____),
+        offsetof(bench, s52_____.s53_____.k646____),
+        offsetof(bench, s52_____.s53_____.k647____),
+        offsetof(bench, k648____),
+        offsetof(bench, k649____),
+        offsetof(bench, k650____),
+        offsetof(bench, k651____),
+        offsetof(bench, k652____),
+        offsetof(bench, k653____),
+        offsetof(bench, k654____),
+        offsetof(bench, k655____),
+        offsetof(bench, s54_____.k656____),
+        offsetof(bench, s54_____.k657____),
+        offsetof(bench, s54_____.k658____),
+        offsetof(bench, s54_____.k659____),
+        offsetof(bench, s54_____.k660____),
+        offsetof(bench, s54_____.k661____),
+        offsetof(bench, s54_____.k662____),
+        offsetof(bench, s54_____.k663____),
+        offsetof(bench, s54_____.s55_____.k664____),
+        offsetof(bench, s54_____.s55_____.k665____),
+        offsetof(bench, s54_____.s55_____.k666____),
+        offsetof(bench, s54_____.s55_____.k667____),
+        offsetof(bench, s54_____.s55_____.k668____),
+        offsetof(bench, s54_____.s55_____.k669____),
+        offsetof(bench, s54_____.s55_____.k670____),
+        offsetof(bench, s54_____.s55_____.k671____),
+        offsetof(bench, k672____),
+        offsetof(bench, k673____),
+        offsetof(bench, k674____),
+        offsetof(bench, k675____),
+        offsetof(bench, k676____),
+        offsetof(bench, k677____),
+        offsetof(bench, k678____),
+        offsetof(bench, k679____),
+        offsetof(bench, s56_____.k680____),
+        offsetof(bench, s56_____.k681____),
+        offsetof(bench, s56_____.k682____),
+        offsetof(bench, s56_____.k683____),
+        offsetof(bench, s56_____.k684____),
+        offsetof(bench, s56_____.k685____),
+        offsetof(bench, s56_____.k686____),
+        offsetof(bench, s56_____.k687____),
+        offsetof(bench, s56_____.s57_____.k688____),
+        offsetof(bench, s56_____.s57_____.k689____),
+        offsetof(bench, s56_____.s57_____.k690____),
+        offsetof(bench, s56_____.s57_____.k691____),
+        offsetof(bench, s56_____.s57_____.k692____),
+        offsetof(bench, s56_____.s57_____.k693____),
+        offsetof(bench, s56_____.s57_____.k694____),
+        offsetof(bench, s56_____.s57_____.k695____),
+        offsetof(bench, k696____),
+        offsetof(bench, k697____),
+        offsetof(bench, k698____),
+        offsetof(bench, k699____),
+        offsetof(bench, k700____),
+        offsetof(bench, k701____),
+        offsetof(bench, k702____),
+        offsetof(bench, k703____),
+        offsetof(bench, s58_____.k704____),
+        offsetof(bench, s58_____.k705____),
+        offsetof(bench, s58_____.k706____),
+        offsetof(bench, s58_____.k707____),
+        offsetof(bench, s58_____.k708____),
+        offsetof(bench, s58_____.k709____),
+        offsetof(bench, s58_____.k710____),
+        offsetof(bench, s58_____.k711____),
+        offsetof(bench, s58_____.s59_____.k712____),
+        offsetof(bench, s58_____.s59_____.k713____),
+        offsetof(bench, s58_____.s59_____.k714____),
+        offsetof(bench, s58_____.s59_____.k715____),
+        offsetof(bench, s58_____.s59_____.k716____),
+        offsetof(bench, s58_____.s59_____.k717____),
+        offsetof(bench, s58_____.s59_____.k718____),
+        offsetof(bench, s58_____.s59_____.k719____),
+        offsetof(bench, k720____),
+        offsetof(bench, k721____),
+        offsetof(bench, k722____),
+        offsetof(bench, k723____),
+        offsetof(bench, k724____),
+        offsetof(bench, k725____),
+        offsetof(bench, k726____),
+        offsetof(bench, k727____),
+        offsetof(bench, s60_____.k728____),
+        offsetof(bench, s60_____.k729____),
+        offsetof(bench, s60_____.k730____),
+        offsetof(bench, s60_____.k731____),
+        offsetof(bench, s60_____.k732____),
+        offsetof(bench, s60_____.k733____),
+        offsetof(bench, s60_____.k734____),
+        offsetof(bench, s60_____.k735____),
+        offsetof(bench, s60_____.s61_____.k736____),
+        offsetof(bench, s60_____.s61_____.k737____),
+        offsetof(bench, s60_____.s61_____.k738____),
+        offsetof(bench, s60_____.s61_____.k739____),
+        offsetof(bench, s60_____.s61_____.k740____),
+        offsetof(bench, s60_____.s61_____.k741____),
+        offsetof(bench, s60_____.s61_____.k742____),
+        offsetof(bench, s60_____.s61_____.k743____),
+        offsetof(bench, k744____),
+        offsetof(bench, k745____),
+        offsetof(bench, k746____),
+        offsetof(bench, k747____),
+        offsetof(bench, k748____),
+        offsetof(bench, k749____),
+        offsetof(bench, k750____),
+        offsetof(bench, k751____),
+        offsetof(bench, s62_____.k752____),
+        offsetof(bench, s62_____.k753____),
+        offsetof(bench, s62_____.k754____),
+        offsetof(bench, s62_____.k755____),
+        offsetof(bench, s62_____.k756____),
+        offsetof(bench, s62_____.k757____),
+        offsetof(bench, s62_____.k758____),
+        offsetof(bench, s62_____.k759____),
+        offsetof(bench, s62_____.s63_____.k760____),
+        offsetof(bench, s62_____.s63_____.k761____),
+        offsetof(bench, s62_____.s63_____.k762____),
+        offsetof(bench, s62_____.s63_____.k763____),
+        offsetof(bench, s62_____.s63_____.k764____),
+        offsetof(bench, s62_____.s63_____.k765____),
+        offsetof(bench, s62_____.s63_____.k766____),
+        offsetof(bench, s62_____.s63_____.k767____),
+        offsetof(bench, k768____),
+        offsetof(bench, k769____),
+        offsetof(bench, k770____),
+        offsetof(bench, k771____),
+        offsetof(bench, k772____),
+        offsetof(bench, k773____),
+        offsetof(bench, k774____),
+        offsetof(bench, k775____),
+        offsetof(bench, s64_____.k776____),
+        offsetof(bench, s64_____.k777____),
+        offsetof(bench, s64_____.k778____),
+        offsetof(bench, s64_____.k779____),
+        offsetof(bench, s64_____.k780____),
+        offsetof(bench, s64_____.k781____),
+        offsetof(bench, s64_____.k782____),
+        offsetof(bench, s64_____.k783____),
+        offsetof(bench, s64_____.s65_____.k784____),
+        offsetof(bench, s64_____.s65_____.k785____),
+        offsetof(bench, s64_____.s65_____.k786____),
+        offsetof(bench, s64_____.s65_____.k787____),
+        offsetof(bench, s64_____.s65_____.k788____),
+        offsetof(bench, s64_____.s65_____.k789____),
+        offsetof(bench, s64_____.s65_____.k790____),
+        offsetof(bench, s64_____.s65_____.k791____),
+        offsetof(bench, k792____),
+        offsetof(bench, k793____),
+        offsetof(bench, k794____),
+        offsetof(bench, k795____),
+        offsetof(bench, k796____),
+        offsetof(bench, k797____),
+        offsetof(bench, k798____),
+        offsetof(bench, k799____),
+        offsetof(bench, s66_____.k800____),
+        offsetof(bench, s66_____.k801____),
+        offsetof(bench, s66_____.k802____),
+        offsetof(bench, s66_____.k803____),
+        offsetof(bench, s66_____.k804____),
+        offsetof(bench, s66_____.k805____),
+        offsetof(bench, s66_____.k806____),
+        offsetof(bench, s66_____.k807____),
+        offsetof(bench, s66_____.s67_____.k808____),
+        offsetof(bench, s66_____.s67_____.k809____),
+        offsetof(bench, s66_____.s67_____.k810____),
+        offsetof(bench, s66_____.s67_____.k811____),
+        offsetof(bench, s66_____.s67_____.k812____),
+        offsetof(bench, s66_____.s67_____.k813____),
+        offsetof(bench, s66_____.s67_____.k814____),
+        offsetof(bench, s66_____.s67_____.k815____),
+        offsetof(bench, k816____),
+        offsetof(bench, k817____),
+        offsetof(bench, k818____),
+        offsetof(bench, k819____),
+        offsetof(bench, k820____),
+        offsetof(bench, k821____),
+        offsetof(bench, k822____),
+        offsetof(bench, k823____),
+        offsetof(bench, s68_____.k824____),
+        offsetof(bench, s68_____.k825____),
+        offsetof(bench, s68_____.k826____),
+        offsetof(bench, s68_____.k827____),
+        offsetof(bench, s68_____.k828____),
+        offsetof(bench, s68_____.k829____),
+        offsetof(bench, s68_____.k830____),
+        offsetof(bench, s68_____.k831____),
+        offsetof(bench, s68_____.s69_____.k832____),
+        offsetof(bench, s68_____.s69_____.k833____),
+        offsetof(bench, s68_____.s69_____.k834____),
+        offsetof(bench, s68_____.s69_____.k835____),
+        offsetof(bench, s68_____.s69_____.k836____),
+        offsetof(bench, s68_____.s69_____.k837____),
+        offsetof(bench, s68_____.s69_____.k838____),
+        offsetof(bench, s68_____.s69_____.k839____),
+        offsetof(bench, k840____),
+        offsetof(bench, k841____),
+        offsetof(bench, k842____),
+        offsetof(bench, k843____),
+        offsetof(bench, k844____),
+        offsetof(bench, k845____),
+        offsetof(bench, k846____),
+        offsetof(bench, k847____),
+        offsetof(bench, s70_____.k848____),
+        offsetof(bench, s70_____.k849____),
+        offsetof(bench, s70_____.k850____),
+        offsetof(bench, s70_____.k851____),
+        offsetof(bench, s70_____.k852____),
+        offsetof(bench, s70_____.k853____),
+        offsetof(bench, s70_____.k854____),
+        offsetof(bench, s70_____.k855____),
+        offsetof(bench, s70_____.s71_____.k856____),
+        offsetof(bench, s70_____.s71_____.k857____),
+        offsetof(bench, s70_____.s71_____.k858____),
+        offsetof(bench, s70_____.s71_____.k859____),
+        offsetof(bench, s70_____.s71_____.k860____),
+        offsetof(bench, s70_____.s71_____.k861____),
+        offsetof(bench, s70_____.s71_____.k862____),
+        offsetof(bench, s70_____.s71_____.k863____),
+        offsetof(bench, k864____),
+        offsetof(bench, k865____),
+        offsetof(bench, k866____),
+        offsetof(bench, k867____),
+        offsetof(bench, k868____),
+        offsetof(bench, k869____),
+        offsetof(bench, k870____),
+        offsetof(bench, k871____),
+        offsetof(bench, s72_____.k872____),
+        offsetof(bench, s72_____.k873____),
+        offsetof(bench, s72_____.k874____),
+        offsetof(bench, s72_____.k875____),
+        offsetof(bench, s72_____.k876____),
+        offsetof(bench, s72_____.k877____),
+        offsetof(bench, s72_____.k878____),
+        offsetof(bench, s72_____.k879____),
+        offsetof(bench, s72_____.s73_____.k880____),
+        offsetof(bench, s72_____.s73_____.k881____),
+        offsetof(bench, s72_____.s73_____.k882____),
+        offsetof(bench, s72_____.s73_____.k883____),
+        offsetof(bench, s72_____.s73_____.k884____),
+        offsetof(bench, s72_____.s73_____.k885____),
+        offsetof(bench, s72_____.s73_____.k886____),
+        offsetof(bench, s72_____.s73_____.k887____),
+        offsetof(bench, k888____),
+        offsetof(bench, k889____),
+        offsetof(bench, k890____),
+        offsetof(bench, k891____),
+        offsetof(bench, k892____),
+        offsetof(bench, k893____),
+        offsetof(bench, k894____),
+        offsetof(bench, k895____),
+        offsetof(bench, s74_____.k896____),
+        offsetof(bench, s74_____.k897____),
+        offsetof(bench, s74_____.k898____),
+        offsetof(bench, s74_____.k899____),
+        offsetof(bench, s74_____.k900____),
+        offsetof(bench, s74_____.k901____),
+        offsetof(bench, s74_____.k902____),
+        offsetof(bench, s74_____.k903____),
+        offsetof(bench, s74_____.s75_____.k904____),
+        offsetof(bench, s74_____.s75_____.k905____),
+        offsetof(bench, s74_____.s75_____.k906____),
+        offsetof(bench, s74_____.s75_____.k907____),
+        offsetof(bench, s74_____.s75_____.k908____),
+        offsetof(bench, s74_____.s75_____.k909____),
+        offsetof(bench, s74_____.s75_____.k910____),
+        offsetof(bench, s74_____.s75_____.k911____),
+        offsetof(bench, k912____),
+        offsetof(bench, k913____),
+        offsetof(bench, k914____),
+        offsetof(bench, k915____),
+        offsetof(bench, k916____),
+        offsetof(bench, k917____),
+        offsetof(bench, k918____),
+        offsetof(bench, k919____),
+        offsetof(bench, s76_____.k920____),
+        offsetof(bench, s76_____.k921____),
+        offsetof(bench, s76_____.k922____),
+        offsetof(bench, s76_____.k923____),
+        offsetof(bench, s76_____.k924____),
+        offsetof(bench, s76_____.k925____),
+        offsetof(bench, s76_____.k926____),
+        offsetof(bench, s76_____.k927____),
+        offsetof(bench, s76_____.s77_____.k928____),
+        offsetof(bench, s76_____.s77_____.k929____),
+        offsetof(bench, s76_____.s77_____.k930____),
+        offsetof(bench, s76_____.s77_____.k931____),
+        offsetof(bench, s76_____.s77_____.k932____),
+        offsetof(bench, s76_____.s77_____.k933____),
+        offsetof(bench, s76_____.s77_____.k934____),
+        offsetof(bench, s76_____.s77_____.k935____),
+        offsetof(bench, k936____),
+        offsetof(bench, k937____),
+        offsetof(bench, k938____),
+        offsetof(bench, k939____),
+        offsetof(bench, k940____),
+        offsetof(bench, k941____),
+        offsetof(bench, k942____),
+        offsetof(bench, k943____),
+        offsetof(bench, s78_____.k944____),
+        offsetof(bench, s78_____.k945____),
+        offsetof(bench, s78_____.k946____),
+        offsetof(bench, s78_____.k947____),
+        offsetof(bench, s78_____.k948____),
+        offsetof(bench, s78_____.k949____),
+        offsetof(bench, s78_____.k950____),
+        offsetof(bench, s78_____.k951____),
+        offsetof(bench, s78_____.s79_____.k952____),
+        offsetof(bench, s78_____.s79_____.k953____),
+        offsetof(bench, s78_____.s79_____.k954____),
+        offsetof(bench, s78_____.s79_____.k955____),
+        offsetof(bench, s78_____.s79_____.k956____),
+        offsetof(bench, s78_____.s79_____.k957____),
+        offsetof(bench, s78_____.s79_____.k958____),
+        offsetof(bench, s78_____.s79_____.k959____),
+        offsetof(bench, k960____),
+        offsetof(bench, k961____),
+        offsetof(bench, k962____),
+        offsetof(bench, k963____),
+        offsetof(bench, k964____),
+        offsetof(bench, k965____),
+        offsetof(bench, k966____),
+        offsetof(bench, k967____),
+        offsetof(bench, s80_____.k968____),
+        offsetof(bench, s80_____.k969____),
+        offsetof(bench, s80_____.k970____),
+        offsetof(bench, s80_____.k971____),
+        offsetof(bench, s80_____.k972____),
+        offsetof(bench, s80_____.k973____),
+        offsetof(bench, s80_____.k974____),
+        offsetof(bench, s80_____.k975____),
+        offsetof(bench, s80_____.s81_____.k976____),
+        offsetof(bench, s80_____.s81_____.k977____),
+        offsetof(bench, s80_____.s81_____.k978____),
+        offsetof(bench, s80_____.s81_____.k979____),
+        offsetof(bench, s80_____.s81_____.k980____),
+        offsetof(bench, s80_____.s81_____.k981____),
+        offsetof(bench, s80_____.s81_____.k982____),
+        offsetof(bench, s80_____.s81_____.k983____),
+        offsetof(bench, k984____),
+        offsetof(bench, k985____),
+        offsetof(bench, k986____),
+        offsetof(bench, k987____),
+        offsetof(bench, k988____),
+        offsetof(bench, k989____),
+        offsetof(bench, k990____),
+        offsetof(bench, k991____),
+        offsetof(bench, s82_____.k992____),
+        offsetof(bench, s82_____.k993____),
+        offsetof(bench, s82_____.k994____),
+        offsetof(bench, s82_____.k995____),
+        offsetof(bench, s82_____.k996____),
+        offsetof(bench, s82_____.k997____),
+        offsetof(bench, s82_____.k998____),
+        offsetof(bench, s82_____.k999____),
+};
+typedef enum bench_type
+{
+        BENCH_TYPE_STRING,
+        BENCH_TYPE_INT,
+        BENCH_TYPE_FLOAT,
+        BENCH_TYPE_BOOL
+} bench_type;
+typedef struct bench_descriptor
+{
+        uint32_t name; /* Into benchnames. */
+        uint32_t length;
+        uint32_t offset; /* Of the field in bench. */
+        int id;
+        unsigned char type; /* bench_type */
+} bench_descriptor;
+typedef int (*bench_visitor)(const bench_descriptor *descriptor, const void *field, void *context);
+typedef struct bench_node
+{
+        uint32_t begin; /* Descriptors [begin, end) are under the node. */
+        uint32_t end;
+        uint32_t length; /* Of the node's name and the '.' after it. */
+} bench_node;
+static const char benchnames[] =
+        "k0______\0"
+        "k100____\0"
+        "k101____\0"
+        "k102____\0"
+        "k103____\0"
+        "k120____\0"
+        "k121____\0"
+        "k122____\0"
+        "k123____\0"
+        "k124____\0"
+        "k125____\0"
+        "k126____\0"
+        "k127____\0"
+        "k144____\0"
+        "k145____\0"
+        "k146____\0"
+        "k147____\0"
+        "k148____\0"
+        "k149____\0"
+        "k150____\0"
+        "k151____\0"
+        "k168____\0"
+        "k169____\0"
+        "k170____\0"
+        "k171____\0"
+        "k172____\0"
+        "k173____\0"
+        "k174____\0"
+        "k175____\0"
+        "k192____\0"
+        "k193____\0"
+        "k194____\0"
+        "k195____\0"
+        "k196____\0"
+        "k197____\0"
+        "k198____\0"
+        "k199____\0"
+        "k1______\0"
+        "k216____\0"
+        "k217____\0"
+        "k218____\0"
+        "k219____\0"
+        "k220____\0"
+        "k221____\0"
+        "k222____\0"
+        "k223____\0"
+        "k240____\0"
+        "k241____\0"
+        "k242____\0"
+        "k243____\0"
+        "k244____\0"
+        "k245____\0"
+        "k246____\0"
+        "k247____\0"
+        "k24_____\0"
+        "k25_____\0"
+        "k264____\0"
+        "k265____\0"
+        "k266____\0"
+        "k267____\0"
+        "k268____\0"
+        "k269____\0"
+        "k26_____\0"
+        "k270____\0"
+        "k271____\0"
+        "k27_____\0"
+        "k288____\0"
+        "k289____\0"
+        "k28_____\0"
+        "k290____\0"
+        "k291____\0"
+        "k292____\0"
+        "k293____\0"
+        "k294____\0"
+        "k295____\0"
+        "k29_____\0"
+        "k2______\0"
+        "k30_____\0"
+        "k312____\0"
+        "k313____\0"
+        "k314____\0"
+        "k315____\0"
+        "k316____\0"
+        "k317____\0"
+        "k318____\0"
+        "k319____\0"
+        "k31_____\0"
+        "k336____\0"
+        "k337____\0"
+        "k338____\0"
+        "k339____\0"
+        "k340____\0"
+        "k341____\0"
+        "k342____\0"
+        "k343____\0"
+        "k360____\0"
+        "k361____\0"
+        "k362____\0"
+        "k363____\0"
+        "k364____\0"
+        "k365____\0"
+        "k366____\0"
+        "k367____\0"
+        "k384____\0"
+        "k385____\0"
+        "k386____\0"
+        "k387____\0"
+        "k388____\0"
+        "k389____\0"
+        "k390____\0"
+        "k391____\0"
+        "k3______\0"
+        "k408____\0"
+        "k409____\0"
+        "k410____\0"
+        "k411____\0"
+        "k412____\0"
+        "k413____\0"
+        "k414____\0"
+        "k415____\0"
+        "k432____\0"
+        "k433____\0"
+        "k434____\0"
+        "k435____\0"
+        "k436____\0"
+        "k437____\0"
+        "k438____\0"
+        "k439____\0"
+        "k456____\0"
+        "k457____\0"
+        "k458____\0"
+        "k459____\0"
+        "k460____\0"
+        "k461____\0"
+        "k462____\0"
+        "k463____\0"
+        "k480____\0"
+        "k481____\0"
+        "k482____\0"
+        "k483____\0"
+        "k484____\0"
+        "k485____\0"
+        "k486____\0"
+        "k487____\0"
+        "k48_____\0"
+        "k49_____\0"
+        "k4______\0"
+        "k504____\0"
+        "k505____\0"
+        "k506____\0"
+        "k507____\0"
+        "k508____\0"
+        "k509____\0"
+        "k50_____\0"
+        "k510____\0"
+        "k511____\0"
+        "k51_____\0"
+        "k528____\0"
+        "k529____\0"
+        "k52_____\0"
+        "k530____\0"
+        "k531____\0"
+        "k532____\0"
+        "k533____\0"
+        "k534____\0"
+        "k535____\0"
+        "k53_____\0"
+        "k54_____\0"
+        "k552____\0"
+        "k553____\0"
+        "k554____\0"
+        "k555____\0"
+        "k556____\0"
+        "k557____\0"
+        "k558____\0"
+        "k559____\0"
+        "k55_____\0"
+        "k576____\0"
+        "k577____\0"
+        "k578____\0"
+        "k579____\0"
+        "k580____\0"
+        "k581____\0"
+        "k582____\0"
+        "k583____\0"
+        "k5______\0"
+        "k600____\0"
+        "k601____\0"
+        "k602____\0"
+        "k603____\0"
+        "k604____\0"
+        "k605____\0"
+        "k606____\0"
+        "k607____\0"
+        "k624____\0"
+        "k625____\0"
+        "k626____\0"
+        "k627____\0"
+        "k628____\0"
+        "k629____\0"
+        "k630____\0"
+        "k631____\0"
+        "k648____\0"
+        "k649____\0"
+        "k650____\0"
+        "k651____\0"
+        "k652____\0"
+        "k653____\0"
+        "k654____\0"
+        "k655____\0"
+        "k672____\0"
+        "k673____\0"
+        "k674____\0"
+        "k675____\0"
+        "k676____\0"
+        "k677____\0"
+        "k678____\0"
+        "k679____\0"
+        "k696____\0"
+        "k697____\0"
+        "k698____\0"
+        "k699____\0"
+        "k6______\0"
+        "k700____\0"
+        "k701____\0"
+        "k702____\0"
+        "k703____\0"
+        "k720____\0"
+        "k721____\0"
+        "k722____\0"
+        "k723____\0"
+        "k724____\0"
+        "k725____\0"
+        "k726____\0"
+        "k727____\0"
+        "k72_____\0"
+        "k73_____\0"
+        "k744____\0"
+        "k745____\0"
+        "k746____\0"
+        "k747____\0"
+        "k748____\0"
+        "k749____\0"
+        "k74_____\0"
+        "k750____\0"
+        "k751____\0"
+        "k75_____\0"
+        "k768____\0"
+        "k769____\0"
+        "k76_____\0"
+        "k770____\0"
+        "k771____\0"
+        "k772____\0"
+        "k773____\0"
+        "k774____\0"
+        "k775____\0"
+        "k77_____\0"
+        "k78_____\0"
+        "k792____\0"
+        "k793____\0"
+        "k794____\0"
+        "k795____\0"
+        "k796____\0"
+        "k797____\0"
+        "k798____\0"
+        "k799____\0"
+        "k79_____\0"
+        "k7______\0"
+        "k816____\0"
+        "k817____\0"
+        "k818____\0"
+        "k819____\0"
+        "k820____\0"
+        "k821____\0"
+        "k822____\0"
+        "k823____\0"
+        "k840____\0"
+        "k841____\0"
+        "k842____\0"
+        "k843____\0"
+        "k844____\0"
+        "k845____\0"
+        "k846____\0"
+        "k847____\0"
+        "k864____\0"
+        "k865____\0"
+        "k866____\0"
+        "k867____\0"
+        "k868____\0"
+        "k869____\0"
+        "k870____\0"
+        "k871____\0"
+        "k888____\0"
+        "k889____\0"
+        "k890____\0"
+        "k891____\0"
+        "k892____\0"
+        "k893____\0"
+        "k894____\0"
+        "k895____\0"
+        "k912____\0"
+        "k913____\0"
+        "k914____\0"
+        "k915____\0"
+        "k916____\0"
+        "k917____\0"
+        "k918____\0"
+        "k919____\0"
+        "k936____\0"
+        "k937____\0"
+        "k938____\0"
+        "k939____\0"
+        "k940____\0"
+        "k941____\0"
+        "k942____\0"
+        "k943____\0"
+        "k960____\0"
+        "k961____\0"
+        "k962____\0"
+        "k963____\0"
+        "k964____\0"
+        "k965____\0"
+        "k966____\0"
+        "k967____\0"
+        "k96_____\0"
+        "k97_____\0"
+        "k984____\0"
+        "k985____\0"
+        "k986____\0"
+        "k987____\0"
+        "k988____\0"
+        "k989____\0"
+        "k98_____\0"
+        "k990____\0"
+        "k991____\0"
+        "k99_____\0"
+        "s0______.k10_____\0"
+        "s0______.k11_____\0"
+        "s0______.k12_____\0"
+        "s0______.k13_____\0"
+        "s0______.k14_____\0"
+        "s0______.k15_____\0"
+        "s0______.k8______\0"
+        "s0______.k9______\0"
+        "s0______.s1______.k16_____\0"
+        "s0______.s1______.k17_____\0"
+        "s0______.s1______.k18_____\0"
+        "s0______.s1______.k19_____\0"
+        "s0______.s1______.k20_____\0"
+        "s0______.s1______.k21_____\0"
+        "s0______.s1______.k22_____\0"
+        "s0______.s1______.k23_____\0"
+        "s10_____.k128____\0"
+        "s10_____.k129____\0"
+        "s10_____.k130____\0"
+        "s10_____.k131____\0"
+        "s10_____.k132____\0"
+        "s10_____.k133____\0"
+        "s10_____.k134____\0"
+        "s10_____.k135____\0"
+        "s10_____.s11_____.k136____\0"
+        "s10_____.s11_____.k137____\0"
+        "s10_____.s11_____.k138____\0"
+        "s10_____.s11_____.k139____\0"
+        "s10_____.s11_____.k140____\0"
+        "s10_____.s11_____.k141____\0"
+        "s10_____.s11_____.k142____\0"
+        "s10_____.s11_____.k143____\0"
+        "s12_____.k152____\0"
+        "s12_____.k153____\0"
+        "s12_____.k154____\0"
+        "s12_____.k155____\0"
+        "s12_____.k156____\0"
+        "s12_____.k157____\0"
+        "s12_____.k158____\0"
+        "s12_____.k159____\0"
+        "s12_____.s13_____.k160____\0"
+        "s12_____.s13_____.k161____\0"
+        "s12_____.s13_____.k162____\0"
+        "s12_____.s13_____.k163____\0"
+        "s12_____.s13_____.k164____\0"
+        "s12_____.s13_____.k165____\0"
+        "s12_____.s13_____.k166____\0"
+        "s12_____.s13_____.k167____\0"
+        "s14_____.k176____\0"
+        "s14_____.k177____\0"
+        "s14_____.k178____\0"
+        "s14_____.k179____\0"
+        "s14_____.k180____\0"
+        "s14_____.k181____\0"
+        "s14_____.k182____\0"
+        "s14_____.k183____\0"
+        "s14_____.s15_____.k184____\0"
+        "s14_____.s15_____.k185____\0"
+        "s14_____.s15_____.k186____\0"
+        "s14_____.s15_____.k187____\0"
+        "s14_____.s15_____.k188____\0"
+        "s14_____.s15_____.k189____\0"
+        "s14_____.s15_____.k190____\0"
+        "s14_____.s15_____.k191____\0"
+        "s16_____.k200____\0"
+        "s16_____.k201____\0"
+        "s16_____.k202____\0"
+        "s16_____.k203____\0"
+        "s16_____.k204____\0"
+        "s16_____.k205____\0"
+        "s16_____.k206____\0"
+        "s16_____.k207____\0"
+        "s16_____.s17_____.k208____\0"
+        "s16_____.s17_____.k209____\0"
+        "s16_____.s17_____.k210____\0"
+        "s16_____.s17_____.k211____\0"
+        "s16_____.s17_____.k212____\0"
+        "s16_____.s17_____.k213____\0"
+        "s16_____.s17_____.k214____\0"
+        "s16_____.s17_____.k215____\0"
+        "s18_____.k224____\0"
+        "s18_____.k225____\0"
+        "s18_____.k226____\0"
+        "s18_____.k227____\0"
+        "s18_____.k228____\0"
+        "s18_____.k229____\0"
+        "s18_____.k230____\0"
+        "s18_____.k231____\0"
+        "s18_____.s19_____.k232____\0"
+        "s18_____.s19_____.k233____\0"
+        "s18_____.s19_____.k234____\0"
+        "s18_____.s19_____.k235____\0"
+        "s18_____.s19_____.k236____\0"
+        "s18_____.s19_____.k237____\0"
+        "s18_____.s19_____.k238____\0"
+        "s18_____.s19_____.k239____\0"
+        "s20_____.k248____\0"
+        "s20_____.k249____\0"
+        "s20_____.k250____\0"
+        "s20_____.k251____\0"
+        "s20_____.k252____\0"
+        "s20_____.k253____\0"
+        "s20_____.k254____\0"
+        "s20_____.k255____\0"
+        "s20_____.s21_____.k256____\0"
+        "s20_____.s21_____.k257____\0"
+        "s20_____.s21_____.k258____\0"
+        "s20_____.s21_____.k259____\0"
+        "s20_____.s21_____.k260____\0"
+        "s20_____.s21_____.k261____\0"
+        "s20_____.s21_____.k262____\0"
+        "s20_____.s21_____.k263____\0"
+        "s22_____.k272____\0"
+        "s22_____.k273____\0"
+        "s22_____.k274____\0"
+        "s22_____.k275____\0"
+        "s22_____.k276____\0"
+        "s22_____.k277____\0"
+        "s22_____.k278____\0"
+        "s22_____.k279____\0"
+        "s22_____.s23_____.k280____\0"
+        "s22_____.s23_____.k281____\0"
+        "s22_____.s23_____.k282____\0"
+        "s22_____.s23_____.k283____\0"
+        "s22_____.s23_____.k284____\0"
+        "s22_____.s23_____.k285____\0"
+        "s22_____.s23_____.k286____\0"
+        "s22_____.s23_____.k287____\0"
+        "s24_____.k296____\0"
+        "s24_____.k297____\0"
+        "s24_____.k298____\0"
+        "s24_____.k299____\0"
+        "s24_____.k300____\0"
+        "s24_____.k301____\0"
+        "s24_____.k302____\0"
+        "s24_____.k303____\0"
+        "s24_____.s25_____.k304____\0"
+        "s24_____.s25_____.k305____\0"
+        "s24_____.s25_____.k306____\0"
+        "s24_____.s25_____.k307____\0"
+        "s24_____.s25_____.k308____\0"
+        "s24_____.s25_____.k309____\0"
+        "s24_____.s25_____.k310____\0"
+        "s24_____.s25_____.k311____\0"
+        "s26_____.k320____\0"
+        "s26_____.k321____\0"
+        "s26_____.k322____\0"
+        "s26_____.k323____\0"
+        "s26_____.k324____\0"
+        "s26_____.k325____\0"
+        "s26_____.k326____\0"
+        "s26_____.k327____\0"
+        "s26_____.s27_____.k328____\0"
+        "s26_____.s27_____.k329____\0"
+        "s26_____.s27_____.k330____\0"
+        "s26_____.s27_____.k331____\0"
+        "s26_____.s27_____.k332____\0"
+        "s26_____.s27_____.k333____\0"
+        "s26_____.s27_____.k334____\0"
+        "s26_____.s27_____.k335____\0"
+        "s28_____.k344____\0"
+        "s28_____.k345____\0"
+        "s28_____.k346____\0"
+        "s28_____.k347____\0"
+        "s28_____.k348____\0"
+        "s28_____.k349____\0"
+        "s28_____.k350____\0"
+        "s28_____.k351____\0"
+        "s28_____.s29_____.k352____\0"
+        "s28_____.s29_____.k353____\0"
+        "s28_____.s29_____.k354____\0"
+        "s28_____.s29_____.k355____\0"
+        "s28_____.s29_____.k356____\0"
+        "s28_____.s29_____.k357____\0"
+        "s28_____.s29_____.k358____\0"
+        "s28_____.s29_____.k359____\0"
+        "s2______.k32_____\0"
+        "s2______.k33_____\0"
+        "s2______.k34_____\0"
+        "s2______.k35_____\0"
+        "s2______.k36_____\0"
+        "s2______.k37_____\0"
+        "s2______.k38_____\0"
+        "s2______.k39_____\0"
+        "s2______.s3______.k40_____\0"
+        "s2______.s3______.k41_____\0"
+        "s2______.s3______.k42_____\0"
+        "s2______.s3______.k43_____\0"
+        "s2______.s3______.k44_____\0"
+        "s2______.s3______.k45_____\0"
+        "s2______.s3______.k46_____\0"
+        "s2______.s3______.k47_____\0"
+        "s30_____.k368____\0"
+        "s30_____.k369____\0"
+        "s30_____.k370____\0"
+        "s30_____.k371____\0"
+        "s30_____.k372____\0"
+        "s30_____.k373____\0"
+        "s30_____.k374____\0"
+        "s30_____.k375____\0"
+        "s30_____.s31_____.k376____\0"
+        "s30_____.s31_____.k377____\0"
+        "s30_____.s31_____.k378____\0"
+        "s30_____.s31_____.k379____\0"
+        "s30_____.s31_____.k380____\0"
+        "s30_____.s31_____.k381____\0"
+        "s30_____.s31_____.k382____\0"
+        "s30_____.s31_____.k383____\0"
+        "s32_____.k392____\0"
+        "s32_____.k393____\0"
+        "s32_____.k394____\0"
+        "s32_____.k395____\0"
+        "s32_____.k396____\0"
+        "s32_____.k397____\0"
+        "s32_____.k398____\0"
+        "s32_____.k399____\0"
+        "s32_____.s33_____.k400____\0"
+        "s32_____.s33_____.k401____\0"
+        "s32_____.s33_____.k402____\0"
+        "s32_____.s33_____.k403____\0"
+        "s32_____.s33_____.k404____\0"
+        "s32_____.s33_____.k405____\0"
+        "s32_____.s33_____.k406____\0"
+        "s32_____.s33_____.k407____\0"
+        "s34_____.k416____\0"
+        "s34_____.k417____\0"
+        "s34_____.k418____\0"
+        "s34_____.k419____\0"
+        "s34_____.k420____\0"
+        "s34_____.k421____\0"
+        "s34_____.k422____\0"
+        "s34_____.k423____\0"
+        "s34_____.s35_____.k424____\0"
+        "s34_____.s35_____.k425____\0"
+        "s34_____.s35_____.k426____\0"
+        "s34_____.s35_____.k427____\0"
+        "s34_____.s35_____.k428____\0"
+        "s34_____.s35_____.k429____\0"
+        "s34_____.s35_____.k430____\0"
+        "s34_____.s35_____.k431____\0"
+        "s36_____.k440____\0"
+        "s36_____.k441____\0"
+        "s36_____.k442____\0"
+        "s36_____.k443____\0"
+        "s36_____.k444____\0"
+        "s36_____.k445____\0"
+        "s36_____.k446____\0"
+        "s36_____.k447____\0"
+        "s36_____.s37_____.k448____\0"
+        "s36_____.s37_____.k449____\0"
+        "s36_____.s37_____.k450____\0"
+        "s36_____.s37_____.k451____\0"
+        "s36_____.s37_____.k452____\0"
+        "s36_____.s37_____.k453____\0"
+        "s36_____.s37_____.k454____\0"
+        "s36_____.s37_____.k455____\0"
+        "s38_____.k464____\0"
+        "s38_____.k465____\0"
+        "s38_____.k466____\0"
+        "s38_____.k467____\0"
+        "s38_____.k468____\0"
+        "s38_____.k469____\0"
+        "s38_____.k470____\0"
+        "s38_____.k471____\0"
+        "s38_____.s39_____.k472____\0"
+        "s38_____.s39_____.k473____\0"
+        "s38_____.s39_____.k474____\0"
+        "s38_____.s39_____.k475____\0"
+        "s38_____.s39_____.k476____\0"
+        "s38_____.s39_____.k477____\0"
+        "s38_____.s39_____.k478____\0"
+        "s38_____.s39_____.k479____\0"
+        "s40_____.k488____\0"
+        "s40_____.k489____\0"
+        "s40_____.k490____\0"
+        "s40_____.k491____\0"
+        "s40_____.k492____\0"
+        "s40_____.k493____\0"
+        "s40_____.k494____\0"
+        "s40_____.k495____\0"
+        "s40_____.s41_____.k496____\0"
+        "s40_____.s41_____.k497____\0"
+        "s40_____.s41_____.k498____\0"
+        "s40_____.s41_____.k499____\0"
+        "s40_____.s41_____.k500____\0"
+        "s40_____.s41_____.k501____\0"
+        "s40_____.s41_____.k502____\0"
+        "s40_____.s41_____.k503____\0"
+        "s42_____.k512____\0"
+        "s42_____.k513____\0"
+        "s42_____.k514____\0"
+        "s42_____.k515____\0"
+        "s42_____.k516____\0"
+        "s42_____.k517____\0"
+        "s42_____.k518____\0"
+        "s42_____.k519____\0"
+        "s42_____.s43_____.k520____\0"
+        "s42_____.s43_____.k521____\0"
+        "s42_____.s43_____.k522____\0"
+        "s42_____.s43_____.k523____\0"
+        "s42_____.s43_____.k524____\0"
+        "s42_____.s43_____.k525____\0"
+        "s42_____.s43_____.k526____\0"
+        "s42_____.s43_____.k527____\0"
+        "s44_____.k536____\0"
+        "s44_____.k537____\0"
+        "s44_____.k538____\0"
+        "s44_____.k539____\0"
+        "s44_____.k540____\0"
+        "s44_____.k541____\0"
+        "s44_____.k542____\0"
+        "s44_____.k543____\0"
+        "s44_____.s45_____.k544____\0"
+        "s44_____.s45_____.k545____\0"
+        "s44_____.s45_____.k546____\0"
+        "s44_____.s45_____.k547____\0"
+        "s44_____.s45_____.k548____\0"
+        "s44_____.s45_____.k549____\0"
+        "s44_____.s45_____.k550____\0"
+        "s44_____.s45_____.k551____\0"
+        "s46_____.k560____\0"
+        "s46_____.k561____\0"
+        "s46_____.k562____\0"
+        "s46_____.k563____\0"
+        "s46_____.k564____\0"
+        "s46_____.k565____\0"
+        "s46_____.k566____\0"
+        "s46_____.k567____\0"
+        "s46_____.s47_____.k568____\0"
+        "s46_____.s47_____.k569____\0"
+        "s46_____.s47_____.k570____\0"
+        "s46_____.s47_____.k571____\0"
+        "s46_____.s47_____.k572____\0"
+        "s46_____.s47_____.k573____\0"
+        "s46_____.s47_____.k574____\0"
+        "s46_____.s47_____.k575____\0"
+        "s48_____.k584____\0"
+        "s48_____.k585____\0"
+        "s48_____.k586____\0"
+        "s48_____.k587____\0"
+        "s48_____.k588____\0"
+        "s48_____.k589____\0"
+        "s48_____.k590____\0"
+        "s48_____.k591____\0"
+        "s48_____.s49_____.k592____\0"
+        "s48_____.s49_____.k593____\0"
+        "s48_____.s49_____.k594____\0"
+        "s48_____.s49_____.k595____\0"
+        "s48_____.s49_____.k596____\0"
+        "s48_____.s49_____.k597____\0"
+        "s48_____.s49_____.k598____\0"
+        "s48_____.s49_____.k599____\0"
+        "s4______.k56_____\0"
+        "s4______.k57_____\0"
+        "s4______.k58_____\0"
+        "s4______.k59_____\0"
+        "s4______.k60_____\0"
+        "s4______.k61_____\0"
+        "s4______.k62_____\0"
+        "s4______.k63_____\0"
+        "s4______.s5______.k64_____\0"
+        "s4______.s5______.k65_____\0"
+        "s4______.s5______.k66_____\0"
+        "s4______.s5______.k67_____\0"
+        "s4______.s5______.k68_____\0"
+        "s4______.s5______.k69_____\0"
+        "s4______.s5______.k70_____\0"
+        "s4______.s5______.k71_____\0"
+        "s50_____.k608____\0"
+        "s50_____.k609____\0"
+        "s50_____.k610____\0"
+        "s50_____.k611____\0"
+        "s50_____.k612____\0"
+        "s50_____.k613____\0"
+        "s50_____.k614____\0"
+        "s50_____.k615____\0"
+        "s50_____.s51_____.k616____\0"
+        "s50_____.s51_____.k617____\0"
+        "s50_____.s51_____.k618____\0"
+        "s50_____.s51_____.k619____\0"
+        "s50_____.s51_____.k620____\0"
+        "s50_____.s51_____.k621____\0"
+        "s50_____.s51_____.k622____\0"
+        "s50_____.s51_____.k623____\0"
+        "s52_____.k632____\0"
+        "s52_____.k633____\0"
+        "s52_____.k634____\0"
+        "s52_____.k635____\0"
+        "s52_____.k636____\0"
+        "s52_____.k637____\0"
+        "s52_____.k638____\0"
+        "s52_____.k639____\0"
+        "s52_____.s53_____.k640____\0"
+        "s52_____.s53_____.k641____\0"
+        "s52_____.s53_____.k642____\0"
+        "s52_____.s53_____.k643____\0"
+        "s52_____.s53_____.k644____\0"
+        "s52_____.s53_____.k645____\0"
+        "s52_____.s53_____.k646____\0"
+        "s52_____.s53_____.k647____\0"
+        "s54_____.k656____\0"
+        "s54_____.k657____\0"
+        "s54_____.k658____\0"
+        "s54_____.k659____\0"
+        "s54_____.k660____\0"
+        "s54_____.k661____\0"
+        "s54_____.k662____\0"
+        "s54_____.k663____\0"
+        "s54_____.s55_____.k664____\0"
+        "s54_____.s55_____.k665____\0"
+        "s54_____.s55_____.k666____\0"
+        "s54_____.s55_____.k667____\0"
+        "s54_____.s55_____.k668____\0"
+        "s54_____.s55_____.k669____\0"
+        "s54_____.s55_____.k670____\0"
+        "s54_____.s55_____.k671____\0"
+        "s56_____.k680____\0"
+        "s56_____.k681____\0"
+        "s56_____.k682____\0"
+        "s56_____.k683____\0"
+        "s56_____.k684____\0"
+        "s56_____.k685____\0"
+        "s56_____.k686____\0"
+        "s56_____.k687____\0"
+        "s56_____.s57_____.k688____\0"
+        "s56_____.s57_____.k689____\0"
+        "s56_____.s57_____.k690____\0"
+        "s56_____.s57_____.k691____\0"
+        "s56_____.s57_____.k692____\0"
+        "s56_____.s57_____.k693____\0"
+        "s56_____.s57_____.k694____\0"
+        "s56_____.s57_____.k695____\0"
+        "s58_____.k704____\0"
+        "s58_____.k705____\0"
+        "s58_____.k706____\0"
+        "s58_____.k707____\0"
+        "s58_____.k708____\0"
+        "s58_____.k709____\0"
+        "s58_____.k710____\0"
+        "s58_____.k711____\0"
+        "s58_____.s59_____.k712____\0"
+        "s58_____.s59_____.k713____\0"
+        "s58_____.s59_____.k714____\0"
+        "s58_____.s59_____.k715____\0"
+        "s58_____.s59_____.k716____\0"
+        "s58_____.s59_____.k717____\0"
+        "s58_____.s59_____.k718____\0"
+        "s58_____.s59_____.k719____\0"
+        "s60_____.k728____\0"
+        "s60_____.k729____\0"
+        "s60_____.k730____\0"
+        "s60_____.k731____\0"
+        "s60_____.k732____\0"
+        "s60_____.k733____\0"
+        "s60_____.k734____\0"
+        "s60_____.k735____\0"
+        "s60_____.s61_____.k736____\0"
+        "s60_____.s61_____.k737____\0"
+        "s60_____.s61_____.k738____\0"
+        "s60_____.s61_____.k739____\0"
+        "s60_____.s61_____.k740____\0"
+        "s60_____.s61_____.k741____\0"
+        "s60_____.s61_____.k742____\0"
+        "s60_____.s61_____.k743____\0"
+        "s62_____.k752____\0"
+        "s62_____.k753____\0"
+        "s62_____.k754____\0"
+        "s62_____.k755____\0"
+        "s62_____.k756____\0"
+        "s62_____.k757____\0"
+        "s62_____.k758____\0"
+        "s62_____.k759____\0"
+        "s62_____.s63_____.k760____\0"
+        "s62_____.s63_____.k761____\0"
+        "s62_____.s63_____.k762____\0"
+        "s62_____.s63_____.k763____\0"
+        "s62_____.s63_____.k764____\0"
+        "s62_____.s63_____.k765____\0"
+        "s62_____.s63_____.k766____\0"
+        "s62_____.s63_____.k767____\0"
+        "s64_____.k776____\0"
+        "s64_____.k777____\0"
+        "s64_____.k778____\0"
+        "s64_____.k779____\0"
+        "s64_____.k780____\0"
+        "s64_____.k781____\0"
+        "s64_____.k782____\0"
+        "s64_____.k783____\0"
+        "s64_____.s65_____.k784____\0"
+        "s64_____.s65_____.k785____\0"
+        "s64_____.s65_____.k786____\0"
+        "s64_____.s65_____.k787____\0"
+        "s64_____.s65_____.k788____\0"
+        "s64_____.s65_____.k789____\0"
+        "s64_____.s65_____.k790____\0"
+        "s64_____.s65_____.k791____\0"
+        "s66_____.k800____\0"
+        "s66_____.k801____\0"
+        "s66_____.k802____\0"
+        "s66_____.k803____\0"
+        "s66_____.k804____\0"
+        "s66_____.k805____\0"
+        "s66_____.k806____\0"
+        "s66_____.k807____\0"
+        "s66_____.s67_____.k808____\0"
+        "s66_____.s67_____.k809____\0"
+        "s66_____.s67_____.k810____\0"
+        "s66_____.s67_____.k811____\0"
+        "s66_____.s67_____.k812____\0"
+        "s66_____.s67_____.k813____\0"
+        "s66_____.s67_____.k814____\0"
+        "s66_____.s67_____.k815____\0"
+        "s68_____.k824____\0"
+        "s68_____.k825____\0"
+        "s68_____.k826____\0"
+        "s68_____.k827____\0"
+        "s68_____.k828____\0"
+        "s68_____.k829____\0"
+        "s68_____.k830____\0"
+        "s68_____.k831____\0"
+        "s68_____.s69_____.k832____\0"
+        "s68_____.s69_____.k833____\0"
+        "s68_____.s69_____.k834____\0"
+        "s68_____.s69_____.k835____\0"
+        "s68_____.s69_____.k836____\0"
+        "s68_____.s69_____.k837____\0"
+        "s68_____.s69_____.k838____\0"
+        "s68_____.s69_____.k839____\0"
+        "s6______.k80_____\0"
+        "s6______.k81_____\0"
+        "s6______.k82_____\0"
+        "s6______.k83_____\0"
+        "s6______.k84_____\0"
+        "s6______.k85_____\0"
+        "s6______.k86_____\0"
+        "s6______.k87_____\0"
+        "s6______.s7______.k88_____\0"
+        "s6______.s7______.k89_____\0"
+        "s6______.s7______.k90_____\0"
+        "s6______.s7______.k91_____\0"
+        "s6______.s7______.k92_____\0"
+        "s6______.s7______.k93_____\0"
+        "s6______.s7______.k94_____\0"
+        "s6______.s7______.k95_____\0"
+        "s70_____.k848____\0"
+        "s70_____.k849____\0"
+        "s70_____.k850____\0"
+        "s70_____.k851____\0"
+        "s70_____.k852____\0"
+        "s70_____.k853____\0"
+        "s70_____.k854____\0"
+        "s70_____.k855____\0"
+        "s70_____.s71_____.k856____\0"
+        "s70_____.s71_____.k857____\0"
+        "s70_____.s71_____.k858____\0"
+        "s70_____.s71_____.k859____\0"
+        "s70_____.s71_____.k860____\0"
+        "s70_____.s71_____.k861____\0"
+        "s70_____.s71_____.k862____\0"
+        "s70_____.s71_____.k863____\0"
+        "s72_____.k872____\0"
+        "s72_____.k873____\0"
+        "s72_____.k874____\0"
+        "s72_____.k875____\0"
+        "s72_____.k876____\0"
+        "s72_____.k877____\0"
+        "s72_____.k878____\0"
+        "s72_____.k879____\0"
+        "s72_____.s73_____.k880____\0"
+        "s72_____.s73_____.k881____\0"
+        "s72_____.s73_____.k882____\0"
+        "s72_____.s73_____.k883____\0"
+        "s72_____.s73_____.k884____\0"
+        "s72_____.s73_____.k885____\0"
+        "s72_____.s73_____.k886____\0"
+        "s72_____.s73_____.k887____\0"
+        "s74_____.k896____\0"
+        "s74_____.k897____\0"
+        "s74_____.k898____\0"
+        "s74_____.k899____\0"
+        "s74_____.k900____\0"
+        "s74_____.k901____\0"
+        "s74_____.k902____\0"
+        "s74_____.k903____\0"
+        "s74_____.s75_____.k904____\0"
+        "s74_____.s75_____.k905____\0"
+        "s74_____.s75_____.k906____\0"
+        "s74_____.s75_____.k907____\0"
+        "s74_____.s75_____.k908____\0"
+        "s74_____.s75_____.k909____\0"
+        "s74_____.s75_____.k910____\0"
+        "s74_____.s75_____.k911____\0"
+        "s76_____.k920____\0"
+        "s76_____.k921____\0"
+        "s76_____.k922____\0"
+        "s76_____.k923____\0"
+        "s76_____.k924____\0"
+        "s76_____.k925____\0"
+        "s76_____.k926____\0"
+        "s76_____.k927____\0"
+        "s76_____.s77_____.k928____\0"
+        "s76_____.s77_____.k929____\0"
+        "s76_____.s77_____.k930____\0"
+        "s76_____.s77_____.k931____\0"
+        "s76_____.s77_____.k932____\0"
+        "s76_____.s77_____.k933____\0"
+        "s76_____.s77_____.k934____\0"
+        "s76_____.s77_____.k935____\0"
+        "s78_____.k944____\0"
+        "s78_____.k945____\0"
+        "s78_____.k946____\0"
+        "s78_____.k947____\0"
+        "s78_____.k948____\0"
+        "s78_____.k949____\0"
+        "s78_____.k950____\0"
+        "s78_____.k951____\0"
+        "s78_____.s79_____.k952____\0"
+        "s78_____.s79_____.k953____\0"
+        "s78_____.s79_____.k954____\0"
+        "s78_____.s79_____.k955____\0"
+        "s78_____.s79_____.k956____\0"
+        "s78_____.s79_____.k957____\0"
+        "s78_____.s79_____.k958____\0"
+        "s78_____.s79_____.k959____\0"
+        "s80_____.k968____\0"
+        "s80_____.k969____\0"
+        "s80_____.k970____\0"
+        "s80_____.k971____\0"
+        "s80_____.k972____\0"
+        "s80_____.k973____\0"
+        "s80_____.k974____\0"
+        "s80_____.k975____\0"
+        "s80_____.s81_____.k976____\0"
+        "s80_____.s81_____.k977____\0"
+        "s80_____.s81_____.k978____\0"
+        "s80_____.s81_____.k979____\0"
+        "s80_____.s81_____.k980____\0"
+        "s80_____.s81_____.k981____\0"
+        "s80_____.s81_____.k982____\0"
+        "s80_____.s81_____.k983____\0"
+        "s82_____.k992____\0"
+        "s82_____.k993____\0"
+        "s82_____.k994____\0"
+        "s82_____.k995____\0"
+        "s82_____.k996____\0"
+        "s82_____.k997____\0"
+        "s82_____.k998____\0"
+        "s82_____.k999____\0"
+        "s8______.k104____\0"
+        "s8______.k105____\0"
+        "s8______.k106____\0"
+        "s8______.k107____\0"
+        "s8______.k108____\0"
+        "s8______.k109____\0"
+        "s8______.k110____\0"
+        "s8______.k111____\0"
+        "s8______.s9______.k112____\0"
+        "s8______.s9______.k113____\0"
+        "s8______.s9______.k114____\0"
+        "s8______.s9______.k115____\0"
+        "s8______.s9______.k116____\0"
+        "s8______.s9______.k117____\0"
+        "s8______.s9______.k118____\0"
+        "s8______.s9______.k119____\0";
+#define benchname(descriptor) (benchnames + (descriptor)->name)
+static const bench_descriptor benchdescriptors[BENCH_KEY_COUNT] =
+{
+        { 0, 8, offsetof(bench, k0______), BENCH_K0______, BENCH_TYPE_STRING },
+        { 9, 8, offsetof(bench, k100____), BENCH_K100____, BENCH_TYPE_STRING },
+        { 18, 8, offsetof(bench, k101____), BENCH_K101____, BENCH_TYPE_STRING },
+        { 27, 8, offsetof(bench, k102____), BENCH_K102____, BENCH_TYPE_STRING },
+        { 36, 8, offsetof(bench, k103____), BENCH_K103____, BENCH_TYPE_STRING },
+        { 45, 8, offsetof(bench, k120____), BENCH_K120____, BENCH_TYPE_STRING },
+        { 54, 8, offsetof(bench, k121____), BENCH_K121____, BENCH_TYPE_STRING },
+        { 63, 8, offsetof(bench, k122____), BENCH_K122____, BENCH_TYPE_STRING },
+        { 72, 8, offsetof(bench, k123____), BENCH_K123____, BENCH_TYPE_STRING },
+        { 81, 8, offsetof(bench, k124____), BENCH_K124____, BENCH_TYPE_STRING },
+        { 90, 8, offsetof(bench, k125____), BENCH_K125____, BENCH_TYPE_STRING },
+        { 99, 8, offsetof(bench, k126____), BENCH_K126____, BENCH_TYPE_STRING },
+        { 108, 8, offsetof(bench, k127____), BENCH_K127____, BENCH_TYPE_STRING },
+        { 117, 8, offsetof(bench, k144____), BENCH_K144____, BENCH_TYPE_STRING },
+        { 126, 8, offsetof(bench, k145____), BENCH_K145____, BENCH_TYPE_STRING },
+        { 135, 8, offsetof(bench, k146____), BENCH_K146____, BENCH_TYPE_STRING },
+        { 144, 8, offsetof(bench, k147____), BENCH_K147____, BENCH_TYPE_STRING },
+        { 153, 8, offsetof(bench, k148____), BENCH_K148____, BENCH_TYPE_STRING },
+        { 162, 8, offsetof(bench, k149____), BENCH_K149____, BENCH_TYPE_STRING },
+        { 171, 8, offsetof(bench, k150____), BENCH_K150____, BENCH_TYPE_STRING },
+        { 180, 8, offsetof(bench, k151____), BENCH_K151____, BENCH_TYPE_STRING },
+        { 189, 8, offsetof(bench, k168____), BENCH_K168____, BENCH_TYPE_STRING },
+        { 198, 8, offsetof(bench, k169____), BENCH_K169____, BENCH_TYPE_STRING },
+        { 207, 8, offsetof(bench, k170____), BENCH_K170____, BENCH_TYPE_STRING },
+        { 216, 8, offsetof(bench, k171____), BENCH_K171____, BENCH_TYPE_STRING },
+        { 225, 8, offsetof(bench, k172____), BENCH_K172____, BENCH_TYPE_STRING },
+        { 234, 8, offsetof(bench, k173____), BENCH_K173____, BENCH_TYPE_STRING },
+        { 243, 8, offsetof(bench, k174____), BENCH_K174____, BENCH_TYPE_STRING },
+        { 252, 8, offsetof(bench, k175____), BENCH_K175____, BENCH_TYPE_STRING },
+        { 261, 8, offsetof(bench, k192____), BENCH_K192____, BENCH_TYPE_STRING },
+        { 270, 8, offsetof(bench, k193____), BENCH_K193____, BENCH_TYPE_STRING },
+        { 279, 8, offsetof(bench, k194____), BENCH_K194____, BENCH_TYPE_STRING },
+        { 288, 8, offsetof(bench, k195____), BENCH_K195____, BENCH_TYPE_STRING },
+        { 297, 8, offsetof(bench, k196____), BENCH_K196____, BENCH_TYPE_STRING },
+        { 306, 8, offsetof(bench, k197____), BENCH_K197____, BENCH_TYPE_STRING },
+        { 315, 8, offsetof(bench, k198____), BENCH_K198____, BENCH_TYPE_STRING },
+        { 324, 8, offsetof(bench, k199____), BENCH_K199____, BENCH_TYPE_STRING },
+        { 333, 8, offsetof(bench, k1______), BENCH_K1______, BENCH_TYPE_STRING },
+        { 342, 8, offsetof(bench, k216____), BENCH_K216____, BENCH_TYPE_STRING },
+        { 351, 8, offsetof(bench, k217____), BENCH_K217____, BENCH_TYPE_STRING },
+        { 360, 8, offsetof(bench, k218____), BENCH_K218____, BENCH_TYPE_STRING },
+        { 369, 8, offsetof(bench, k219____), BENCH_K219____, BENCH_TYPE_STRING },
+        { 378, 8, offsetof(bench, k220____), BENCH_K220____, BENCH_TYPE_STRING },
+        { 387, 8, offsetof(bench, k221____), BENCH_K221____, BENCH_TYPE_STRING },
+        { 396, 8, offsetof(bench, k222____), BENCH_K222____, BENCH_TYPE_STRING },
+        { 405, 8, offsetof(bench, k223____), BENCH_K223____, BENCH_TYPE_STRING },
+        { 414, 8, offsetof(bench, k240____), BENCH_K240____, BENCH_TYPE_STRING },
+        { 423, 8, offsetof(bench, k241____), BENCH_K241____, BENCH_TYPE_STRING },
+        { 432, 8, offsetof(bench, k242____), BENCH_K242____, BENCH_TYPE_STRING },
+        { 441, 8, offsetof(bench, k243____), BENCH_K243____, BENCH_TYPE_STRING },
+        { 450, 8, offsetof(bench, k244____), BENCH_K244____, BENCH_TYPE_STRING },
+        { 459, 8, offsetof(bench, k245____), BENCH_K245____, BENCH_TYPE_STRING },
+        { 468, 8, offsetof(bench, k246____), BENCH_K246____, BENCH_TYPE_STRING },
+        { 477, 8, offsetof(bench, k247____), BENCH_K247____, BENCH_TYPE_STRING },
+        { 486, 8, offsetof(bench, k24_____), BENCH_K24_____, BENCH_TYPE_STRING },
+        { 495, 8, offsetof(bench, k25_____), BENCH_K25_____, BENCH_TYPE_STRING },
+        { 504, 8, offsetof(bench, k264____), BENCH_K264____, BENCH_TYPE_STRING },
+        { 513, 8, offsetof(bench, k265____), BENCH_K265____, BENCH_TYPE_STRING },
+        { 522, 8, offsetof(bench, k266____), BENCH_K266____, BENCH_TYPE_STRING },
+        { 531, 8, offsetof(bench, k267____), BENCH_K267____, BENCH_TYPE_STRING },
+        { 540, 8, offsetof(bench, k268____), BENCH_K268____, BENCH_TYPE_STRING },
+        { 549, 8, offsetof(bench, k269____), BENCH_K269____, BENCH_TYPE_STRING },
+        { 558, 8, offsetof(bench, k26_____), BENCH_K26_____, BENCH_TYPE_STRING },
+        { 567, 8, offsetof(bench, k270____), BENCH_K270____, BENCH_TYPE_STRING },
+        { 576, 8, offsetof(bench, k271____), BENCH_K271____, BENCH_TYPE_STRING },
+        { 585, 8, offsetof(bench, k27_____), BENCH_K27_____, BENCH_TYPE_STRING },
+        { 594, 8, offsetof(bench, k288____), BENCH_K288____, BENCH_TYPE_STRING },
+        { 603, 8, offsetof(bench, k289____), BENCH_K289____, BENCH_TYPE_STRING },
+        { 612, 8, offsetof(bench, k28_____), BENCH_K28_____, BENCH_TYPE_STRING },
+        { 621, 8, offsetof(bench, k290____), BENCH_K290____, BENCH_TYPE_STRING },
+        { 630, 8, offsetof(bench, k291____), BENCH_K291____, BENCH_TYPE_STRING },
+        { 639, 8, offsetof(bench, k292____), BENCH_K292____, BENCH_TYPE_STRING },
+        { 648, 8, offsetof(bench, k293____), BENCH_K293____, BENCH_TYPE_STRING },
+        { 657, 8, offsetof(bench, k294____), BENCH_K294____, BENCH_TYPE_STRING },
+        { 666, 8, offsetof(bench, k295____), BENCH_K295____, BENCH_TYPE_STRING },
+        { 675, 8, offsetof(bench, k29_____), BENCH_K29_____, BENCH_TYPE_STRING },
+        { 684, 8, offsetof(bench, k2______), BENCH_K2______, BENCH_TYPE_STRING },
+        { 693, 8, offsetof(bench, k30_____), BENCH_K30_____, BENCH_TYPE_STRING },
+        { 702, 8, offsetof(bench, k312____), BENCH_K312____, BENCH_TYPE_STRING },
+        { 711, 8, offsetof(bench, k313____), BENCH_K313____, BENCH_TYPE_STRING },
+        { 720, 8, offsetof(bench, k314____), BENCH_K314____, BENCH_TYPE_STRING },
+        { 729, 8, offsetof(bench, k315____), BENCH_K315____, BENCH_TYPE_STRING },
+        { 738, 8, offsetof(bench, k316____), BENCH_K316____, BENCH_TYPE_STRING },
+        { 747, 8, offsetof(bench, k317____), BENCH_K317____, BENCH_TYPE_STRING },
+        { 756, 8, offsetof(bench, k318____), BENCH_K318____, BENCH_TYPE_STRING },
+        { 765, 8, offsetof(bench, k319____), BENCH_K319____, BENCH_TYPE_STRING },
+        { 774, 8, offsetof(bench, k31_____), BENCH_K31_____, BENCH_TYPE_STRING },
+        { 783, 8, offsetof(bench, k336____), BENCH_K336____, BENCH_TYPE_STRING },
+        { 792, 8, offsetof(bench, k337____), BENCH_K337____, BENCH_TYPE_STRING },
+        { 801, 8, offsetof(bench, k338____), BENCH_K338____, BENCH_TYPE_STRING },
+        { 810, 8, offsetof(bench, k339____), BENCH_K339____, BENCH_TYPE_STRING },
+        { 819, 8, offsetof(bench, k340____), BENCH_K340____, BENCH_TYPE_STRING },
+        { 828, 8, offsetof(bench, k341____), BENCH_K341____, BENCH_TYPE_STRING },
+        { 837, 8, offsetof(bench, k342____), BENCH_K342____, BENCH_TYPE_STRING },
+        { 846, 8, offsetof(bench, k343____), BENCH_K343____, BENCH_TYPE_STRING },
+        { 855, 8, offsetof(bench, k360____), BENCH_K360____, BENCH_TYPE_STRING },
+        { 864, 8, offsetof(bench, k361____), BENCH_K361____, BENCH_TYPE_STRING },
+        { 873, 8, offsetof(bench, k362____), BENCH_K362____, BENCH_TYPE_STRING },
+        { 882, 8, offsetof(bench, k363____), BENCH_K363____, BENCH_TYPE_STRING },
+        { 891, 8, offsetof(bench, k364____), BENCH_K364____, BENCH_TYPE_STRING },
+        { 900, 8, offsetof(bench, k365____), BENCH_K365____, BENCH_TYPE_STRING },
+        { 909, 8, offsetof(bench, k366____), BENCH_K366____, BENCH_TYPE_STRING },
+        { 918, 8, offsetof(bench, k367____), BENCH_K367____, BENCH_TYPE_STRING },
+        { 927, 8, offsetof(bench, k384____), BENCH_K384____, BENCH_TYPE_STRING },
+        { 936, 8, offsetof(bench, k385____), BENCH_K385____, BENCH_TYPE_STRING },
+        { 945, 8, offsetof(bench, k386____), BENCH_K386____, BENCH_TYPE_STRING },
+        { 954, 8, offsetof(bench, k387____), BENCH_K387____, BENCH_TYPE_STRING },
+        { 963, 8, offsetof(bench, k388____), BENCH_K388____, BENCH_TYPE_STRING },
+        { 972, 8, offsetof(bench, k389____), BENCH_K389____, BENCH_TYPE_STRING },
+        { 981, 8, offsetof(bench, k390____), BENCH_K390____, BENCH_TYPE_STRING },
+        { 990, 8, offsetof(bench, k391____), BENCH_K391____, BENCH_TYPE_STRING },
+        { 999, 8, offsetof(bench, k3______), BENCH_K3______, BENCH_TYPE_STRING },
+        { 1008, 8, offsetof(bench, k408____), BENCH_K408____, BENCH_TYPE_STRING },
+        { 1017, 8, offsetof(bench, k409____), BENCH_K409____, BENCH_TYPE_STRING },
+        { 1026, 8, offsetof(bench, k410____), BENCH_K410____, BENCH_TYPE_STRING },
+        { 1035, 8, offsetof(bench, k411____), BENCH_K411____, BENCH_TYPE_STRING },
+        { 1044, 8, offsetof(bench, k412____), BENCH_K412____, BENCH_TYPE_STRING },
+        { 1053, 8, offsetof(bench, k413____), BENCH_K413____, BENCH_TYPE_STRING },
+        { 1062, 8, offsetof(bench, k414____), BENCH_K414____, BENCH_TYPE_STRING },
+        { 1071, 8, offsetof(bench, k415____), BENCH_K415____, BENCH_TYPE_STRING },
+        { 1080, 8, offsetof(bench, k432____), BENCH_K432____, BENCH_TYPE_STRING },
+        { 1089, 8, offsetof(bench, k433____), BENCH_K433____, BENCH_TYPE_STRING },
+        { 1098, 8, offsetof(bench, k434____), BENCH_K434____, BENCH_TYPE_STRING },
+        { 1107, 8, offsetof(bench, k435____), BENCH_K435____, BENCH_TYPE_STRING },
+        { 1116, 8, offsetof(bench, k436____), BENCH_K436____, BENCH_TYPE_STRING },
+        { 1125, 8, offsetof(bench, k437____), BENCH_K437____, BENCH_TYPE_STRING },
+        { 1134, 8, offsetof(bench, k438____), BENCH_K438____, BENCH_TYPE_STRING },
+        { 1143, 8, offsetof(bench, k439____), BENCH_K439____, BENCH_TYPE_STRING },
+        { 1152, 8, offsetof(bench, k456____), BENCH_K456____, BENCH_TYPE_STRING },
+        { 1161, 8, offsetof(bench, k457____), BENCH_K457____, BENCH_TYPE_STRING },
+        { 1170, 8, offsetof(bench, k458____), BENCH_K458____, BENCH_TYPE_STRING },
+        { 1179, 8, offsetof(bench, k459____), BENCH_K459____, BENCH_TYPE_STRING },
+        { 1188, 8, offsetof(bench, k460____), BENCH_K460____, BENCH_TYPE_STRING },
+        { 1197, 8, offsetof(bench, k461____), BENCH_K461____, BENCH_TYPE_STRING },
+        { 1206, 8, offsetof(bench, k462____), BENCH_K462____, BENCH_TYPE_STRING },
+        { 1215, 8, offsetof(bench, k463____), BENCH_K463____, BENCH_TYPE_STRING },
+        { 1224, 8, offsetof(bench, k480____), BENCH_K480____, BENCH_TYPE_STRING },
+        { 1233, 8, offsetof(bench, k481____), BENCH_K481____, BENCH_TYPE_STRING },
+        { 1242, 8, offsetof(bench, k482____), BENCH_K482____, BENCH_TYPE_STRING },
+        { 1251, 8, offsetof(bench, k483____), BENCH_K483____, BENCH_TYPE_STRING },
+        { 1260, 8, offsetof(bench, k484____), BENCH_K484____, BENCH_TYPE_STRING },
+        { 1269, 8, offsetof(bench, k485____), BENCH_K485____, BENCH_TYPE_STRING },
+        { 1278, 8, offsetof(bench, k486____), BENCH_K486____, BENCH_TYPE_STRING },
+        { 1287, 8, offsetof(bench, k487____), BENCH_K487____, BENCH_TYPE_STRING },
+        { 1296, 8, offsetof(bench, k48_____), BENCH_K48_____, BENCH_TYPE_STRING },
+        { 1305, 8, offsetof(bench, k49_____), BENCH_K49_____, BENCH_TYPE_STRING },
+        { 1314, 8, offsetof(bench, k4______), BENCH_K4______, BENCH_TYPE_STRING },
+        { 1323, 8, offsetof(bench, k504____), BENCH_K504____, BENCH_TYPE_STRING },
+        { 1332, 8, offsetof(bench, k505____), BENCH_K505____, BENCH_TYPE_STRING },
+        { 1341, 8, offsetof(bench, k506____), BENCH_K506____, BENCH_TYPE_STRING },
+        { 1350, 8, offsetof(bench, k507____), BENCH_K507____, BENCH_TYPE_STRING },
+        { 1359, 8, offsetof(bench, k508____), BENCH_K508____, BENCH_TYPE_STRING },
+        { 1368, 8, offsetof(bench, k509____), BENCH_K509____, BENCH_TYPE_STRING },
+        { 1377, 8, offsetof(bench, k50_____), BENCH_K50_____, BENCH_TYPE_STRING },
+        { 1386, 8, offsetof(bench, k510____), BENCH_K510____, BENCH_TYPE_STRING },
+        { 1395, 8, offsetof(bench, k511____), BENCH_K511____, BENCH_TYPE_STRING },
+        { 1404, 8, offsetof(bench, k51_____), BENCH_K51_____, BENCH_TYPE_STRING },
+        { 1413, 8, offsetof(bench, k528____), BENCH_K528____, BENCH_TYPE_STRING },
+        { 1422, 8, offsetof(bench, k529____), BENCH_K529____, BENCH_TYPE_STRING },
+        { 1431, 8, offsetof(bench, k52_____), BENCH_K52_____, BENCH_TYPE_STRING },
+        { 1440, 8, offsetof(bench, k530____), BENCH_K530____, BENCH_TYPE_STRING },
+        { 1449, 8, offsetof(bench, k531____), BENCH_K531____, BENCH_TYPE_STRING },
+        { 1458, 8, offsetof(bench, k532____), BENCH_K532____, BENCH_TYPE_STRING },
+        { 1467, 8, offsetof(bench, k533____), BENCH_K533____, BENCH_TYPE_STRING },
+        { 1476, 8, offsetof(bench, k534____), BENCH_K534____, BENCH_TYPE_STRING },
+        { 1485, 8, offsetof(bench, k535____), BENCH_K535____, BENCH_TYPE_STRING },
+        { 1494, 8, offsetof(bench, k53_____), BENCH_K53_____, BENCH_TYPE_STRING },
+        { 1503, 8, offsetof(bench, k54_____), BENCH_K54_____, BENCH_TYPE_STRING },
+        { 1512, 8, offsetof(bench, k552____), BENCH_K552____, BENCH_TYPE_STRING },
+        { 1521, 8, offsetof(bench, k553____), BENCH_K553____, BENCH_TYPE_STRING },
+        { 1530, 8, offsetof(bench, k554____), BENCH_K554____, BENCH_TYPE_STRING },
+        { 1539, 8, offsetof(bench, k555____), BENCH_K555____, BENCH_TYPE_STRING },
+        { 1548, 8, offsetof(bench, k556____), BENCH_K556____, BENCH_TYPE_STRING },
+        { 1557, 8, offsetof(bench, k557____), BENCH_K557____, BENCH_TYPE_STRING },
+        { 1566, 8, offsetof(bench, k558____), BENCH_K558____, BENCH_TYPE_STRING },
+        { 1575, 8, offsetof(bench, k559____), BENCH_K559____, BENCH_TYPE_STRING },
+        { 1584, 8, offsetof(bench, k55_____), BENCH_K55_____, BENCH_TYPE_STRING },
+        { 1593, 8, offsetof(bench, k576____), BENCH_K576____, BENCH_TYPE_STRING },
+        { 1602, 8, offsetof(bench, k577____), BENCH_K577____, BENCH_TYPE_STRING },
+        { 1611, 8, offsetof(bench, k578____), BENCH_K578____, BENCH_TYPE_STRING },
+        { 1620, 8, offsetof(bench, k579____), BENCH_K579____, BENCH_TYPE_STRING },
+        { 1629, 8, offsetof(bench, k580____), BENCH_K580____, BENCH_TYPE_STRING },
+        { 1638, 8, offsetof(bench, k581____), BENCH_K581____, BENCH_TYPE_STRING },
+        { 1647, 8, offsetof(bench, k582____), BENCH_K582____, BENCH_TYPE_STRING },
+        { 1656, 8, offsetof(bench, k583____), BENCH_K583____, BENCH_TYPE_STRING },
+        { 1665, 8, offsetof(bench, k5______), BENCH_K5______, BENCH_TYPE_STRING },
+        { 1674, 8, offsetof(bench, k600____), BENCH_K600____, BENCH_TYPE_STRING },
+        { 1683, 8, offsetof(bench, k601____), BENCH_K601____, BENCH_TYPE_STRING },
+        { 1692, 8, offsetof(bench, k602____), BENCH_K602____, BENCH_TYPE_STRING },
+        { 1701, 8, offsetof(bench, k603____), BENCH_K603____, BENCH_TYPE_STRING },
+        { 1710, 8, offsetof(bench, k604____), BENCH_K604____, BENCH_TYPE_STRING },
+        { 1719, 8, offsetof(bench, k605____), BENCH_K605____, BENCH_TYPE_STRING },
+        { 1728, 8, offsetof(bench, k606____), BENCH_K606____, BENCH_TYPE_STRING },
+        { 1737, 8, offsetof(bench, k607____), BENCH_K607____, BENCH_TYPE_STRING },
+        { 1746, 8, offsetof(bench, k624____), BENCH_K624____, BENCH_TYPE_STRING },
+        { 1755, 8, offsetof(bench, k625____), BENCH_K625____, BENCH_TYPE_STRING },
+        { 1764, 8, offsetof(bench, k626____), BENCH_K626____, BENCH_TYPE_STRING },
+        { 1773, 8, offsetof(bench, k627____), BENCH_K627____, BENCH_TYPE_STRING },
+        { 1782, 8, offsetof(bench, k628____), BENCH_K628____, BENCH_TYPE_STRING },
+        { 1791, 8, offsetof(bench, k629____), BENCH_K629____, BENCH_TYPE_STRING },
+        { 1800, 8, offsetof(bench, k630____), BENCH_K630____, BENCH_TYPE_STRING },
+        { 1809, 8, offsetof(bench, k631____), BENCH_K631____, BENCH_TYPE_STRING },
+        { 1818, 8, offsetof(bench, k648____), BENCH_K648____, BENCH_TYPE_STRING },
+        { 1827, 8, offsetof(bench, k649____), BENCH_K649____, BENCH_TYPE_STRING },
+        { 1836, 8, offsetof(bench, k650____), BENCH_K650____, BENCH_TYPE_STRING },
+        { 1845, 8, offsetof(bench, k651____), BENCH_K651____, BENCH_TYPE_STRING },
+        { 1854, 8, offsetof(bench, k652____), BENCH_K652____, BENCH_TYPE_STRING },
+        { 1863, 8, offsetof(bench, k653____), BENCH_K653____, BENCH_TYPE_STRING },
+        { 1872, 8, offsetof(bench, k654____), BENCH_K654____, BENCH_TYPE_STRING },
+        { 1881, 8, offsetof(bench, k655____), BENCH_K655____, BENCH_TYPE_STRING },
+        { 1890, 8, offsetof(bench, k672____), BENCH_K672____, BENCH_TYPE_STRING },
+        { 1899, 8, offsetof(bench, k673____), BENCH_K673____, BENCH_TYPE_STRING },
+        { 1908, 8, offsetof(bench, k674____), BENCH_K674____, BENCH_TYPE_STRING },
+        { 1917, 8, offsetof(bench, k675____), BENCH_K675____, BENCH_TYPE_STRING },
+        { 1926, 8, offsetof(bench, k676____), BENCH_K676____, BENCH_TYPE_STRING },
+        { 1935, 8, offsetof(bench, k677____), BENCH_K677____, BENCH_TYPE_STRING },
+        { 1944, 8, offsetof(bench, k678____), BENCH_K678____, BENCH_TYPE_STRING },
+        { 1953, 8, offsetof(bench, k679____), BENCH_K679____, BENCH_TYPE_STRING },
+        { 1962, 8, offsetof(bench, k696____), BENCH_K696____, BENCH_TYPE_STRING },
+        { 1971, 8, offsetof(bench, k697____), BENCH_K697____, BENCH_TYPE_STRING },
+        { 1980, 8, offsetof(bench, k698____), BENCH_K698____, BENCH_TYPE_STRING },
+        { 1989, 8, offsetof(bench, k699____), BENCH_K699____, BENCH_TYPE_STRING },
+        { 1998, 8, offsetof(bench, k6______), BENCH_K6______, BENCH_TYPE_STRING },
+        { 2007, 8, offsetof(bench, k700____), BENCH_K700____, BENCH_TYPE_STRING },
+        { 2016, 8, offsetof(bench, k701____), BENCH_K701____, BENCH_TYPE_STRING },
+        { 2025, 8, offsetof(bench, k702____), BENCH_K702____, BENCH_TYPE_STRING },
+        { 2034, 8, offsetof(bench, k703____), BENCH_K703____, BENCH_TYPE_STRING },
+        { 2043, 8, offsetof(bench, k720____), BENCH_K720____, BENCH_TYPE_STRING },
+        { 2052, 8, offsetof(bench, k721____), BENCH_K721____, BENCH_TYPE_STRING },
+        { 2061, 8, offsetof(bench, k722____), BENCH_K722____, BENCH_TYPE_STRING },
+        { 2070, 8, offsetof(bench, k723____), BENCH_K723____, BENCH_TYPE_STRING },
+        { 2079, 8, offsetof(bench, k724____), BENCH_K724____, BENCH_TYPE_STRING },
+        { 2088, 8, offsetof(bench, k725____), BENCH_K725____, BENCH_TYPE_STRING },
+        { 2097, 8, offsetof(bench, k726____), BENCH_K726____, BENCH_TYPE_STRING },
+        { 2106, 8, offsetof(bench, k727____), BENCH_K727____, BENCH_TYPE_STRING },
+        { 2115, 8, offsetof(bench, k72_____), BENCH_K72_____, BENCH_TYPE_STRING },
+        { 2124, 8, offsetof(bench, k73_____), BENCH_K73_____, BENCH_TYPE_STRING },
+        { 2133, 8, offsetof(bench, k744____), BENCH_K744____, BENCH_TYPE_STRING },
+        { 2142, 8, offsetof(bench, k745____), BENCH_K745____, BENCH_TYPE_STRING },
+        { 2151, 8, offsetof(bench, k746____), BENCH_K746____, BENCH_TYPE_STRING },
+        { 2160, 8, offsetof(bench, k747____), BENCH_K747____, BENCH_TYPE_STRING },
+        { 2169, 8, offsetof(bench, k748____), BENCH_K748____, BENCH_TYPE_STRING },
+        { 2178, 8, offsetof(bench, k749____), BENCH_K749____, BENCH_TYPE_STRING },
+        { 2187, 8, offsetof(bench, k74_____), BENCH_K74_____, BENCH_TYPE_STRING },
+        { 2196, 8, offsetof(bench, k750____), BENCH_K750____, BENCH_TYPE_STRING },
+        { 2205, 8, offsetof(bench, k751____), BENCH_K751____, BENCH_TYPE_STRING },
+        { 2214, 8, offsetof(bench, k75_____), BENCH_K75_____, BENCH_TYPE_STRING },
+        { 2223, 8, offsetof(bench, k768____), BENCH_K768____, BENCH_TYPE_STRING },
+        { 2232, 8, offsetof(bench, k769____), BENCH_K769____, BENCH_TYPE_STRING },
+        { 2241, 8, offsetof(bench, k76_____), BENCH_K76_____, BENCH_TYPE_STRING },
+        { 2250, 8, offsetof(bench, k770____), BENCH_K770____, BENCH_TYPE_STRING },
+        { 2259, 8, offsetof(bench, k771____), BENCH_K771____, BENCH_TYPE_STRING },
+        { 2268, 8, offsetof(bench, k772____), BENCH_K772____, BENCH_TYPE_STRING },
+        { 2277, 8, offsetof(bench, k773____), BENCH_K773____, BENCH_TYPE_STRING },
+        { 2286, 8, offsetof(bench, k774____), BENCH_K774____, BENCH_TYPE_STRING },
+        { 2295, 8, offsetof(bench, k775____), BENCH_K775____, BENCH_TYPE_STRING },
+        { 2304, 8, offsetof(bench, k77_____), BENCH_K77_____, BENCH_TYPE_STRING },
+        { 2313, 8, offsetof(bench, k78_____), BENCH_K78_____, BENCH_TYPE_STRING },
+        { 2322, 8, offsetof(bench, k792____), BENCH_K792____, BENCH_TYPE_STRING },
+        { 2331, 8, offsetof(bench, k793____), BENCH_K793____, BENCH_TYPE_STRING },
+        { 2340, 8, offsetof(bench, k794____), BENCH_K794____, BENCH_TYPE_STRING },
+        { 2349, 8, offsetof(bench, k795____), BENCH_K795____, BENCH_TYPE_STRING },
+        { 2358, 8, offsetof(bench, k796____), BENCH_K796____, BENCH_TYPE_STRING },
+        { 2367, 8, offsetof(bench, k797____), BENCH_K797____, BENCH_TYPE_STRING },
+        { 2376, 8, offsetof(bench, k798____), BENCH_K798____, BENCH_TYPE_STRING },
+        { 2385, 8, offsetof(bench, k799____), BENCH_K799____, BENCH_TYPE_STRING },
+        { 2394, 8, offsetof(bench, k79_____), BENCH_K79_____, BENCH_TYPE_STRING },
+        { 2403, 8, offsetof(bench, k7______), BENCH_K7______, BENCH_TYPE_STRING },
+        { 2412, 8, offsetof(bench, k816____), BENCH_K816____, BENCH_TYPE_STRING },
+        { 2421, 8, offsetof(bench, k817____), BENCH_K817____, BENCH_TYPE_STRING },
+        { 2430, 8, offsetof(bench, k818____), BENCH_K818____, BENCH_TYPE_STRING },
+        { 2439, 8, offsetof(bench, k819____), BENCH_K819____, BENCH_TYPE_STRING },
+        { 2448, 8, offsetof(bench, k820____), BENCH_K820____, BENCH_TYPE_STRING },
+        { 2457, 8, offsetof(bench, k821____), BENCH_K821____, BENCH_TYPE_STRING },
+        { 2466, 8, offsetof(bench, k822____), BENCH_K822____, BENCH_TYPE_STRING },
+        { 2475, 8, offsetof(bench, k823____), BENCH_K823____, BENCH_TYPE_STRING },
+        { 2484, 8, offsetof(bench, k840____), BENCH_K840____, BENCH_TYPE_STRING },
+        { 2493, 8, offsetof(bench, k841____), BENCH_K841____, BENCH_TYPE_STRING },
+        { 2502, 8, offsetof(bench, k842____), BENCH_K842____, BENCH_TYPE_STRING },
+        { 2511, 8, offsetof(bench, k843____), BENCH_K843____, BENCH_TYPE_STRING },
+        { 2520, 8, offsetof(bench, k844____), BENCH_K844____, BENCH_TYPE_STRING },
+        { 2529, 8, offsetof(bench, k845____), BENCH_K845____, BENCH_TYPE_STRING },
+        { 2538, 8, offsetof(bench, k846____), BENCH_K846____, BENCH_TYPE_STRING },
+        { 2547, 8, offsetof(bench, k847____), BENCH_K847____, BENCH_TYPE_STRING },
+        { 2556, 8, offsetof(bench, k864____), BENCH_K864____, BENCH_TYPE_STRING },
+        { 2565, 8, offsetof(bench, k865____), BENCH_K865____, BENCH_TYPE_STRING },
+        { 2574, 8, offsetof(bench, k866____), BENCH_K866____, BENCH_TYPE_STRING },
+        { 2583, 8, offsetof(bench, k867____), BENCH_K867____, BENCH_TYPE_STRING },
+        { 2592, 8, offsetof(bench, k868____), BENCH_K868____, BENCH_TYPE_STRING },
+        { 2601, 8, offsetof(bench, k869____), BENCH_K869____, BENCH_TYPE_STRING },
+        { 2610, 8, offsetof(bench, k870____), BENCH_K870____, BENCH_TYPE_STRING },
+        { 2619, 8, offsetof(bench, k871____), BENCH_K871____, BENCH_TYPE_STRING },
+        { 2628, 8, offsetof(bench, k888____), BENCH_K888____, BENCH_TYPE_STRING },
+        { 2637, 8, offsetof(bench, k889____), BENCH_K889____, BENCH_TYPE_STRING },
+        { 2646, 8, offsetof(bench, k890____), BENCH_K890____, BENCH_TYPE_STRING },
+        { 2655, 8, offsetof(bench, k891____), BENCH_K891____, BENCH_TYPE_STRING },
+        { 2664, 8, offsetof(bench, k892____), BENCH_K892____, BENCH_TYPE_STRING },
+        { 2673, 8, offsetof(bench, k893____), BENCH_K893____, BENCH_TYPE_STRING },
+        { 2682, 8, offsetof(bench, k894____), BENCH_K894____, BENCH_TYPE_STRING },
+        { 2691, 8, offsetof(bench, k895____), BENCH_K895____, BENCH_TYPE_STRING },
+        { 2700, 8, offsetof(bench, k912____), BENCH_K912____, BENCH_TYPE_STRING },
+        { 2709, 8, offsetof(bench, k913____), BENCH_K913____, BENCH_TYPE_STRING },
+        { 2718, 8, offsetof(bench, k914____), BENCH_K914____, BENCH_TYPE_STRING },
+        { 2727, 8, offsetof(bench, k915____), BENCH_K915____, BENCH_TYPE_STRING },
+        { 2736, 8, offsetof(bench, k916____), BENCH_K916____, BENCH_TYPE_STRING },
+        { 2745, 8, offsetof(bench, k917____), BENCH_K917____, BENCH_TYPE_STRING },
+        { 2754, 8, offsetof(bench, k918____), BENCH_K918____, BENCH_TYPE_STRING },
+        { 2763, 8, offsetof(bench, k919____), BENCH_K919____, BENCH_TYPE_STRING },
+        { 2772, 8, offsetof(bench, k936____), BENCH_K936____, BENCH_TYPE_STRING },
+        { 2781, 8, offsetof(bench, k937____), BENCH_K937____, BENCH_TYPE_STRING },
+        { 2790, 8, offsetof(bench, k938____), BENCH_K938____, BENCH_TYPE_STRING },
+        { 2799, 8, offsetof(bench, k939____), BENCH_K939____, BENCH_TYPE_STRING },
+        { 2808, 8, offsetof(bench, k940____), BENCH_K940____, BENCH_TYPE_STRING },
+        { 2817, 8, offsetof(bench, k941____), BENCH_K941____, BENCH_TYPE_STRING },
+        { 2826, 8, offsetof(bench, k942____), BENCH_K942____, BENCH_TYPE_STRING },
+        { 2835, 8, offsetof(bench, k943____), BENCH_K943____, BENCH_TYPE_STRING },
+        { 2844, 8, offsetof(bench, k960____), BENCH_K960____, BENCH_TYPE_STRING },
+        { 2853, 8, offsetof(bench, k961____), BENCH_K961____, BENCH_TYPE_STRING },
+        { 2862, 8, offsetof(bench, k962____), BENCH_K962____, BENCH_TYPE_STRING },
+        { 2871, 8, offsetof(bench, k963____), BENCH_K963____, BENCH_TYPE_STRING },
+        { 2880, 8, offsetof(bench, k964____), BENCH_K964____, BENCH_TYPE_STRING },
+        { 2889, 8, offsetof(bench, k965____), BENCH_K965____, BENCH_TYPE_STRING },
+        { 2898, 8, offsetof(bench, k966____), BENCH_K966____, BENCH_TYPE_STRING },
+        { 2907, 8, offsetof(bench, k967____), BENCH_K967____, BENCH_TYPE_STRING },
+        { 2916, 8, offsetof(bench, k96_____), BENCH_K96_____, BENCH_TYPE_STRING },
+        { 2925, 8, offsetof(bench, k97_____), BENCH_K97_____, BENCH_TYPE_STRING },
+        { 2934, 8, offsetof(bench, k984____), BENCH_K984____, BENCH_TYPE_STRING },
+        { 2943, 8, offsetof(bench, k985____), BENCH_K985____, BENCH_TYPE_STRING },
+        { 2952, 8, offsetof(bench, k986____), BENCH_K986____, BENCH_TYPE_STRING },
+        { 2961, 8, offsetof(bench, k987____), BENCH_K987____, BENCH_TYPE_STRING },
+        { 2970, 8, offsetof(bench, k988____), BENCH_K988____, BENCH_TYPE_STRING },
+        { 2979, 8, offsetof(bench, k989____), BENCH_K989____, BENCH_TYPE_STRING },
+        { 2988, 8, offsetof(bench, k98_____), BENCH_K98_____, BENCH_TYPE_STRING },
+        { 2997, 8, offsetof(bench, k990____), BENCH_K990____, BENCH_TYPE_STRING },
+        { 3006, 8, offsetof(bench, k991____), BENCH_K991____, BENCH_TYPE_STRING },
+        { 3015, 8, offsetof(bench, k99_____), BENCH_K99_____, BENCH_TYPE_STRING },
+        { 3024, 17, offsetof(bench, s0______.k10_____), BENCH_S0_______K10_____, BENCH_TYPE_STRING },
+        { 3042, 17, offsetof(bench, s0______.k11_____), BENCH_S0_______K11_____, BENCH_TYPE_STRING },
+        { 3060, 17, offsetof(bench, s0______.k12_____), BENCH_S0_______K12_____, BENCH_TYPE_STRING },
+        { 3078, 17, offsetof(bench, s0______.k13_____), BENCH_S0_______K13_____, BENCH_TYPE_STRING },
+        { 3096, 17, offsetof(bench, s0______.k14_____), BENCH_S0_______K14_____, BENCH_TYPE_STRING },
+        { 3114, 17, offsetof(bench, s0______.k15_____), BENCH_S0_______K15_____, BENCH_TYPE_STRING },
+        { 3132, 17, offsetof(bench, s0______.k8______), BENCH_S0_______K8______, BENCH_TYPE_STRING },
+        { 3150, 17, offsetof(bench, s0______.k9______), BENCH_S0_______K9______, BENCH_TYPE_STRING },
+        { 3168, 26, offsetof(bench, s0______.s1______.k16_____), BENCH_S0_______S1_______K16_____, BENCH_TYPE_STRING },
+        { 3195, 26, offsetof(bench, s0______.s1______.k17_____), BENCH_S0_______S1_______K17_____, BENCH_TYPE_STRING },
+        { 3222, 26, offsetof(bench, s0______.s1______.k18_____), BENCH_S0_______S1_______K18_____, BENCH_TYPE_STRING },
+        { 3249, 26, offsetof(bench, s0______.s1______.k19_____), BENCH_S0_______S1_______K19_____, BENCH_TYPE_STRING },
+        { 3276, 26, offsetof(bench, s0______.s1______.k20_____), BENCH_S0_______S1_______K20_____, BENCH_TYPE_STRING },
+        { 3303, 26, offsetof(bench, s0______.s1______.k21_____), BENCH_S0_______S1_______K21_____, BENCH_TYPE_STRING },
+        { 3330, 26, offsetof(bench, s0______.s1______.k22_____), BENCH_S0_______S1_______K22_____, BENCH_TYPE_STRING },
+        { 3357, 26, offsetof(bench, s0______.s1______.k23_____), BENCH_S0_______S1_______K23_____, BENCH_TYPE_STRING },
+        { 3384, 17, offsetof(bench, s10_____.k128____), BENCH_S10______K128____, BENCH_TYPE_STRING },
+        { 3402, 17, offsetof(bench, s10_____.k129____), BENCH_S10______K129____, BENCH_TYPE_STRING },
+        { 3420, 17, offsetof(bench, s10_____.k130____), BENCH_S10______K130____, BENCH_TYPE_STRING },
+        { 3438, 17, offsetof(bench, s10_____.k131____), BENCH_S10______K131____, BENCH_TYPE_STRING },
+        { 3456, 17, offsetof(bench, s10_____.k132____), BENCH_S10______K132____, BENCH_TYPE_STRING },
+        { 3474, 17, offsetof(bench, s10_____.k133____), BENCH_S10______K133____, BENCH_TYPE_STRING },
+        { 3492, 17, offsetof(bench, s10_____.k134____), BENCH_S10______K134____, BENCH_TYPE_STRING },
+        { 3510, 17, offsetof(bench, s10_____.k135____), BENCH_S10______K135____, BENCH_TYPE_STRING },
+        { 3528, 26, offsetof(bench, s10_____.s11_____.k136____), BENCH_S10______S11______K136____, BENCH_TYPE_STRING },
+        { 3555, 26, offsetof(bench, s10_____.s11_____.k137____), BENCH_S10______S11______K137____, BENCH_TYPE_STRING },
+        { 3582, 26, offsetof(bench, s10_____.s11_____.k138____), BENCH_S10______S11______K138____, BENCH_TYPE_STRING },
+        { 3609, 26, offsetof(bench, s10_____.s11_____.k139____), BENCH_S10______S11______K139____, BENCH_TYPE_STRING },
+        { 3636, 26, offsetof(bench, s10_____.s11_____.k140____), BENCH_S10______S11______K140____, BENCH_TYPE_STRING },
+        { 3663, 26, offsetof(bench, s10_____.s11_____.k141____), BENCH_S10______S11______K141____, BENCH_TYPE_STRING },
+        { 3690, 26, offsetof(bench, s10_____.s11_____.k142____), BENCH_S10______S11______K142____, BENCH_TYPE_STRING },
+        { 3717, 26, offsetof(bench, s10_____.s11_____.k143____), BENCH_S10______S11______K143____, BENCH_TYPE_STRING },
+        { 3744, 17, offsetof(bench, s12_____.k152____), BENCH_S12______K152____, BENCH_TYPE_STRING },
+        { 3762, 17, offsetof(bench, s12_____.k153____), BENCH_S12______K153____, BENCH_TYPE_STRING },
+        { 3780, 17, offsetof(bench, s12_____.k154____), BENCH_S12______K154____, BENCH_TYPE_STRING },
+        { 3798, 17, offsetof(bench, s12_____.k155____), BENCH_S12______K155____, BENCH_TYPE_STRING },
+        { 3816, 17, offsetof(bench, s12_____.k156____), BENCH_S12______K156____, BENCH_TYPE_STRING },
+        { 3834, 17, offsetof(bench, s12_____.k157____), BENCH_S12______K157____, BENCH_TYPE_STRING },
+        { 3852, 17, offsetof(bench, s12_____.k158____), BENCH_S12______K158____, BENCH_TYPE_STRING },
+        { 3870, 17, offsetof(bench, s12_____.k159____), BENCH_S12______K159____, BENCH_TYPE_STRING },
+        { 3888, 26, offsetof(bench, s12_____.s13_____.k160____), BENCH_S12______S13______K160____, BENCH_TYPE_STRING },
+        { 3915, 26, offsetof(bench, s12_____.s13_____.k161____), BENCH_S12______S13______K161____, BENCH_TYPE_STRING },
+        { 3942, 26, offsetof(bench, s12_____.s13_____.k162____), BENCH_S12______S13______K162____, BENCH_TYPE_STRING },
+        { 3969, 26, offsetof(bench, s12_____.s13_____.k163____), BENCH_S12______S13______K163____, BENCH_TYPE_STRING },
+        { 3996, 26, offsetof(bench, s12_____.s13_____.k164____), BENCH_S12______S13______K164____, BENCH_TYPE_STRING },
+        { 4023, 26, offsetof(bench, s12_____.s13_____.k165____), BENCH_S12______S13______K165____, BENCH_TYPE_STRING },
+        { 4050, 26, offsetof(bench, s12_____.s13_____.k166____), BENCH_S12______S13______K166____, BENCH_TYPE_STRING },
+        { 4077, 26, offsetof(bench, s12_____.s13_____.k167____), BENCH_S12______S13______K167____, BENCH_TYPE_STRING },
+        { 4104, 17, offsetof(bench, s14_____.k176____), BENCH_S14______K176____, BENCH_TYPE_STRING },
+        { 4122, 17, offsetof(bench, s14_____.k177____), BENCH_S14______K177____, BENCH_TYPE_STRING },
+        { 4140, 17, offsetof(bench, s14_____.k178____), BENCH_S14______K178____, BENCH_TYPE_STRING },
+        { 4158, 17, offsetof(bench, s14_____.k179____), BENCH_S14______K179____, BENCH_TYPE_STRING },
+        { 4176, 17, offsetof(bench, s14_____.k180____), BENCH_S14______K180____, BENCH_TYPE_STRING },
+        { 4194, 17, offsetof(bench, s14_____.k181____), BENCH_S14______K181____, BENCH_TYPE_STRING },
+        { 4212, 17, offsetof(bench, s14_____.k182____), BENCH_S14______K182____, BENCH_TYPE_STRING },
+        { 4230, 17, offsetof(bench, s14_____.k183____), BENCH_S14______K183____, BENCH_TYPE_STRING },
+        { 4248, 26, offsetof(bench, s14_____.s15_____.k184____), BENCH_S14______S15______K184____, BENCH_TYPE_STRING },
+        { 4275, 26, offsetof(bench, s14_____.s15_____.k185____), BENCH_S14______S15______K185____, BENCH_TYPE_STRING },
+        { 4302, 26, offsetof(bench, s14_____.s15_____.k186____), BENCH_S14______S15______K186____, BENCH_TYPE_STRING },
+        { 4329, 26, offsetof(bench, s14_____.s15_____.k187____), BENCH_S14______S15______K187____, BENCH_TYPE_STRING },
+        { 4356, 26, offsetof(bench, s14_____.s15_____.k188____), BENCH_S14______S15______K188____, BENCH_TYPE_STRING },
+        { 4383, 26, offsetof(bench, s14_____.s15_____.k189____), BENCH_S14______S15______K189____, BENCH_TYPE_STRING },
+        { 4410, 26, offsetof(bench, s14_____.s15_____.k190____), BENCH_S14______S15______K190____, BENCH_TYPE_STRING },
+        { 4437, 26, offsetof(bench, s14_____.s15_____.k191____), BENCH_S14______S15______K191____, BENCH_TYPE_STRING },
+        { 4464, 17, offsetof(bench, s16_____.k200____), BENCH_S16______K200____, BENCH_TYPE_STRING },
+        { 4482, 17, offsetof(bench, s16_____.k201____), BENCH_S16______K201____, BENCH_TYPE_STRING },
+        { 4500, 17, offsetof(bench, s16_____.k202____), BENCH_S16______K202____, BENCH_TYPE_STRING },
+        { 4518, 17, offsetof(bench, s16_____.k203____), BENCH_S16______K203____, BENCH_TYPE_STRING },
+        { 4536, 17, offsetof(bench, s16_____.k204____), BENCH_S16______K204____, BENCH_TYPE_STRING },
+        { 4554, 17, offsetof(bench, s16_____.k205____), BENCH_S16______K205____, BENCH_TYPE_STRING },
+        { 4572, 17, offsetof(bench, s16_____.k206____), BENCH_S16______K206____, BENCH_TYPE_STRING },
+        { 4590, 17, offsetof(bench, s16_____.k207____), BENCH_S16______K207____, BENCH_TYPE_STRING },
+        { 4608, 26, offsetof(bench, s16_____.s17_____.k208____), BENCH_S16______S17______K208____, BENCH_TYPE_STRING },
+        { 4635, 26, offsetof(bench, s16_____.s17_____.k209____), BENCH_S16______S17______K209____, BENCH_TYPE_STRING },
+        { 4662, 26, offsetof(bench, s16_____.s17_____.k210____), BENCH_S16______S17______K210____, BENCH_TYPE_STRING },
+        { 4689, 26, offsetof(bench, s16_____.s17_____.k211____), BENCH_S16______S17______K211____, BENCH_TYPE_STRING },
+        { 4716, 26, offsetof(bench, s16_____.s17_____.k212____), BENCH_S16______S17______K212____, BENCH_TYPE_STRING },
+        { 4743, 26, offsetof(bench, s16_____.s17_____.k213____), BENCH_S16______S17______K213____, BENCH_TYPE_STRING },
+        { 4770, 26, offsetof(bench, s16_____.s17_____.k214____), BENCH_S16______S17______K214____, BENCH_TYPE_STRING },
+        { 4797, 26, offsetof(bench, s16_____.s17_____.k215____), BENCH_S16______S17______K215____, BENCH_TYPE_STRING },
+        { 4824, 17, offsetof(bench, s18_____.k224____), BENCH_S18______K224____, BENCH_TYPE_STRING },
+        { 4842, 17, offsetof(bench, s18_____.k225____), BENCH_S18______K225____, BENCH_TYPE_STRING },
+        { 4860, 17, offsetof(bench, s18_____.k226____), BENCH_S18______K226____, BENCH_TYPE_STRING },
+        { 4878, 17, offsetof(bench, s18_____.k227____), BENCH_S18______K227____, BENCH_TYPE_STRING },
+        { 4896, 17, offsetof(bench, s18_____.k228____), BENCH_S18______K228____, BENCH_TYPE_STRING },
+        { 4914, 17, offsetof(bench, s18_____.k229____), BENCH_S18______K229____, BENCH_TYPE_STRING },
+        { 4932, 17, offsetof(bench, s18_____.k230____), BENCH_S18______K230____, BENCH_TYPE_STRING },
+        { 4950, 17, offsetof(bench, s18_____.k231____), BENCH_S18______K231____, BENCH_TYPE_STRING },
+        { 4968, 26, offsetof(bench, s18_____.s19_____.k232____), BENCH_S18______S19______K232____, BENCH_TYPE_STRING },
+        { 4995, 26, offsetof(bench, s18_____.s19_____.k233____), BENCH_S18______S19______K233____, BENCH_TYPE_STRING },
+        { 5022, 26, offsetof(bench, s18_____.s19_____.k234____), BENCH_S18______S19______K234____, BENCH_TYPE_STRING },
+        { 5049, 26, offsetof(bench, s18_____.s19_____.k235____), BENCH_S18______S19______K235____, BENCH_TYPE_STRING },
+        { 5076, 26, offsetof(bench, s18_____.s19_____.k236____), BENCH_S18______S19______K236____, BENCH_TYPE_STRING },
+        { 5103, 26, offsetof(bench, s18_____.s19_____.k237____), BENCH_S18______S19______K237____, BENCH_TYPE_STRING },
+        { 5130, 26, offsetof(bench, s18_____.s19_____.k238____), BENCH_S18______S19______K238____, BENCH_TYPE_STRING },
+        { 5157, 26, offsetof(bench, s18_____.s19_____.k239____), BENCH_S18______S19______K239____, BENCH_TYPE_STRING },
+        { 5184, 17, offsetof(bench, s20_____.k248____), BENCH_S20______K248____, BENCH_TYPE_STRING },
+        { 5202, 17, offsetof(bench, s20_____.k249____), BENCH_S20______K249____, BENCH_TYPE_STRING },
+        { 5220, 17, offsetof(bench, s20_____.k250____), BENCH_S20______K250____, BENCH_TYPE_STRING },
+        { 5238, 17, offsetof(bench, s20_____.k251____), BENCH_S20______K251____, BENCH_TYPE_STRING },
+        { 5256, 17, offsetof(bench, s20_____.k252____), BENCH_S20______K252____, BENCH_TYPE_STRING },
+        { 5274, 17, offsetof(bench, s20_____.k253____), BENCH_S20______K253____, BENCH_TYPE_STRING },
+        { 5292, 17, offsetof(bench, s20_____.k254____), BENCH_S20______K254____, BENCH_TYPE_STRING },
+        { 5310, 17, offsetof(bench, s20_____.k255____), BENCH_S20______K255____, BENCH_TYPE_STRING },
+        { 5328, 26, offsetof(bench, s20_____.s21_____.k256____), BENCH_S20______S21______K256____, BENCH_TYPE_STRING },
+        { 5355, 26, offsetof(bench, s20_____.s21_____.k257____), BENCH_S20______S21______K257____, BENCH_TYPE_STRING },
+        { 5382, 26, offsetof(bench, s20_____.s21_____.k258____), BENCH_S20______S21______K258____, BENCH_TYPE_STRING },
+        { 5409, 26, offsetof(bench, s20_____.s21_____.k259____), BENCH_S20______S21______K259____, BENCH_TYPE_STRING },
+        { 5436, 26, offsetof(bench, s20_____.s21_____.k260____), BENCH_S20______S21______K260____, BENCH_TYPE_STRING },
+        { 5463, 26, offsetof(bench, s20_____.s21_____.k261____), BENCH_S20______S21______K261____, BENCH_TYPE_STRING },
+        { 5490, 26, offsetof(bench, s20_____.s21_____.k262____), BENCH_S20______S21______K262____, BENCH_TYPE_STRING },
+        { 5517, 26, offsetof(bench, s20_____.s21_____.k263____), BENCH_S20______S21______K263____, BENCH_TYPE_STRING },
+        { 5544, 17, offsetof(bench, s22_____.k272____), BENCH_S22______K272____, BENCH_TYPE_STRING },
+        { 5562, 17, offsetof(bench, s22_____.k273____), BENCH_S22______K273____, BENCH_TYPE_STRING },
+        { 5580, 17, offsetof(bench, s22_____.k274____), BENCH_S22______K274____, BENCH_TYPE_STRING },
+        { 5598, 17, offsetof(bench, s22_____.k275____), BENCH_S22______K275____, BENCH_TYPE_STRING },
+        { 5616, 17, offsetof(bench, s22_____.k276____), BENCH_S22______K276____, BENCH_TYPE_STRING },
+        { 5634, 17, offsetof(bench, s22_____.k277____), BENCH_S22______K277____, BENCH_TYPE_STRING },
+        { 5652, 17, offsetof(bench, s22_____.k278____), BENCH_S22______K278____, BENCH_TYPE_STRING },
+        { 5670, 17, offsetof(bench, s22_____.k279____), BENCH_S22______K279____, BENCH_TYPE_STRING },
+        { 5688, 26, offsetof(bench, s22_____.s23_____.k280____), BENCH_S22______S23______K280____, BENCH_TYPE_STRING },
+        { 5715, 26, offsetof(bench, s22_____.s23_____.k281____), BENCH_S22______S23______K281____, BENCH_TYPE_STRING },
+        { 5742, 26, offsetof(bench, s22_____.s23_____.k282____), BENCH_S22______S23______K282____, BENCH_TYPE_STRING },
+        { 5769, 26, offsetof(bench, s22_____.s23_____.k283____), BENCH_S22______S23______K283____, BENCH_TYPE_STRING },
+        { 5796, 26, offsetof(bench, s22_____.s23_____.k284____), BENCH_S22______S23______K284____, BENCH_TYPE_STRING },
+        { 5823, 26, offsetof(bench, s22_____.s23_____.k285____), BENCH_S22______S23______K285____, BENCH_TYPE_STRING },
+        { 5850, 26, offsetof(bench, s22_____.s23_____.k286____), BENCH_S22______S23______K286____, BENCH_TYPE_STRING },
+        { 5877, 26, offsetof(bench, s22_____.s23_____.k287____), BENCH_S22______S23______K287____, BENCH_TYPE_STRING },
+        { 5904, 17, offsetof(bench, s24_____.k296____), BENCH_S24______K296____, BENCH_TYPE_STRING },
+        { 5922, 17, offsetof(bench, s24_____.k297____), BENCH_S24______K297____, BENCH_TYPE_STRING },
+        { 5940, 17, offsetof(bench, s24_____.k298____), BENCH_S24______K298____, BENCH_TYPE_STRING },
+        { 5958, 17, offsetof(bench, s24_____.k299____), BENCH_S24______K299____, BENCH_TYPE_STRING },
+        { 5976, 17, offsetof(bench, s24_____.k300____), BENCH_S24______K300____, BENCH_TYPE_STRING },
+        { 5994, 17, offsetof(bench, s24_____.k301____), BENCH_S24______K301____, BENCH_TYPE_STRING },
+        { 6012, 17, offsetof(bench, s24_____.k302____), BENCH_S24______K302____, BENCH_TYPE_STRING },
+        { 6030, 17, offsetof(bench, s24_____.k303____), BENCH_S24______K303____, BENCH_TYPE_STRING },
+        { 6048, 26, offsetof(bench, s24_____.s25_____.k304____), BENCH_S24______S25______K304____, BENCH_TYPE_STRING },
+        { 6075, 26, offsetof(bench, s24_____.s25_____.k305____), BENCH_S24______S25______K305____, BENCH_TYPE_STRING },
+        { 6102, 26, offsetof(bench, s24_____.s25_____.k306____), BENCH_S24______S25______K306____, BENCH_TYPE_STRING },
+        { 6129, 26, offsetof(bench, s24_____.s25_____.k307____), BENCH_S24______S25______K307____, BENCH_TYPE_STRING },
+        { 6156, 26, offsetof(bench, s24_____.s25_____.k308____), BENCH_S24______S25______K308____, BENCH_TYPE_STRING },
+        { 6183, 26, offsetof(bench, s24_____.s25_____.k309____), BENCH_S24______S25______K309____, BENCH_TYPE_STRING },
+        { 6210, 26, offsetof(bench, s24_____.s25_____.k310____), BENCH_S24______S25______K310____, BENCH_TYPE_STRING },
+        { 6237, 26, offsetof(bench, s24_____.s25_____.k311____), BENCH_S24______S25______K311____, BENCH_TYPE_STRING },
+        { 6264, 17, offsetof(bench, s26_____.k320____), BENCH_S26______K320____, BENCH_TYPE_STRING },
+        { 6282, 17, offsetof(bench, s26_____.k321____), BENCH_S26______K321____, BENCH_TYPE_STRING },
+        { 6300, 17, offsetof(bench, s26_____.k322____), BENCH_S26______K322____, BENCH_TYPE_STRING },
+        { 6318, 17, offsetof(bench, s26_____.k323____), BENCH_S26______K323____, BENCH_TYPE_STRING },
+        { 6336, 17, offsetof(bench, s26_____.k324____), BENCH_S26______K324____, BENCH_TYPE_STRING },
+        { 6354, 17, offsetof(bench, s26_____.k325____), BENCH_S26______K325____, BENCH_TYPE_STRING },
+        { 6372, 17, offsetof(bench, s26_____.k326____), BENCH_S26______K326____, BENCH_TYPE_STRING },
+        { 6390, 17, offsetof(bench, s26_____.k327____), BENCH_S26______K327____, BENCH_TYPE_STRING },
+        { 6408, 26, offsetof(bench, s26_____.s27_____.k328____), BENCH_S26______S27______K328____, BENCH_TYPE_STRING },
+        { 6435, 26, offsetof(bench, s26_____.s27_____.k329____), BENCH_S26______S27______K329____, BENCH_TYPE_STRING },
+        { 6462, 26, offsetof(bench, s26_____.s27_____.k330____), BENCH_S26______S27______K330____, BENCH_TYPE_STRING },
+        { 6489, 26, offsetof(bench, s26_____.s27_____.k331____), BENCH_S26______S27______K331____, BENCH_TYPE_STRING },
+        { 6516, 26, offsetof(bench, s26_____.s27_____.k332____), BENCH_S26______S27______K332____, BENCH_TYPE_STRING },
+        { 6543, 26, offsetof(bench, s26_____.s27_____.k333____), BENCH_S26______S27______K333____, BENCH_TYPE_STRING },
+        { 6570, 26, offsetof(bench, s26_____.s27_____.k334____), BENCH_S26______S27______K334____, BENCH_TYPE_STRING },
+        { 6597, 26, offsetof(bench, s26_____.s27_____.k335____), BENCH_S26______S27______K335____, BENCH_TYPE_STRING },
+        { 6624, 17, offsetof(bench, s28_____.k344____), BENCH_S28______K344____, BENCH_TYPE_STRING },
+        { 6642, 17, offsetof(bench, s28_____.k345____), BENCH_S28______K345____, BENCH_TYPE_STRING },
+        { 6660, 17, offsetof(bench, s28_____.k346____), BENCH_S28______K346____, BENCH_TYPE_STRING },
+        { 6678, 17, offsetof(bench, s28_____.k347____), BENCH_S28______K347____, BENCH_TYPE_STRING },
+        { 6696, 17, offsetof(bench, s28_____.k348____), BENCH_S28______K348____, BENCH_TYPE_STRING },
+        { 6714, 17, offsetof(bench, s28_____.k349____), BENCH_S28______K349____, BENCH_TYPE_STRING },
+        { 6732, 17, offsetof(bench, s28_____.k350____), BENCH_S28______K350____, BENCH_TYPE_STRING },
+        { 6750, 17, offsetof(bench, s28_____.k351____), BENCH_S28______K351____, BENCH_TYPE_STRING },
+        { 6768, 26, offsetof(bench, s28_____.s29_____.k352____), BENCH_S28______S29______K352____, BENCH_TYPE_STRING },
+        { 6795, 26, offsetof(bench, s28_____.s29_____.k353____), BENCH_S28______S29______K353____, BENCH_TYPE_STRING },
+        { 6822, 26, offsetof(bench, s28_____.s29_____.k354____), BENCH_S28______S29______K354____, BENCH_TYPE_STRING },
+        { 6849, 26, offsetof(bench, s28_____.s29_____.k355____), BENCH_S28______S29______K355____, BENCH_TYPE_STRING },
+        { 6876, 26, offsetof(bench, s28_____.s29_____.k356____), BENCH_S28______S29______K356____, BENCH_TYPE_STRING },
+        { 6903, 26, offsetof(bench, s28_____.s29_____.k357____), BENCH_S28______S29______K357____, BENCH_TYPE_STRING },
+        { 6930, 26, offsetof(bench, s28_____.s29_____.k358____), BENCH_S28______S29______K358____, BENCH_TYPE_STRING },
+        { 6957, 26, offsetof(bench, s28_____.s29_____.k359____), BENCH_S28______S29______K359____, BENCH_TYPE_STRING },
+        { 6984, 17, offsetof(bench, s2______.k32_____), BENCH_S2_______K32_____, BENCH_TYPE_STRING },
+        { 7002, 17, offsetof(bench, s2______.k33_____), BENCH_S2_______K33_____, BENCH_TYPE_STRING },
+        { 7020, 17, offsetof(bench, s2______.k34_____), BENCH_S2_______K34_____, BENCH_TYPE_STRING },
+        { 7038, 17, offsetof(bench, s2______.k35_____), BENCH_S2_______K35_____, BENCH_TYPE_STRING },
+        { 7056, 17, offsetof(bench, s2______.k36_____), BENCH_S2_______K36_____, BENCH_TYPE_STRING },
+        { 7074, 17, offsetof(bench, s2______.k37_____), BENCH_S2_______K37_____, BENCH_TYPE_STRING },
+        { 7092, 17, offsetof(bench, s2______.k38_____), BENCH_S2_______K38_____, BENCH_TYPE_STRING },
+        { 7110, 17, offsetof(bench, s2______.k39_____), BENCH_S2_______K39_____, BENCH_TYPE_STRING },
+        { 7128, 26, offsetof(bench, s2______.s3______.k40_____), BENCH_S2_______S3_______K40_____, BENCH_TYPE_STRING },
+        { 7155, 26, offsetof(bench, s2______.s3______.k41_____), BENCH_S2_______S3_______K41_____, BENCH_TYPE_STRING },
+        { 7182, 26, offsetof(bench, s2______.s3______.k42_____), BENCH_S2_______S3_______K42_____, BENCH_TYPE_STRING },
+        { 7209, 26, offsetof(bench, s2______.s3______.k43_____), BENCH_S2_______S3_______K43_____, BENCH_TYPE_STRING },
+        { 7236, 26, offsetof(bench, s2______.s3______.k44_____), BENCH_S2_______S3_______K44_____, BENCH_TYPE_STRING },
+        { 7263, 26, offsetof(bench, s2______.s3______.k45_____), BENCH_S2_______S3_______K45_____, BENCH_TYPE_STRING },
+        { 7290, 26, offsetof(bench, s2______.s3______.k46_____), BENCH_S2_______S3_______K46_____, BENCH_TYPE_STRING },
+        { 7317, 26, offsetof(bench, s2______.s3______.k47_____), BENCH_S2_______S3_______K47_____, BENCH_TYPE_STRING },
+        { 7344, 17, offsetof(bench, s30_____.k368____), BENCH_S30______K368____, BENCH_TYPE_STRING },
+        { 7362, 17, offsetof(bench, s30_____.k369____), BENCH_S30______K369____, BENCH_TYPE_STRING },
+        { 7380, 17, offsetof(bench, s30_____.k370____), BENCH_S30______K370____, BENCH_TYPE_STRING },
+        { 7398, 17, offsetof(bench, s30_____.k371____), BENCH_S30______K371____, BENCH_TYPE_STRING },
+        { 7416, 17, offsetof(bench, s30_____.k372____), BENCH_S30______K372____, BENCH_TYPE_STRING },
+        { 7434, 17, offsetof(bench, s30_____.k373____), BENCH_S30______K373____, BENCH_TYPE_STRING },
+        { 7452, 17, offsetof(bench, s30_____.k374____), BENCH_S30______K374____, BENCH_TYPE_STRING },
+        { 7470, 17, offsetof(bench, s30_____.k375____), BENCH_S30______K375____, BENCH_TYPE_STRING },
+        { 7488, 26, offsetof(bench, s30_____.s31_____.k376____), BENCH_S30______S31______K376____, BENCH_TYPE_STRING },
+        { 7515, 26, offsetof(bench, s30_____.s31_____.k377____), BENCH_S30______S31______K377____, BENCH_TYPE_STRING },
+        { 7542, 26, offsetof(bench, s30_____.s31_____.k378____), BENCH_S30______S31______K378____, BENCH_TYPE_STRING },
+        { 7569, 26, offsetof(bench, s30_____.s31_____.k379____), BENCH_S30______S31______K379____, BENCH_TYPE_STRING },
+        { 7596, 26, offsetof(bench, s30_____.s31_____.k380____), BENCH_S30______S31______K380____, BENCH_TYPE_STRING },
+        { 7623, 26, offsetof(bench, s30_____.s31_____.k381____), BENCH_S30______S31______K381____, BENCH_TYPE_STRING },
+        { 7650, 26, offsetof(bench, s30_____.s31_____.k382____), BENCH_S30______S31______K382____, BENCH_TYPE_STRING },
+        { 7677, 26, offsetof(bench, s30_____.s31_____.k383____), BENCH_S30______S31______K383____, BENCH_TYPE_STRING },
+        { 7704, 17, offsetof(bench, s32_____.k392____), BENCH_S32______K392____, BENCH_TYPE_STRING },
+        { 7722, 17, offsetof(bench, s32_____.k393____), BENCH_S32______K393____, BENCH_TYPE_STRING },
+        { 7740, 17, offsetof(bench, s32_____.k394____), BENCH_S32______K394____, BENCH_TYPE_STRING },
+        { 7758, 17, offsetof(bench, s32_____.k395____), BENCH_S32______K395____, BENCH_TYPE_STRING },
+        { 7776, 17, offsetof(bench, s32_____.k396____), BENCH_S32______K396____, BENCH_TYPE_STRING },
+        { 7794, 17, offsetof(bench, s32_____.k397____), BENCH_S32______K397____, BENCH_TYPE_STRING },
+        { 7812, 17, offsetof(bench, s32_____.k398____), BENCH_S32______K398____, BENCH_TYPE_STRING },
+        { 7830, 17, offsetof(bench, s32_____.k399____), BENCH_S32______K399____, BENCH_TYPE_STRING },
+        { 7848, 26, offsetof(bench, s32_____.s33_____.k400____), BENCH_S32______S33______K400____, BENCH_TYPE_STRING },
+        { 7875, 26, offsetof(bench, s32_____.s33_____.k401____), BENCH_S32______S33______K401____, BENCH_TYPE_STRING },
+        { 7902, 26, offsetof(bench, s32_____.s33_____.k402____), BENCH_S32______S33______K402____, BENCH_TYPE_STRING },
+        { 7929, 26, offsetof(bench, s32_____.s33_____.k403____), BENCH_S32______S33______K403____, BENCH_TYPE_STRING },
+        { 7956, 26, offsetof(bench, s32_____.s33_____.k404____), BENCH_S32______S33______K404____, BENCH_TYPE_STRING },
+        { 7983, 26, offsetof(bench, s32_____.s33_____.k405____), BENCH_S32______S33______K405____, BENCH_TYPE_STRING },
+        { 8010, 26, offsetof(bench, s32_____.s33_____.k406____), BENCH_S32______S33______K406____, BENCH_TYPE_STRING },
+        { 8037, 26, offsetof(bench, s32_____.s33_____.k407____), BENCH_S32______S33______K407____, BENCH_TYPE_STRING },
+        { 8064, 17, offsetof(bench, s34_____.k416____), BENCH_S34______K416____, BENCH_TYPE_STRING },
+        { 8082, 17, offsetof(bench, s34_____.k417____), BENCH_S34______K417____, BENCH_TYPE_STRING },
+        { 8100, 17, offsetof(bench, s34_____.k418____), BENCH_S34______K418____, BENCH_TYPE_STRING },
+        { 8118, 17, offsetof(bench, s34_____.k419____), BENCH_S34______K419____, BENCH_TYPE_STRING },
+        { 8136, 17, offsetof(bench, s34_____.k420____), BENCH_S34______K420____, BENCH_TYPE_STRING },
+        { 8154, 17, offsetof(bench, s34_____.k421____), BENCH_S34______K421____, BENCH_TYPE_STRING },
+        { 8172, 17, offsetof(bench, s34_____.k422____), BENCH_S34______K422____, BENCH_TYPE_STRING },
+        { 8190, 17, offsetof(bench, s34_____.k423____), BENCH_S34______K423____, BENCH_TYPE_STRING },
+        { 8208, 26, offsetof(bench, s34_____.s35_____.k424____), BENCH_S34______S35______K424____, BENCH_TYPE_STRING },
+        { 8235, 26, offsetof(bench, s34_____.s35_____.k425____), BENCH_S34______S35______K425____, BENCH_TYPE_STRING },
+        { 8262, 26, offsetof(bench, s34_____.s35_____.k426____), BENCH_S34______S35______K426____, BENCH_TYPE_STRING },
+        { 8289, 26, offsetof(bench, s34_____.s35_____.k427____), BENCH_S34______S35______K427____, BENCH_TYPE_STRING },
+        { 8316, 26, offsetof(bench, s34_____.s35_____.k428____), BENCH_S34______S35______K428____, BENCH_TYPE_STRING },
+        { 8343, 26, offsetof(bench, s34_____.s35_____.k429____), BENCH_S34______S35______K429____, BENCH_TYPE_STRING },
+        { 8370, 26, offsetof(bench, s34_____.s35_____.k430____), BENCH_S34______S35______K430____, BENCH_TYPE_STRING },
+        { 8397, 26, offsetof(bench, s34_____.s35_____.k431____), BENCH_S34______S35______K431____, BENCH_TYPE_STRING },
+        { 8424, 17, offsetof(bench, s36_____.k440____), BENCH_S36______K440____, BENCH_TYPE_STRING },
+        { 8442, 17, offsetof(bench, s36_____.k441____), BENCH_S36______K441____, BENCH_TYPE_STRING },
+        { 8460, 17, offsetof(bench, s36_____.k442____), BENCH_S36______K442____, BENCH_TYPE_STRING },
+        { 8478, 17, offsetof(bench, s36_____.k443____), BENCH_S36______K443____, BENCH_TYPE_STRING },
+        { 8496, 17, offsetof(bench, s36_____.k444____), BENCH_S36______K444____, BENCH_TYPE_STRING },
+        { 8514, 17, offsetof(bench, s36_____.k445____), BENCH_S36______K445____, BENCH_TYPE_STRING },
+        { 8532, 17, offsetof(bench, s36_____.k446____), BENCH_S36______K446____, BENCH_TYPE_STRING },
+        { 8550, 17, offsetof(bench, s36_____.k447____), BENCH_S36______K447____, BENCH_TYPE_STRING },
+        { 8568, 26, offsetof(bench, s36_____.s37_____.k448____), BENCH_S36______S37______K448____, BENCH_TYPE_STRING },
+        { 8595, 26, offsetof(bench, s36_____.s37_____.k449____), BENCH_S36______S37______K449____, BENCH_TYPE_STRING },
+        { 8622, 26, offsetof(bench, s36_____.s37_____.k450____), BENCH_S36______S37______K450____, BENCH_TYPE_STRING },
+        { 8649, 26, offsetof(bench, s36_____.s37_____.k451____), BENCH_S36______S37______K451____, BENCH_TYPE_STRING },
+        { 8676, 26, offsetof(bench, s36_____.s37_____.k452____), BENCH_S36______S37______K452____, BENCH_TYPE_STRING },
+        { 8703, 26, offsetof(bench, s36_____.s37_____.k453____), BENCH_S36______S37______K453____, BENCH_TYPE_STRING },
+        { 8730, 26, offsetof(bench, s36_____.s37_____.k454____), BENCH_S36______S37______K454____, BENCH_TYPE_STRING },
+        { 8757, 26, offsetof(bench, s36_____.s37_____.k455____), BENCH_S36______S37______K455____, BENCH_TYPE_STRING },
+        { 8784, 17, offsetof(bench, s38_____.k464____), BENCH_S38______K464____, BENCH_TYPE_STRING },
+        { 8802, 17, offsetof(bench, s38_____.k465____), BENCH_S38______K465____, BENCH_TYPE_STRING },
+        { 8820, 17, offsetof(bench, s38_____.k466____), BENCH_S38______K466____, BENCH_TYPE_STRING },
+        { 8838, 17, offsetof(bench, s38_____.k467____), BENCH_S38______K467____, BENCH_TYPE_STRING },
+        { 8856, 17, offsetof(bench, s38_____.k468____), BENCH_S38______K468____, BENCH_TYPE_STRING },
+        { 8874, 17, offsetof(bench, s38_____.k469____), BENCH_S38______K469____, BENCH_TYPE_STRING },
+        { 8892, 17, offsetof(bench, s38_____.k470____), BENCH_S38______K470____, BENCH_TYPE_STRING },
+        { 8910, 17, offsetof(bench, s38_____.k471____), BENCH_S38______K471____, BENCH_TYPE_STRING },
+        { 8928, 26, offsetof(bench, s38_____.s39_____.k472____), BENCH_S38______S39______K472____, BENCH_TYPE_STRING },
+        { 8955, 26, offsetof(bench, s38_____.s39_____.k473____), BENCH_S38______S39______K473____, BENCH_TYPE_STRING },
+        { 8982, 26, offsetof(bench, s38_____.s39_____.k474____), BENCH_S38______S39______K474____, BENCH_TYPE_STRING },
+        { 9009, 26, offsetof(bench, s38_____.s39_____.k475____), BENCH_S38______S39______K475____, BENCH_TYPE_STRING },
+        { 9036, 26, offsetof(bench, s38_____.s39_____.k476____), BENCH_S38______S39______K476____, BENCH_TYPE_STRING },
+        { 9063, 26, offsetof(bench, s38_____.s39_____.k477____), BENCH_S38______S39______K477____, BENCH_TYPE_STRING },
+        { 9090, 26, offsetof(bench, s38_____.s39_____.k478____), BENCH_S38______S39______K478____, BENCH_TYPE_STRING },
+        { 9117, 26, offsetof(bench, s38_____.s39_____.k479____), BENCH_S38______S39______K479____, BENCH_TYPE_STRING },
+        { 9144, 17, offsetof(bench, s40_____.k488____), BENCH_S40______K488____, BENCH_TYPE_STRING },
+        { 9162, 17, offsetof(bench, s40_____.k489____), BENCH_S40______K489____, BENCH_TYPE_STRING },
+        { 9180, 17, offsetof(bench, s40_____.k490____), BENCH_S40______K490____, BENCH_TYPE_STRING },
+        { 9198, 17, offsetof(bench, s40_____.k491____), BENCH_S40______K491____, BENCH_TYPE_STRING },
+        { 9216, 17, offsetof(bench, s40_____.k492____), BENCH_S40______K492____, BENCH_TYPE_STRING },
+        { 9234, 17, offsetof(bench, s40_____.k493____), BENCH_S40______K493____, BENCH_TYPE_STRING },
+        { 9252, 17, offsetof(bench, s40_____.k494____), BENCH_S40______K494____, BENCH_TYPE_STRING },
+        { 9270, 17, offsetof(bench, s40_____.k495____), BENCH_S40______K495____, BENCH_TYPE_STRING },
+        { 9288, 26, offsetof(bench, s40_____.s41_____.k496____), BENCH_S40______S41______K496____, BENCH_TYPE_STRING },
+        { 9315, 26, offsetof(bench, s40_____.s41_____.k497____), BENCH_S40______S41______K497____, BENCH_TYPE_STRING },
+        { 9342, 26, offsetof(bench, s40_____.s41_____.k498____), BENCH_S40______S41______K498____, BENCH_TYPE_STRING },
+        { 9369, 26, offsetof(bench, s40_____.s41_____.k499____), BENCH_S40______S41______K499____, BENCH_TYPE_STRING },
+        { 9396, 26, offsetof(bench, s40_____.s41_____.k500____), BENCH_S40______S41______K500____, BENCH_TYPE_STRING },
+        { 9423, 26, offsetof(bench, s40_____.s41_____.k501____), BENCH_S40______S41______K501____, BENCH_TYPE_STRING },
+        { 9450, 26, offsetof(bench, s40_____.s41_____.k502____), BENCH_S40______S41______K502____, BENCH_TYPE_STRING },
+        { 9477, 26, offsetof(bench, s40_____.s41_____.k503____), BENCH_S40______S41______K503____, BENCH_TYPE_STRING },
+        { 9504, 17, offsetof(bench, s42_____.k512____), BENCH_S42______K512____, BENCH_TYPE_STRING },
+        { 9522, 17, offsetof(bench, s42_____.k513____), BENCH_S42______K513____, BENCH_TYPE_STRING },
+        { 9540, 17, offsetof(bench, s42_____.k514____), BENCH_S42______K514____, BENCH_TYPE_STRING },
+        { 9558, 17, offsetof(bench, s42_____.k515____), BENCH_S42______K515____, BENCH_TYPE_STRING },
+        { 9576, 17, offsetof(bench, s42_____.k516____), BENCH_S42______K516____, BENCH_TYPE_STRING },
+        { 9594, 17, offsetof(bench, s42_____.k517____), BENCH_S42______K517____, BENCH_TYPE_STRING },
+        { 9612, 17, offsetof(bench, s42_____.k518____), BENCH_S42______K518____, BENCH_TYPE_STRING },
+        { 9630, 17, offsetof(bench, s42_____.k519____), BENCH_S42______K519____, BENCH_TYPE_STRING },
+        { 9648, 26, offsetof(bench, s42_____.s43_____.k520____), BENCH_S42______S43______K520____, BENCH_TYPE_STRING },
+        { 9675, 26, offsetof(bench, s42_____.s43_____.k521____), BENCH_S42______S43______K521____, BENCH_TYPE_STRING },
+        { 9702, 26, offsetof(bench, s42_____.s43_____.k522____), BENCH_S42______S43______K522____, BENCH_TYPE_STRING },
+        { 9729, 26, offsetof(bench, s42_____.s43_____.k523____), BENCH_S42______S43______K523____, BENCH_TYPE_STRING },
+        { 9756, 26, offsetof(bench, s42_____.s43_____.k524____), BENCH_S42______S43______K524____, BENCH_TYPE_STRING },
+        { 9783, 26, offsetof(bench, s42_____.s43_____.k525____), BENCH_S42______S43______K525____, BENCH_TYPE_STRING },
+        { 9810, 26, offsetof(bench, s42_____.s43_____.k526____), BENCH_S42______S43______K526____, BENCH_TYPE_STRING },
+        { 9837, 26, offsetof(bench, s42_____.s43_____.k527____), BENCH_S42______S43______K527____, BENCH_TYPE_STRING },
+        { 9864, 17, offsetof(bench, s44_____.k536____), BENCH_S44______K536____, BENCH_TYPE_STRING },
+        { 9882, 17, offsetof(bench, s44_____.k537____), BENCH_S44______K537____, BENCH_TYPE_STRING },
+        { 9900, 17, offsetof(bench, s44_____.k538____), BENCH_S44______K538____, BENCH_TYPE_STRING },
+        { 9918, 17, offsetof(bench, s44_____.k539____), BENCH_S44______K539____, BENCH_TYPE_STRING },
+        { 9936, 17, offsetof(bench, s44_____.k540____), BENCH_S44______K540____, BENCH_TYPE_STRING },
+        { 9954, 17, offsetof(bench, s44_____.k541____), BENCH_S44______K541____, BENCH_TYPE_STRING },
+        { 9972, 17, offsetof(bench, s44_____.k542____), BENCH_S44______K542____, BENCH_TYPE_STRING },
+        { 9990, 17, offsetof(bench, s44_____.k543____), BENCH_S44______K543____, BENCH_TYPE_STRING },
+        { 10008, 26, offsetof(bench, s44_____.s45_____.k544____), BENCH_S44______S45______K544____, BENCH_TYPE_STRING },
+        { 10035, 26, offsetof(bench, s44_____.s45_____.k545____), BENCH_S44______S45______K545____, BENCH_TYPE_STRING },
+        { 10062, 26, offsetof(bench, s44_____.s45_____.k546____), BENCH_S44______S45______K546____, BENCH_TYPE_STRING },
+        { 10089, 26, offsetof(bench, s44_____.s45_____.k547____), BENCH_S44______S45______K547____, BENCH_TYPE_STRING },
+        { 10116, 26, offsetof(bench, s44_____.s45_____.k548____), BENCH_S44______S45______K548____, BENCH_TYPE_STRING },
+        { 10143, 26, offsetof(bench, s44_____.s45_____.k549____), BENCH_S44______S45______K549____, BENCH_TYPE_STRING },
+        { 10170, 26, offsetof(bench, s44_____.s45_____.k550____), BENCH_S44______S45______K550____, BENCH_TYPE_STRING },
+        { 10197, 26, offsetof(bench, s44_____.s45_____.k551____), BENCH_S44______S45______K551____, BENCH_TYPE_STRING },
+        { 10224, 17, offsetof(bench, s46_____.k560____), BENCH_S46______K560____, BENCH_TYPE_STRING },
+        { 10242, 17, offsetof(bench, s46_____.k561____), BENCH_S46______K561____, BENCH_TYPE_STRING },
+        { 10260, 17, offsetof(bench, s46_____.k562____), BENCH_S46______K562____, BENCH_TYPE_STRING },
+        { 10278, 17, offsetof(bench, s46_____.k563____), BENCH_S46______K563____, BENCH_TYPE_STRING },
+        { 10296, 17, offsetof(bench, s46_____.k564____), BENCH_S46______K564____, BENCH_TYPE_STRING },
+        { 10314, 17, offsetof(bench, s46_____.k565____), BENCH_S46______K565____, BENCH_TYPE_STRING },
+        { 10332, 17, offsetof(bench, s46_____.k566____), BENCH_S46______K566____, BENCH_TYPE_STRING },
+        { 10350, 17, offsetof(bench, s46_____.k567____), BENCH_S46______K567____, BENCH_TYPE_STRING },
+        { 10368, 26, offsetof(bench, s46_____.s47_____.k568____), BENCH_S46______S47______K568____, BENCH_TYPE_STRING },
+        { 10395, 26, offsetof(bench, s46_____.s47_____.k569____), BENCH_S46______S47______K569____, BENCH_TYPE_STRING },
+        { 10422, 26, offsetof(bench, s46_____.s47_____.k570____), BENCH_S46______S47______K570____, BENCH_TYPE_STRING },
+        { 10449, 26, offsetof(bench, s46_____.s47_____.k571____), BENCH_S46______S47______K571____, BENCH_TYPE_STRING },
+        { 10476, 26, offsetof(bench, s46_____.s47_____.k572____), BENCH_S46______S47______K572____, BENCH_TYPE_STRING },
+        { 10503, 26, offsetof(bench, s46_____.s47_____.k573____), BENCH_S46______S47______K573____, BENCH_TYPE_STRING },
+        { 10530, 26, offsetof(bench, s46_____.s47_____.k574____), BENCH_S46______S47______K574____, BENCH_TYPE_STRING },
+        { 10557, 26, offsetof(bench, s46_____.s47_____.k575____), BENCH_S46______S47______K575____, BENCH_TYPE_STRING },
+        { 10584, 17, offsetof(bench, s48_____.k584____), BENCH_S48______K584____, BENCH_TYPE_STRING },
+        { 10602, 17, offsetof(bench, s48_____.k585____), BENCH_S48______K585____, BENCH_TYPE_STRING },
+        { 10620, 17, offsetof(bench, s48_____.k586____), BENCH_S48______K586____, BENCH_TYPE_STRING },
+        { 10638, 17, offsetof(bench, s48_____.k587____), BENCH_S48______K587____, BENCH_TYPE_STRING },
+        { 10656, 17, offsetof(bench, s48_____.k588____), BENCH_S48______K588____, BENCH_TYPE_STRING },
+        { 10674, 17, offsetof(bench, s48_____.k589____), BENCH_S48______K589____, BENCH_TYPE_STRING },
+        { 10692, 17, offsetof(bench, s48_____.k590____), BENCH_S48______K590____, BENCH_TYPE_STRING },
+        { 10710, 17, offsetof(bench, s48_____.k591____), BENCH_S48______K591____, BENCH_TYPE_STRING },
+        { 10728, 26, offsetof(bench, s48_____.s49_____.k592____), BENCH_S48______S49______K592____, BENCH_TYPE_STRING },
+        { 10755, 26, offsetof(bench, s48_____.s49_____.k593____), BENCH_S48______S49______K593____, BENCH_TYPE_STRING },
+        { 10782, 26, offsetof(bench, s48_____.s49_____.k594____), BENCH_S48______S49______K594____, BENCH_TYPE_STRING },
+        { 10809, 26, offsetof(bench, s48_____.s49_____.k595____), BENCH_S48______S49______K595____, BENCH_TYPE_STRING },
+        { 10836, 26, offsetof(bench, s48_____.s49_____.k596____), BENCH_S48______S49______K596____, BENCH_TYPE_STRING },
+        { 10863, 26, offsetof(bench, s48_____.s49_____.k597____), BENCH_S48______S49______K597____, BENCH_TYPE_STRING },
+        { 10890, 26, offsetof(bench, s48_____.s49_____.k598____), BENCH_S48______S49______K598____, BENCH_TYPE_STRING },
+        { 10917, 26, offsetof(bench, s48_____.s49_____.k599____), BENCH_S48______S49______K599____, BENCH_TYPE_STRING },
+        { 10944, 17, offsetof(bench, s4______.k56_____), BENCH_S4_______K56_____, BENCH_TYPE_STRING },
+        { 10962, 17, offsetof(bench, s4______.k57_____), BENCH_S4_______K57_____, BENCH_TYPE_STRING },
+        { 10980, 17, offsetof(bench, s4______.k58_____), BENCH_S4_______K58_____, BENCH_TYPE_STRING },
+        { 10998, 17, offsetof(bench, s4______.k59_____), BENCH_S4_______K59_____, BENCH_TYPE_STRING },
+        { 11016, 17, offsetof(bench, s4______.k60_____), BENCH_S4_______K60_____, BENCH_TYPE_STRING },
+        { 11034, 17, offsetof(bench, s4______.k61_____), BENCH_S4_______K61_____, BENCH_TYPE_STRING },
+        { 11052, 17, offsetof(bench, s4______.k62_____), BENCH_S4_______K62_____, BENCH_TYPE_STRING },
+        { 11070, 17, offsetof(bench, s4______.k63_____), BENCH_S4_______K63_____, BENCH_TYPE_STRING },
+        { 11088, 26, offsetof(bench, s4______.s5______.k64_____), BENCH_S4_______S5_______K64_____, BENCH_TYPE_STRING },
+        { 11115, 26, offsetof(bench, s4______.s5______.k65_____), BENCH_S4_______S5_______K65_____, BENCH_TYPE_STRING },
+        { 11142, 26, offsetof(bench, s4______.s5______.k66_____), BENCH_S4_______S5_______K66_____, BENCH_TYPE_STRING },
+        { 11169, 26, offsetof(bench, s4______.s5______.k67_____), BENCH_S4_______S5_______K67_____, BENCH_TYPE_STRING },
+        { 11196, 26, offsetof(bench, s4______.s5______.k68_____), BENCH_S4_______S5_______K68_____, BENCH_TYPE_STRING },
+        { 11223, 26, offsetof(bench, s4______.s5______.k69_____), BENCH_S4_______S5_______K69_____, BENCH_TYPE_STRING },
+        { 11250, 26, offsetof(bench, s4______.s5______.k70_____), BENCH_S4_______S5_______K70_____, BENCH_TYPE_STRING },
+        { 11277, 26, offsetof(bench, s4______.s5______.k71_____), BENCH_S4_______S5_______K71_____, BENCH_TYPE_STRING },
+        { 11304, 17, offsetof(bench, s50_____.k608____), BENCH_S50______K608____, BENCH_TYPE_STRING },
+        { 11322, 17, offsetof(bench, s50_____.k609____), BENCH_S50______K609____, BENCH_TYPE_STRING },
+        { 11340, 17, offsetof(bench, s50_____.k610____), BENCH_S50______K610____, BENCH_TYPE_STRING },
+        { 11358, 17, offsetof(bench, s50_____.k611____), BENCH_S50______K611____, BENCH_TYPE_STRING },
+        { 11376, 17, offsetof(bench, s50_____.k612____), BENCH_S50______K612____, BENCH_TYPE_STRING },
+        { 11394, 17, offsetof(bench, s50_____.k613____), BENCH_S50______K613____, BENCH_TYPE_STRING },
+        { 11412, 17, offsetof(bench, s50_____.k614____), BENCH_S50______K614____, BENCH_TYPE_STRING },
+        { 11430, 17, offsetof(bench, s50_____.k615____), BENCH_S50______K615____, BENCH_TYPE_STRING },
+        { 11448, 26, offsetof(bench, s50_____.s51_____.k616____), BENCH_S50______S51______K616____, BENCH_TYPE_STRING },
+        { 11475, 26, offsetof(bench, s50_____.s51_____.k617____), BENCH_S50______S51______K617____, BENCH_TYPE_STRING },
+        { 11502, 26, offsetof(bench, s50_____.s51_____.k618____), BENCH_S50______S51______K618____, BENCH_TYPE_STRING },
+        { 11529, 26, offsetof(bench, s50_____.s51_____.k619____), BENCH_S50______S51______K619____, BENCH_TYPE_STRING },
+        { 11556, 26, offsetof(bench, s50_____.s51_____.k620____), BENCH_S50______S51______K620____, BENCH_TYPE_STRING },
+        { 11583, 26, offsetof(bench, s50_____.s51_____.k621____), BENCH_S50______S51______K621____, BENCH_TYPE_STRING },
+        { 11610, 26, offsetof(bench, s50_____.s51_____.k622____), BENCH_S50______S51______K622____, BENCH_TYPE_STRING },
+        { 11637, 26, offsetof(bench, s50_____.s51_____.k623____), BENCH_S50______S51______K623____, BENCH_TYPE_STRING },
+        { 11664, 17, offsetof(bench, s52_____.k632____), BENCH_S52______K632____, BENCH_TYPE_STRING },
+        { 11682, 17, offsetof(bench, s52_____.k633____), BENCH_S52______K633____, BENCH_TYPE_STRING },
+        { 11700, 17, offsetof(bench, s52_____.k634____), BENCH_S52______K634____, BENCH_TYPE_STRING },
+        { 11718, 17, offsetof(bench, s52_____.k635____), BENCH_S52______K635____, BENCH_TYPE_STRING },
+        { 11736, 17, offsetof(bench, s52_____.k636____), BENCH_S52______K636____, BENCH_TYPE_STRING },
+        { 11754, 17, offsetof(bench, s52_____.k637____), BENCH_S52______K637____, BENCH_TYPE_STRING },
+        { 11772, 17, offsetof(bench, s52_____.k638____), BENCH_S52______K638____, BENCH_TYPE_STRING },
+        { 11790, 17, offsetof(bench, s52_____.k639____), BENCH_S52______K639____, BENCH_TYPE_STRING },
+        { 11808, 26, offsetof(bench, s52_____.s53_____.k640____), BENCH_S52______S53______K640____, BENCH_TYPE_STRING },
+        { 11835, 26, offsetof(bench, s52_____.s53_____.k641____), BENCH_S52______S53______K641____, BENCH_TYPE_STRING },
+        { 11862, 26, offsetof(bench, s52_____.s53_____.k642____), BENCH_S52______S53______K642____, BENCH_TYPE_STRING },
+        { 11889, 26, offsetof(bench, s52_____.s53_____.k643____), BENCH_S52______S53______K643____, BENCH_TYPE_STRING },
+        { 11916, 26, offsetof(bench, s52_____.s53_____.k644____), BENCH_S52______S53______K644____, BENCH_TYPE_STRING },
+        { 11943, 26, offsetof(bench, s52_____.s53_____.k645____), BENCH_S52______S53______K645____, BENCH_TYPE_STRING },
+        { 11970, 26, offsetof(bench, s52_____.s53_____.k646____), BENCH_S52______S53______K646____, BENCH_TYPE_STRING },
+        { 11997, 26, offsetof(bench, s52_____.s53_____.k647____), BENCH_S52______S53______K647____, BENCH_TYPE_STRING },
+        { 12024, 17, offsetof(bench, s54_____.k656____), BENCH_S54______K656____, BENCH_TYPE_STRING },
+        { 12042, 17, offsetof(bench, s54_____.k657____), BENCH_S54______K657____, BENCH_TYPE_STRING },
+        { 12060, 17, offsetof(bench, s54_____.k658____), BENCH_S54______K658____, BENCH_TYPE_STRING },
+        { 12078, 17, offsetof(bench, s54_____.k659____), BENCH_S54______K659____, BENCH_TYPE_STRING },
+        { 12096, 17, offsetof(bench, s54_____.k660____), BENCH_S54______K660____, BENCH_TYPE_STRING },
+        { 12114, 17, offsetof(bench, s54_____.k661____), BENCH_S54______K661____, BENCH_TYPE_STRING },
+        { 12132, 17, offsetof(bench, s54_____.k662____), BENCH_S54______K662____, BENCH_TYPE_STRING },
+        { 12150, 17, offsetof(bench, s54_____.k663____), BENCH_S54______K663____, BENCH_TYPE_STRING },
+        { 12168, 26, offsetof(bench, s54_____.s55_____.k664____), BENCH_S54______S55______K664____, BENCH_TYPE_STRING },
+        { 12195, 26, offsetof(bench, s54_____.s55_____.k665____), BENCH_S54______S55______K665____, BENCH_TYPE_STRING },
+        { 12222, 26, offsetof(bench, s54_____.s55_____.k666____), BENCH_S54______S55______K666____, BENCH_TYPE_STRING },
+        { 12249, 26, offsetof(bench, s54_____.s55_____.k667____), BENCH_S54______S55______K667____, BENCH_TYPE_STRING },
+        { 12276, 26, offsetof(bench, s54_____.s55_____.k668____), BENCH_S54______S55______K668____, BENCH_TYPE_STRING },
+        { 12303, 26, offsetof(bench, s54_____.s55_____.k669____), BENCH_S54______S55______K669____, BENCH_TYPE_STRING },
+        { 12330, 26, offsetof(bench, s54_____.s55_____.k670____), BENCH_S54______S55______K670____, BENCH_TYPE_STRING },
+        { 12357, 26, offsetof(bench, s54_____.s55_____.k671____), BENCH_S54______S55______K671____, BENCH_TYPE_STRING },
+        { 12384, 17, offsetof(bench, s56_____.k680____), BENCH_S56______K680____, BENCH_TYPE_STRING },
+        { 12402, 17, offsetof(bench, s56_____.k681____), BENCH_S56______K681____, BENCH_TYPE_STRING },
+        { 12420, 17, offsetof(bench, s56_____.k682____), BENCH_S56______K682____, BENCH_TYPE_STRING },
+        { 12438, 17, offsetof(bench, s56_____.k683____), BENCH_S56______K683____, BENCH_TYPE_STRING },
+        { 12456, 17, offsetof(bench, s56_____.k684____), BENCH_S56______K684____, BENCH_TYPE_STRING },
+        { 12474, 17, offsetof(bench, s56_____.k685____), BENCH_S56______K685____, BENCH_TYPE_STRING },
+        { 12492, 17, offsetof(bench, s56_____.k686____), BENCH_S56______K686____, BENCH_TYPE_STRING },
+        { 12510, 17, offsetof(bench, s56_____.k687____), BENCH_S56______K687____, BENCH_TYPE_STRING },
+        { 12528, 26, offsetof(bench, s56_____.s57_____.k688____), BENCH_S56______S57______K688____, BENCH_TYPE_STRING },
+        { 12555, 26, offsetof(bench, s56_____.s57_____.k689____), BENCH_S56______S57______K689____, BENCH_TYPE_STRING },
+        { 12582, 26, offsetof(bench, s56_____.s57_____.k690____), BENCH_S56______S57______K690____, BENCH_TYPE_STRING },
+        { 12609, 26, offsetof(bench, s56_____.s57_____.k691____), BENCH_S56______S57______K691____, BENCH_TYPE_STRING },
+        { 12636, 26, offsetof(bench, s56_____.s57_____.k692____), BENCH_S56______S57______K692____, BENCH_TYPE_STRING },
+        { 12663, 26, offsetof(bench, s56_____.s57_____.k693____), BENCH_S56______S57______K693____, BENCH_TYPE_STRING },
+        { 12690, 26, offsetof(bench, s56_____.s57_____.k694____), BENCH_S56______S57______K694____, BENCH_TYPE_STRING },
+        { 12717, 26, offsetof(bench, s56_____.s57_____.k695____), BENCH_S56______S57______K695____, BENCH_TYPE_STRING },
+        { 12744, 17, offsetof(bench, s58_____.k704____), BENCH_S58______K704____, BENCH_TYPE_STRING },
+        { 12762, 17, offsetof(bench, s58_____.k705____), BENCH_S58______K705____, BENCH_TYPE_STRING },
+        { 12780, 17, offsetof(bench, s58_____.k706____), BENCH_S58______K706____, BENCH_TYPE_STRING },
+        { 12798, 17, offsetof(bench, s58_____.k707____), BENCH_S58______K707____, BENCH_TYPE_STRING },
+        { 12816, 17, offsetof(bench, s58_____.k708____), BENCH_S58______K708____, BENCH_TYPE_STRING },
+        { 12834, 17, offsetof(bench, s58_____.k709____), BENCH_S58______K709____, BENCH_TYPE_STRING },
+        { 12852, 17, offsetof(bench, s58_____.k710____), BENCH_S58______K710____, BENCH_TYPE_STRING },
+        { 12870, 17, offsetof(bench, s58_____.k711____), BENCH_S58______K711____, BENCH_TYPE_STRING },
+        { 12888, 26, offsetof(bench, s58_____.s59_____.k712____), BENCH_S58______S59______K712____, BENCH_TYPE_STRING },
+        { 12915, 26, offsetof(bench, s58_____.s59_____.k713____), BENCH_S58______S59______K713____, BENCH_TYPE_STRING },
+        { 12942, 26, offsetof(bench, s58_____.s59_____.k714____), BENCH_S58______S59______K714____, BENCH_TYPE_STRING },
+        { 12969, 26, offsetof(bench, s58_____.s59_____.k715____), BENCH_S58______S59______K715____, BENCH_TYPE_STRING },
+        { 12996, 26, offsetof(bench, s58_____.s59_____.k716____), BENCH_S58______S59______K716____, BENCH_TYPE_STRING },
+        { 13023, 26, offsetof(bench, s58_____.s59_____.k717____), BENCH_S58______S59______K717____, BENCH_TYPE_STRING },
+        { 13050, 26, offsetof(bench, s58_____.s59_____.k718____), BENCH_S58______S59______K718____, BENCH_TYPE_STRING },
+        { 13077, 26, offsetof(bench, s58_____.s59_____.k719____), BENCH_S58______S59______K719____, BENCH_TYPE_STRING },
+        { 13104, 17, offsetof(bench, s60_____.k728____), BENCH_S60______K728____, BENCH_TYPE_STRING },
+        { 13122, 17, offsetof(bench, s60_____.k729____), BENCH_S60______K729____, BENCH_TYPE_STRING },
+        { 13140, 17, offsetof(bench, s60_____.k730____), BENCH_S60______K730____, BENCH_TYPE_STRING },
+        { 13158, 17, offsetof(bench, s60_____.k731____), BENCH_S60______K731____, BENCH_TYPE_STRING },
+        { 13176, 17, offsetof(bench, s60_____.k732____), BENCH_S60______K732____, BENCH_TYPE_STRING },
+        { 13194, 17, offsetof(bench, s60_____.k733____), BENCH_S60______K733____, BENCH_TYPE_STRING },
+        { 13212, 17, offsetof(bench, s60_____.k734____), BENCH_S60______K734____, BENCH_TYPE_STRING },
+        { 13230, 17, offsetof(bench, s60_____.k735____), BENCH_S60______K735____, BENCH_TYPE_STRING },
+        { 13248, 26, offsetof(bench, s60_____.s61_____.k736____), BENCH_S60______S61______K736____, BENCH_TYPE_STRING },
+        { 13275, 26, offsetof(bench, s60_____.s61_____.k737____), BENCH_S60______S61______K737____, BENCH_TYPE_STRING },
+        { 13302, 26, offsetof(bench, s60_____.s61_____.k738____), BENCH_S60______S61______K738____, BENCH_TYPE_STRING },
+        { 13329, 26, offsetof(bench, s60_____.s61_____.k739____), BENCH_S60______S61______K739____, BENCH_TYPE_STRING },
+        { 13356, 26, offsetof(bench, s60_____.s61_____.k740____), BENCH_S60______S61______K740____, BENCH_TYPE_STRING },
+        { 13383, 26, offsetof(bench, s60_____.s61_____.k741____), BENCH_S60______S61______K741____, BENCH_TYPE_STRING },
+        { 13410, 26, offsetof(bench, s60_____.s61_____.k742____), BENCH_S60______S61______K742____, BENCH_TYPE_STRING },
+        { 13437, 26, offsetof(bench, s60_____.s61_____.k743____), BENCH_S60______S61______K743____, BENCH_TYPE_STRING },
+        { 13464, 17, offsetof(bench, s62_____.k752____), BENCH_S62______K752____, BENCH_TYPE_STRING },
+        { 13482, 17, offsetof(bench, s62_____.k753____), BENCH_S62______K753____, BENCH_TYPE_STRING },
+        { 13500, 17, offsetof(bench, s62_____.k754____), BENCH_S62______K754____, BENCH_TYPE_STRING },
+        { 13518, 17, offsetof(bench, s62_____.k755____), BENCH_S62______K755____, BENCH_TYPE_STRING },
+        { 13536, 17, offsetof(bench, s62_____.k756____), BENCH_S62______K756____, BENCH_TYPE_STRING },
+        { 13554, 17, offsetof(bench, s62_____.k757____), BENCH_S62______K757____, BENCH_TYPE_STRING },
+        { 13572, 17, offsetof(bench, s62_____.k758____), BENCH_S62______K758____, BENCH_TYPE_STRING },
+        { 13590, 17, offsetof(bench, s62_____.k759____), BENCH_S62______K759____, BENCH_TYPE_STRING },
+        { 13608, 26, offsetof(bench, s62_____.s63_____.k760____), BENCH_S62______S63______K760____, BENCH_TYPE_STRING },
+        { 13635, 26, offsetof(bench, s62_____.s63_____.k761____), BENCH_S62______S63______K761____, BENCH_TYPE_STRING },
+        { 13662, 26, offsetof(bench, s62_____.s63_____.k762____), BENCH_S62______S63______K762____, BENCH_TYPE_STRING },
+        { 13689, 26, offsetof(bench, s62_____.s63_____.k763____), BENCH_S62______S63______K763____, BENCH_TYPE_STRING },
+        { 13716, 26, offsetof(bench, s62_____.s63_____.k764____), BENCH_S62______S63______K764____, BENCH_TYPE_STRING },
+        { 13743, 26, offsetof(bench, s62_____.s63_____.k765____), BENCH_S62______S63______K765____, BENCH_TYPE_STRING },
+        { 13770, 26, offsetof(bench, s62_____.s63_____.k766____), BENCH_S62______S63______K766____, BENCH_TYPE_STRING },
+        { 13797, 26, offsetof(bench, s62_____.s63_____.k767____), BENCH_S62______S63______K767____, BENCH_TYPE_STRING },
+        { 13824, 17, offsetof(bench, s64_____.k776____), BENCH_S64______K776____, BENCH_TYPE_STRING },
+        { 13842, 17, offsetof(bench, s64_____.k777____), BENCH_S64______K777____, BENCH_TYPE_STRING },
+        { 13860, 17, offsetof(bench, s64_____.k778____), BENCH_S64______K778____, BENCH_TYPE_STRING },
+        { 13878, 17, offsetof(bench, s64_____.k779____), BENCH_S64______K779____, BENCH_TYPE_STRING },
+        { 13896, 17, offsetof(bench, s64_____.k780____), BENCH_S64______K780____, BENCH_TYPE_STRING },
+        { 13914, 17, offsetof(bench, s64_____.k781____), BENCH_S64______K781____, BENCH_TYPE_STRING },
+        { 13932, 17, offsetof(bench, s64_____.k782____), BENCH_S64______K782____, BENCH_TYPE_STRING },
+        { 13950, 17, offsetof(bench, s64_____.k783____), BENCH_S64______K783____, BENCH_TYPE_STRING },
+        { 13968, 26, offsetof(bench, s64_____.s65_____.k784____), BENCH_S64______S65______K784____, BENCH_TYPE_STRING },
+        { 13995, 26, offsetof(bench, s64_____.s65_____.k785____), BENCH_S64______S65______K785____, BENCH_TYPE_STRING },
+        { 14022, 26, offsetof(bench, s64_____.s65_____.k786____), BENCH_S64______S65______K786____, BENCH_TYPE_STRING },
+        { 14049, 26, offsetof(bench, s64_____.s65_____.k787____), BENCH_S64______S65______K787____, BENCH_TYPE_STRING },
+        { 14076, 26, offsetof(bench, s64_____.s65_____.k788____), BENCH_S64______S65______K788____, BENCH_TYPE_STRING },
+        { 14103, 26, offsetof(bench, s64_____.s65_____.k789____), BENCH_S64______S65______K789____, BENCH_TYPE_STRING },
+        { 14130, 26, offsetof(bench, s64_____.s65_____.k790____), BENCH_S64______S65______K790____, BENCH_TYPE_STRING },
+        { 14157, 26, offsetof(bench, s64_____.s65_____.k791____), BENCH_S64______S65______K791____, BENCH_TYPE_STRING },
+        { 14184, 17, offsetof(bench, s66_____.k800____), BENCH_S66______K800____, BENCH_TYPE_STRING },
+        { 14202, 17, offsetof(bench, s66_____.k801____), BENCH_S66______K801____, BENCH_TYPE_STRING },
+        { 14220, 17, offsetof(bench, s66_____.k802____), BENCH_S66______K802____, BENCH_TYPE_STRING },
+        { 14238, 17, offsetof(bench, s66_____.k803____), BENCH_S66______K803____, BENCH_TYPE_STRING },
+        { 14256, 17, offsetof(bench, s66_____.k804____), BENCH_S66______K804____, BENCH_TYPE_STRING },
+        { 14274, 17, offsetof(bench, s66_____.k805____), BENCH_S66______K805____, BENCH_TYPE_STRING },
+        { 14292, 17, offsetof(bench, s66_____.k806____), BENCH_S66______K806____, BENCH_TYPE_STRING },
+        { 14310, 17, offsetof(bench, s66_____.k807____), BENCH_S66______K807____, BENCH_TYPE_STRING },
+        { 14328, 26, offsetof(bench, s66_____.s67_____.k808____), BENCH_S66______S67______K808____, BENCH_TYPE_STRING },
+        { 14355, 26, offsetof(bench, s66_____.s67_____.k809____), BENCH_S66______S67______K809____, BENCH_TYPE_STRING },
+        { 14382, 26, offsetof(bench, s66_____.s67_____.k810____), BENCH_S66______S67______K810____, BENCH_TYPE_STRING },
+        { 14409, 26, offsetof(bench, s66_____.s67_____.k811____), BENCH_S66______S67______K811____, BENCH_TYPE_STRING },
+        { 14436, 26, offsetof(bench, s66_____.s67_____.k812____), BENCH_S66______S67______K812____, BENCH_TYPE_STRING },
+        { 14463, 26, offsetof(bench, s66_____.s67_____.k813____), BENCH_S66______S67______K813____, BENCH_TYPE_STRING },
+        { 14490, 26, offsetof(bench, s66_____.s67_____.k814____), BENCH_S66______S67______K814____, BENCH_TYPE_STRING },
+        { 14517, 26, offsetof(bench, s66_____.s67_____.k815____), BENCH_S66______S67______K815____, BENCH_TYPE_STRING },
+        { 14544, 17, offsetof(bench, s68_____.k824____), BENCH_S68______K824____, BENCH_TYPE_STRING },
+        { 14562, 17, offsetof(bench, s68_____.k825____), BENCH_S68______K825____, BENCH_TYPE_STRING },
+        { 14580, 17, offsetof(bench, s68_____.k826____), BENCH_S68______K826____, BENCH_TYPE_STRING },
+        { 14598, 17, offsetof(bench, s68_____.k827____), BENCH_S68______K827____, BENCH_TYPE_STRING },
+        { 14616, 17, offsetof(bench, s68_____.k828____), BENCH_S68______K828____, BENCH_TYPE_STRING },
+        { 14634, 17, offsetof(bench, s68_____.k829____), BENCH_S68______K829____, BENCH_TYPE_STRING },
+        { 14652, 17, offsetof(bench, s68_____.k830____), BENCH_S68______K830____, BENCH_TYPE_STRING },
+        { 14670, 17, offsetof(bench, s68_____.k831____), BENCH_S68______K831____, BENCH_TYPE_STRING },
+        { 14688, 26, offsetof(bench, s68_____.s69_____.k832____), BENCH_S68______S69______K832____, BENCH_TYPE_STRING },
+        { 14715, 26, offsetof(bench, s68_____.s69_____.k833____), BENCH_S68______S69______K833____, BENCH_TYPE_STRING },
+        { 14742, 26, offsetof(bench, s68_____.s69_____.k834____), BENCH_S68______S69______K834____, BENCH_TYPE_STRING },
+        { 14769, 26, offsetof(bench, s68_____.s69_____.k835____), BENCH_S68______S69______K835____, BENCH_TYPE_STRING },
+        { 14796, 26, offsetof(bench, s68_____.s69_____.k836____), BENCH_S68______S69______K836____, BENCH_TYPE_STRING },
+        { 14823, 26, offsetof(bench, s68_____.s69_____.k837____), BENCH_S68______S69______K837____, BENCH_TYPE_STRING },
+        { 14850, 26, offsetof(bench, s68_____.s69_____.k838____), BENCH_S68______S69______K838____, BENCH_TYPE_STRING },
+        { 14877, 26, offsetof(bench, s68_____.s69_____.k839____), BENCH_S68______S69______K839____, BENCH_TYPE_STRING },
+        { 14904, 17, offsetof(bench, s6______.k80_____), BENCH_S6_______K80_____, BENCH_TYPE_STRING },
+        { 14922, 17, offsetof(bench, s6______.k81_____), BENCH_S6_______K81_____, BENCH_TYPE_STRING },
+        { 14940, 17, offsetof(bench, s6______.k82_____), BENCH_S6_______K82_____, BENCH_TYPE_STRING },
+        { 14958, 17, offsetof(bench, s6______.k83_____), BENCH_S6_______K83_____, BENCH_TYPE_STRING },
+        { 14976, 17, offsetof(bench, s6______.k84_____), BENCH_S6_______K84_____, BENCH_TYPE_STRING },
+        { 14994, 17, offsetof(bench, s6______.k85_____), BENCH_S6_______K85_____, BENCH_TYPE_STRING },
+        { 15012, 17, offsetof(bench, s6______.k86_____), BENCH_S6_______K86_____, BENCH_TYPE_STRING },
+        { 15030, 17, offsetof(bench, s6______.k87_____), BENCH_S6_______K87_____, BENCH_TYPE_STRING },
+        { 15048, 26, offsetof(bench, s6______.s7______.k88_____), BENCH_S6_______S7_______K88_____, BENCH_TYPE_STRING },
+        { 15075, 26, offsetof(bench, s6______.s7______.k89_____), BENCH_S6_______S7_______K89_____, BENCH_TYPE_STRING },
+        { 15102, 26, offsetof(bench, s6______.s7______.k90_____), BENCH_S6_______S7_______K90_____, BENCH_TYPE_STRING },
+        { 15129, 26, offsetof(bench, s6______.s7______.k91_____), BENCH_S6_______S7_______K91_____, BENCH_TYPE_STRING },
+        { 15156, 26, offsetof(bench, s6______.s7______.k92_____), BENCH_S6_______S7_______K92_____, BENCH_TYPE_STRING },
+        { 15183, 26, offsetof(bench, s6______.s7______.k93_____), BENCH_S6_______S7_______K93_____, BENCH_TYPE_STRING },
+        { 15210, 26, offsetof(bench, s6______.s7______.k94_____), BENCH_S6_______S7_______K94_____, BENCH_TYPE_STRING },
+        { 15237, 26, offsetof(bench, s6______.s7______.k95_____), BENCH_S6_______S7_______K95_____, BENCH_TYPE_STRING },
+        { 15264, 17, offsetof(bench, s70_____.k848____), BENCH_S70______K848____, BENCH_TYPE_STRING },
+        { 15282, 17, offsetof(bench, s70_____.k849____), BENCH_S70______K849____, BENCH_TYPE_STRING },
+        { 15300, 17, offsetof(bench, s70_____.k850____), BENCH_S70______K850____, BENCH_TYPE_STRING },
+        { 15318, 17, offsetof(bench, s70_____.k851____), BENCH_S70______K851____, BENCH_TYPE_STRING },
+        { 15336, 17, offsetof(bench, s70_____.k852____), BENCH_S70______K852____, BENCH_TYPE_STRING },
+        { 15354, 17, offsetof(bench, s70_____.k853____), BENCH_S70______K853____, BENCH_TYPE_STRING },
+        { 15372, 17, offsetof(bench, s70_____.k854____), BENCH_S70______K854____, BENCH_TYPE_STRING },
+        { 15390, 17, offsetof(bench, s70_____.k855____), BENCH_S70______K855____, BENCH_TYPE_STRING },
+        { 15408, 26, offsetof(bench, s70_____.s71_____.k856____), BENCH_S70______S71______K856____, BENCH_TYPE_STRING },
+        { 15435, 26, offsetof(bench, s70_____.s71_____.k857____), BENCH_S70______S71______K857____, BENCH_TYPE_STRING },
+        { 15462, 26, offsetof(bench, s70_____.s71_____.k858____), BENCH_S70______S71______K858____, BENCH_TYPE_STRING },
+        { 15489, 26, offsetof(bench, s70_____.s71_____.k859____), BENCH_S70______S71______K859____, BENCH_TYPE_STRING },
+        { 15516, 26, offsetof(bench, s70_____.s71_____.k860____), BENCH_S70______S71______K860____, BENCH_TYPE_STRING },
+        { 15543, 26, offsetof(bench, s70_____.s71_____.k861____), BENCH_S70______S71______K861____, BENCH_TYPE_STRING },
+        { 15570, 26, offsetof(bench, s70_____.s71_____.k862____), BENCH_S70______S71______K862____, BENCH_TYPE_STRING },
+        { 15597, 26, offsetof(bench, s70_____.s71_____.k863____), BENCH_S70______S71______K863____, BENCH_TYPE_STRING },
+        { 15624, 17, offsetof(bench, s72_____.k872____), BENCH_S72______K872____, BENCH_TYPE_STRING },
+        { 15642, 17, offsetof(bench, s72_____.k873____), BENCH_S72______K873____, BENCH_TYPE_STRING },
+        { 15660, 17, offsetof(bench, s72_____.k874____), BENCH_S72______K874____, BENCH_TYPE_STRING },
+        { 15678, 17, offsetof(bench, s72_____.k875____), BENCH_S72______K875____, BENCH_TYPE_STRING },
+        { 15696, 17, offsetof(bench, s72_____.k876____), BENCH_S72______K876____, BENCH_TYPE_STRING },
+        { 15714, 17, offsetof(bench, s72_____.k877____), BENCH_S72______K877____, BENCH_TYPE_STRING },
+        { 15732, 17, offsetof(bench, s72_____.k878____), BENCH_S72______K878____, BENCH_TYPE_STRING },
+        { 15750, 17, offsetof(bench, s72_____.k879____), BENCH_S72______K879____, BENCH_TYPE_STRING },
+        { 15768, 26, offsetof(bench, s72_____.s73_____.k880____), BENCH_S72______S73______K880____, BENCH_TYPE_STRING },
+        { 15795, 26, offsetof(bench, s72_____.s73_____.k881____), BENCH_S72______S73______K881____, BENCH_TYPE_STRING },
+        { 15822, 26, offsetof(bench, s72_____.s73_____.k882____), BENCH_S72______S73______K882____, BENCH_TYPE_STRING },
+        { 15849, 26, offsetof(bench, s72_____.s73_____.k883____), BENCH_S72______S73______K883____, BENCH_TYPE_STRING },
+        { 15876, 26, offsetof(bench, s72_____.s73_____.k884____), BENCH_S72______S73______K884____, BENCH_TYPE_STRING },
+        { 15903, 26, offsetof(bench, s72_____.s73_____.k885____), BENCH_S72______S73______K885____, BENCH_TYPE_STRING },
+        { 15930, 26, offsetof(bench, s72_____.s73_____.k886____), BENCH_S72______S73______K886____, BENCH_TYPE_STRING },
+        { 15957, 26, offsetof(bench, s72_____.s73_____.k887____), BENCH_S72______S73______K887____, BENCH_TYPE_STRING },
+        { 15984, 17, offsetof(bench, s74_____.k896____), BENCH_S74______K896____, BENCH_TYPE_STRING },
+        { 16002, 17, offsetof(bench, s74_____.k897____), BENCH_S74______K897____, BENCH_TYPE_STRING },
+        { 16020, 17, offsetof(bench, s74_____.k898____), BENCH_S74______K898____, BENCH_TYPE_STRING },
+        { 16038, 17, offsetof(bench, s74_____.k899____), BENCH_S74______K899____, BENCH_TYPE_STRING },
+        { 16056, 17, offsetof(bench, s74_____.k900____), BENCH_S74______K900____, BENCH_TYPE_STRING },
+        { 16074, 17, offsetof(bench, s74_____.k901____), BENCH_S74______K901____, BENCH_TYPE_STRING },
+        { 16092, 17, offsetof(bench, s74_____.k902____), BENCH_S74______K902____, BENCH_TYPE_STRING },
+        { 16110, 17, offsetof(bench, s74_____.k903____), BENCH_S74______K903____, BENCH_TYPE_STRING },
+        { 16128, 26, offsetof(bench, s74_____.s75_____.k904____), BENCH_S74______S75______K904____, BENCH_TYPE_STRING },
+        { 16155, 26, offsetof(bench, s74_____.s75_____.k905____), BENCH_S74______S75______K905____, BENCH_TYPE_STRING },
+        { 16182, 26, offsetof(bench, s74_____.s75_____.k906____), BENCH_S74______S75______K906____, BENCH_TYPE_STRING },
+        { 16209, 26, offsetof(bench, s74_____.s75_____.k907____), BENCH_S74______S75______K907____, BENCH_TYPE_STRING },
+        { 16236, 26, offsetof(bench, s74_____.s75_____.k908____), BENCH_S74______S75______K908____, BENCH_TYPE_STRING },
+        { 16263, 26, offsetof(bench, s74_____.s75_____.k909____), BENCH_S74______S75______K909____, BENCH_TYPE_STRING },
+        { 16290, 26, offsetof(bench, s74_____.s75_____.k910____), BENCH_S74______S75______K910____, BENCH_TYPE_STRING },
+        { 16317, 26, offsetof(bench, s74_____.s75_____.k911____), BENCH_S74______S75______K911____, BENCH_TYPE_STRING },
+        { 16344, 17, offsetof(bench, s76_____.k920____), BENCH_S76______K920____, BENCH_TYPE_STRING },
+        { 16362, 17, offsetof(bench, s76_____.k921____), BENCH_S76______K921____, BENCH_TYPE_STRING },
+        { 16380, 17, offsetof(bench, s76_____.k922____), BENCH_S76______K922____, BENCH_TYPE_STRING },
+        { 16398, 17, offsetof(bench, s76_____.k923____), BENCH_S76______K923____, BENCH_TYPE_STRING },
+        { 16416, 17, offsetof(bench, s76_____.k924____), BENCH_S76______K924____, BENCH_TYPE_STRING },
+        { 16434, 17, offsetof(bench, s76_____.k925____), BENCH_S76______K925____, BENCH_TYPE_STRING },
+        { 16452, 17, offsetof(bench, s76_____.k926____), BENCH_S76______K926____, BENCH_TYPE_STRING },
+        { 16470, 17, offsetof(bench, s76_____.k927____), BENCH_S76______K927____, BENCH_TYPE_STRING },
+        { 16488, 26, offsetof(bench, s76_____.s77_____.k928____), BENCH_S76______S77______K928____, BENCH_TYPE_STRING },
+        { 16515, 26, offsetof(bench, s76_____.s77_____.k929____), BENCH_S76______S77______K929____, BENCH_TYPE_STRING },
+        { 16542, 26, offsetof(bench, s76_____.s77_____.k930____), BENCH_S76______S77______K930____, BENCH_TYPE_STRING },
+        { 16569, 26, offsetof(bench, s76_____.s77_____.k931____), BENCH_S76______S77______K931____, BENCH_TYPE_STRING },
+        { 16596, 26, offsetof(bench, s76_____.s77_____.k932____), BENCH_S76______S77______K932____, BENCH_TYPE_STRING },
+        { 16623, 26, offsetof(bench, s76_____.s77_____.k933____), BENCH_S76______S77______K933____, BENCH_TYPE_STRING },
+        { 16650, 26, offsetof(bench, s76_____.s77_____.k934____), BENCH_S76______S77______K934____, BENCH_TYPE_STRING },
+        { 16677, 26, offsetof(bench, s76_____.s77_____.k935____), BENCH_S76______S77______K935____, BENCH_TYPE_STRING },
+        { 16704, 17, offsetof(bench, s78_____.k944____), BENCH_S78______K944____, BENCH_TYPE_STRING },
+        { 16722, 17, offsetof(bench, s78_____.k945____), BENCH_S78______K945____, BENCH_TYPE_STRING },
+        { 16740, 17, offsetof(bench, s78_____.k946____), BENCH_S78______K946____, BENCH_TYPE_STRING },
+        { 16758, 17, offsetof(bench, s78_____.k947____), BENCH_S78______K947____, BENCH_TYPE_STRING },
+        { 16776, 17, offsetof(bench, s78_____.k948____), BENCH_S78______K948____, BENCH_TYPE_STRING },
+        { 16794, 17, offsetof(bench, s78_____.k949____), BENCH_S78______K949____, BENCH_TYPE_STRING },
+        { 16812, 17, offsetof(bench, s78_____.k950____), BENCH_S78______K950____, BENCH_TYPE_STRING },
+        { 16830, 17, offsetof(bench, s78_____.k951____), BENCH_S78______K951____, BENCH_TYPE_STRING },
+        { 16848, 26, offsetof(bench, s78_____.s79_____.k952____), BENCH_S78______S79______K952____, BENCH_TYPE_STRING },
+        { 16875, 26, offsetof(bench, s78_____.s79_____.k953____), BENCH_S78______S79______K953____, BENCH_TYPE_STRING },
+        { 16902, 26, offsetof(bench, s78_____.s79_____.k954____), BENCH_S78______S79______K954____, BENCH_TYPE_STRING },
+        { 16929, 26, offsetof(bench, s78_____.s79_____.k955____), BENCH_S78______S79______K955____, BENCH_TYPE_STRING },
+        { 16956, 26, offsetof(bench, s78_____.s79_____.k956____), BENCH_S78______S79______K956____, BENCH_TYPE_STRING },
+        { 16983, 26, offsetof(bench, s78_____.s79_____.k957____), BENCH_S78______S79______K957____, BENCH_TYPE_STRING },
+        { 17010, 26, offsetof(bench, s78_____.s79_____.k958____), BENCH_S78______S79______K958____, BENCH_TYPE_STRING },
+        { 17037, 26, offsetof(bench, s78_____.s79_____.k959____), BENCH_S78______S79______K959____, BENCH_TYPE_STRING },
+        { 17064, 17, offsetof(bench, s80_____.k968____), BENCH_S80______K968____, BENCH_TYPE_STRING },
+        { 17082, 17, offsetof(bench, s80_____.k969____), BENCH_S80______K969____, BENCH_TYPE_STRING },
+        { 17100, 17, offsetof(bench, s80_____.k970____), BENCH_S80______K970____, BENCH_TYPE_STRING },
+        { 17118, 17, offsetof(bench, s80_____.k971____), BENCH_S80______K971____, BENCH_TYPE_STRING },
+        { 17136, 17, offsetof(bench, s80_____.k972____), BENCH_S80______K972____, BENCH_TYPE_STRING },
+        { 17154, 17, offsetof(bench, s80_____.k973____), BENCH_S80______K973____, BENCH_TYPE_STRING },
+        { 17172, 17, offsetof(bench, s80_____.k974____), BENCH_S80______K974____, BENCH_TYPE_STRING },
+        { 17190, 17, offsetof(bench, s80_____.k975____), BENCH_S80______K975____, BENCH_TYPE_STRING },
+        { 17208, 26, offsetof(bench, s80_____.s81_____.k976____), BENCH_S80______S81______K976____, BENCH_TYPE_STRING },
+        { 17235, 26, offsetof(bench, s80_____.s81_____.k977____), BENCH_S80______S81______K977____, BENCH_TYPE_STRING },
+        { 17262, 26, offsetof(bench, s80_____.s81_____.k978____), BENCH_S80______S81______K978____, BENCH_TYPE_STRING },
+        { 17289, 26, offsetof(bench, s80_____.s81_____.k979____), BENCH_S80______S81______K979____, BENCH_TYPE_STRING },
+        { 17316, 26, offsetof(bench, s80_____.s81_____.k980____), BENCH_S80______S81______K980____, BENCH_TYPE_STRING },
+        { 17343, 26, offsetof(bench, s80_____.s81_____.k981____), BENCH_S80______S81______K981____, BENCH_TYPE_STRING },
+        { 17370, 26, offsetof(bench, s80_____.s81_____.k982____), BENCH_S80______S81______K982____, BENCH_TYPE_STRING },
+        { 17397, 26, offsetof(bench, s80_____.s81_____.k983____), BENCH_S80______S81______K983____, BENCH_TYPE_STRING },
+        { 17424, 17, offsetof(bench, s82_____.k992____), BENCH_S82______K992____, BENCH_TYPE_STRING },
+        { 17442, 17, offsetof(bench, s82_____.k993____), BENCH_S82______K993____, BENCH_TYPE_STRING },
+        { 17460, 17, offsetof(bench, s82_____.k994____), BENCH_S82______K994____, BENCH_TYPE_STRING },
+        { 17478, 17, offsetof(bench, s82_____.k995____), BENCH_S82______K995____, BENCH_TYPE_STRING },
+        { 17496, 17, offsetof(bench, s82_____.k996____), BENCH_S82______K996____, BENCH_TYPE_STRING },
+        { 17514, 17, offsetof(bench, s82_____.k997____), BENCH_S82______K997____, BENCH_TYPE_STRING },
+        { 17532, 17, offsetof(bench, s82_____.k998____), BENCH_S82______K998____, BENCH_TYPE_STRING },
+        { 17550, 17, offsetof(bench, s82_____.k999____), BENCH_S82______K999____, BENCH_TYPE_STRING },
+        { 17568, 17, offsetof(bench, s8______.k104____), BENCH_S8_______K104____, BENCH_TYPE_STRING },
+        { 17586, 17, offsetof(bench, s8______.k105____), BENCH_S8_______K105____, BENCH_TYPE_STRING },
+        { 17604, 17, offsetof(bench, s8______.k106____), BENCH_S8_______K106____, BENCH_TYPE_STRING },
+        { 17622, 17, offsetof(bench, s8______.k107____), BENCH_S8_______K107____, BENCH_TYPE_STRING },
+        { 17640, 17, offsetof(bench, s8______.k108____), BENCH_S8_______K108____, BENCH_TYPE_STRING },
+        { 17658, 17, offsetof(bench, s8______.k109____), BENCH_S8_______K109____, BENCH_TYPE_STRING },
+        { 17676, 17, offsetof(bench, s8______.k110____), BENCH_S8_______K110____, BENCH_TYPE_STRING },
+        { 17694, 17, offsetof(bench, s8______.k111____), BENCH_S8_______K111____, BENCH_TYPE_STRING },
+        { 17712, 26, offsetof(bench, s8______.s9______.k112____), BENCH_S8_______S9_______K112____, BENCH_TYPE_STRING },
+        { 17739, 26, offsetof(bench, s8______.s9______.k113____), BENCH_S8_______S9_______K113____, BENCH_TYPE_STRING },
+        { 17766, 26, offsetof(bench, s8______.s9______.k114____), BENCH_S8_______S9_______K114____, BENCH_TYPE_STRING },
+        { 17793, 26, offsetof(bench, s8______.s9______.k115____), BENCH_S8_______S9_______K115____, BENCH_TYPE_STRING },
+        { 17820, 26, offsetof(bench, s8______.s9______.k116____), BENCH_S8_______S9_______K116____, BENCH_TYPE_STRING },
+        { 17847, 26, offsetof(bench, s8______.s9______.k117____), BENCH_S8_______S9_______K117____, BENCH_TYPE_STRING },
+        { 17874, 26, offsetof(bench, s8______.s9______.k118____), BENCH_S8_______S9_______K118____, BENCH_TYPE_STRING },
+        { 17901, 26, offsetof(bench, s8______.s9______.k119____), BENCH_S8_______S9_______K119____, BENCH_TYPE_STRING },
+};
+void
+benchinit(bench *self)
+{
+        self->k0______ = "jv3obbzxoiylvmlm";
+        self->k1______ = "qa76jroghzcox8cz";
+        self->k2______ = "y1zrgzpivlu43mbv";
+        self->k3______ = "p56143utsu0vdklw";
+        self->k4______ = "oger0vmklbmfkz44";
+        self->k5______ = "jrys8bjab4vaqtv9";
+        self->k6______ = "j6iqxzgt8d56k7u1";
+        self->k7______ = "exmftrdrt2vxf996";
+        self->s0______.k8______ = "t81h9faqfjtptjb7";
+        self->s0______.k9______ = "5z9y23ics8r979er";
+        self->s0______.k10_____ = "walc6brnhhhwyrpw";
+        self->s0______.k11_____ = "n1tdyno1j66s4lcg";
+        self->s0______.k12_____ = "34xvv7do4zcbabft";
+        self->s0______.k13_____ = "mz1xf0m3986zlh2h";
+        self->s0______.k14_____ = "py8mrge1ed4e7voe";
+        self->s0______.k15_____ = "pxg44cj4ki2ut5vn";
+        self->s0______.s1______.k16_____ = "owcxco4mdnf6wjaf";
+        self->s0______.s1______.k17_____ = "bvofkgdpewh1u15k";
+        self->s0______.s1______.k18_____ = "vyosxg63kiv94fsg";
+        self->s0______.s1______.k19_____ = "6qf2tsnmxnlcq9q5";
+        self->s0______.s1______.k20_____ = "ltnk14vhign8hc95";
+        self->s0______.s1______.k21_____ = "gszt18kb4l87jy4m";
+        self->s0______.s1______.k22_____ = "czzrqw9qlyqzlkn6";
+        self->s0______.s1______.k23_____ = "nqb4ywuwmr8ugear";
+        self->k24_____ = "yhae6k7rcouiic4k";
+        self->k25_____ = "qo2zfo7ph5gys67g";
+        self->k26_____ = "5ni9bskomuehrc6l";
+        self->k27_____ = "omau7chq4bb99q11";
+        self->k28_____ = "49qo80uhtwhwz0ke";
+        self->k29_____ = "r02ywpzoa9rwuaba";
+        self->k30_____ = "qr1vglf6rmlnw8ln";
+        self->k31_____ = "iethx5sdhnnn22gg";
+        self->s2______.k32_____ = "1p9e9dpvussr1c7k";
+        self->s2______.k33_____ = "48pwxh6u79imv66t";
+        self->s2______.k34_____ = "o391u5nw9rg29oh9";
+        self->s2______.k35_____ = "7nkfa90viculnq72";
+        self->s2______.k36_____ = "62g1upwajtwdq9mi";
+        self->s2______.k37_____ = "158i2hdcx61w83ln";
+        self->s2______.k38_____ = "9c0wn1ezi3f8qtwr";
+        self->s2______.k39_____ = "ofslj5zd7ktbhzns";
+        self->s2______.s3______.k40_____ = "76bnrlkkph3f3tl9";
+        self->s2______.s3______.k41_____ = "71r4w50qi6dz9781";
+        self->s2______.s3______.k42_____ = "qwnio9tdn7f28xjq";
+        self->s2______.s3______.k43_____ = "x7zrs5an1sg26fa2";
+        self->s2______.s3______.k44_____ = "xyz95pb6a5mdk1lj";
+        self->s2______.s3______.k45_____ = "8l7rdak17ecprn8r";
+        self->s2______.s3______.k46_____ = "rsy49i0nsbigh9ec";
+        self->s2______.s3______.k47_____ = "77uq6uxy2c04v7tx";
+        self->k48_____ = "meavmiecfhpcu58t";
+        self->k49_____ = "xpqdemjv863fkrvi";
+        self->k50_____ = "hsmyb6s5yg9rahiq";
+        self->k51_____ = "4094v6dk31n2c3gf";
+        self->k52_____ = "7j16raxr0y9if2b7";
+        self->k53_____ = "2idvv625ajy5dkyc";
+        self->k54_____ = "md9x8absr44xja9k";
+        self->k55_____ = "9w92cu86wla4u40p";
+        self->s4______.k56_____ = "k708suhdu28gcuea";
+        self->s4______.k57_____ = "cqsltatnnf64q8l2";
+        self->s4______.k58_____ = "7dobduqa4osfdm8b";
+        self->s4______.k59_____ = "6wcwhyj0mp9r7crz";
+        self->s4______.k60_____ = "ujku660r3mziliy0";
+        self->s4______.k61_____ = "t2s4evhek7l6ww9o";
+        self->s4______.k62_____ = "4dfdqvdwl4jli2jh";
+        self->s4______.k63_____ = "4ofvfbmbnxl1sgea";
+        self->s4______.s5______.k64_____ = "z3bsr7flomedb2tm";
+        self->s4______.s5______.k65_____ = "26n23bws1zwo9ww3";
+        self->s4______.s5______.k66_____ = "a5zbcvt2zxycjqvf";
+        self->s4______.s5______.k67_____ = "xd6dknep8egjx8do";
+        self->s4______.s5______.k68_____ = "gc2fkfmkhze7kvkg";
+        self->s4______.s5______.k69_____ = "v7uw0f36z0vei93x";
+        self->s4______.s5______.k70_____ = "7mm29zo5w5h2s3m1";
+        self->s4______.s5______.k71_____ = "y9ej5vhrxijpb5ta";
+        self->k72_____ = "5w15dz6ejzhttjzv";
+        self->k73_____ = "xb966j2oo8jtfdiz";
+        self->k74_____ = "ky94m7f39dl0q3pc";
+        self->k75_____ = "rt9pu3o1f6mkclwk";
+        self->k76_____ = "nwx7vj1o07gbubb1";
+        self->k77_____ = "aj1hjsqzxkqr15ap";
+        self->k78_____ = "lew278mhedkajr4a";
+        self->k79_____ = "1h04goj882amlxvb";
+        self->s6______.k80_____ = "gwsdwsw2dbzmkfm7";
+        self->s6______.k81_____ = "brw70w51esddqxpc";
+        self->s6______.k82_____ = "figkhwunc2790jos";
+        self->s6______.k83_____ = "yerep0rqhzxgep6l";
+        self->s6______.k84_____ = "9lfk10vpysropk99";
+        self->s6______.k85_____ = "8kj19kw7kp8nfq86";
+        self->s6______.k86_____ = "0rbjaspah2qvtc76";
+        self->s6______.k87_____ = "bu38akewe382g66z";
+        self->s6______.s7______.k88_____ = "y5umikjfkwqq2008";
+        self->s6______.s7______.k89_____ = "ig6bj8f9p942oqn0";
+        self->s6______.s7______.k90_____ = "5zuhrw4cy6ut34u1";
+        self->s6______.s7______.k91_____ = "oa6englyg3rx5ql1";
+        self->s6______.s7______.k92_____ = "w5qks4mpdgh8nskm";
+        self->s6______.s7______.k93_____ = "zwmuspfs2tv8iarm";
+        self->s6______.s7______.k94_____ = "qzhzopz2betrcg5r";
+        self->s6______.s7______.k95_____ = "a69pthcp53jbuywg";
+        self->k96_____ = "t5dex59z2oojt4bc";
+        self->k97_____ = "gsdshpqmnpeqjiep";
+        self->k98_____ = "oj9pi1bw5zgi18d1";
+        self->k99_____ = "7fozadcfmoilbejm";
+        self->k100____ = "e6cti54yzh8dmh22";
+        self->k101____ = "xho269dwlqh4on1r";
+        self->k102____ = "x40kvhi7a7rke54z";
+        self->k103____ = "4rs5j17130t7t33k";
+        self->s8______.k104____ = "javvrh04h5nzvldd";
+        self->s8______.k105____ = "npnsgpkyy2d39nwx";
+        self->s8______.k106____ = "ikbucthpfnnus5bm";
+        self->s8______.k107____ = "h7rrolqj9skmyn2m";
+        self->s8______.k108____ = "dmndxtna69q981x7";
+        self->s8______.k109____ = "wp7796s1j289bv4f";
+        self->s8______.k110____ = "3g6chycf43e8p9q4";
+        self->s8______.k111____ = "3f2muepey40w3nxh";
+        self->s8______.s9______.k112____ = "uiqb2my4j15469c9";
+        self->s8______.s9______.k113____ = "1da1iejj0mfrgff6";
+        self->s8______.s9______.k114____ = "tk2yjqw9m0dv6pmy";
+        self->s8______.s9______.k115____ = "sklkfud0zt3e0fcz";
+        self->s8______.s9______.k116____ = "nnxez61jwm1afq7n";
+        self->s8______.s9______.k117____ = "22d7b26tu7q1tce8";
+        self->s8______.s9______.k118____ = "ellxsir4vo853ulw";
+        self->s8______.s9______.k119____ = "xw5ige06klqky0o9";
+        self->k120____ = "8f8wo291uuo8s6ia";
+        self->k121____ = "wqw9hux7jrywi0py";
+        self->k122____ = "nlc7xaey0goblyk3";
+        self->k123____ = "iwo016r86lpvjgfj";
+        self->k124____ = "e7ceeykfrqveh6as";
+        self->k125____ = "5mgsy3xq47peskhs";
+        self->k126____ = "op3l6r5stkjhyabd";
+        self->k127____ = "csn3jruvnhdl4w2u";
+        self->s10_____.k128____ = "vjjwn3vx4ai5nyle";
+        self->s10_____.k129____ = "eeryfrs0l3cw140z";
+        self->s10_____.k130____ = "exj3sj9iv9u0fa3z";
+        self->s10_____.k131____ = "px654jqxsa4vho9g";
+        self->s10_____.k132____ = "4websz2whn2fcfs0";
+        self->s10_____.k133____ = "vnuog3jev876exj1";
+        self->s10_____.k134____ = "bqi2dfo1sltuo3ap";
+        self->s10_____.k135____ = "ilujtj1bly35nh5a";
+        self->s10_____.s11_____.k136____ = "1o5xtfym73h1lvvf";
+        self->s10_____.s11_____.k137____ = "13ta6ze0g0jh75ib";
+        self->s10_____.s11_____.k138____ = "w65si73bh55gu79w";
+        self->s10_____.s11_____.k139____ = "j9ldqjk1r6ewohwk";
+        self->s10_____.s11_____.k140____ = "z89vff9wozkvmb3d";
+        self->s10_____.s11_____.k141____ = "qz1l7s235ky3pp29";
+        self->s10_____.s11_____.k142____ = "luoarsadixwynnkq";
+        self->s10_____.s11_____.k143____ = "95w4govsk22eh1br";
+        self->k144____ = "wc8lgwoetrrakjij";
+        self->k145____ = "j70r08d96sdx2594";
+        self->k146____ = "racslku3om3p438c";
+        self->k147____ = "am3ypcvq5f902xi9";
+        self->k148____ = "11n0pwb1aczsho9t";
+        self->k149____ = "o4zpx0kngxkrfik6";
+        self->k150____ = "of77mcxeluynpg3m";
+        self->k151____ = "zyb0606oqz4yo6mv";
+        self->s12_____.k152____ = "i5aqy8rvc0yum0cs";
+        self->s12_____.k153____ = "mo2jjsfl9dsa4q78";
+        self->s12_____.k154____ = "1vmtfwo06my9r82l";
+        self->s12_____.k155____ = "cmy2bsd68vrxpe55";
+        self->s12_____.k156____ = "ota04cydx49wzc86";
+        self->s12_____.k157____ = "7we2s5vce17cmej2";
+        self->s12_____.k158____ = "u7lvk57ezidnsoxf";
+        self->s12_____.k159____ = "6u9x598p9zzry6ss";
+        self->s12_____.s13_____.k160____ = "9lpe1xlrqcsbpwjw";
+        self->s12_____.s13_____.k161____ = "0wpotlyab1euvemt";
+        self->s12_____.s13_____.k162____ = "ofdlipbstf86t0xl";
+        self->s12_____.s13_____.k163____ = "jrkz6tg3u4e1jmzm";
+        self->s12_____.s13_____.k164____ = "q6w12tsq3l8tul2u";
+        self->s12_____.s13_____.k165____ = "9tg2ilhsxmp80zp3";
+        self->s12_____.s13_____.k166____ = "9ssw35ez2zbsqtgv";
+        self->s12_____.s13_____.k167____ = "k3gl3pvhr8h7dfbs";
+        self->k168____ = "7qjzn948tpbnnpdd";
+        self->k169____ = "7l3ko1oyay5btjgp";
+        self->k170____ = "ecfaghd13zryg5nm";
+        self->k171____ = "9vf3k12np00qmr2a";
+        self->k172____ = "tuvt99jmuhuhctxf";
+        self->k173____ = "4hf7ha09fykd3rkn";
+        self->k174____ = "zwakd6cnsfekp9a8";
+        self->k175____ = "nrmi6ulaqkkgv7xt";
+        self->s14_____.k176____ = "i2ejyiqs3d9omdsp";
+        self->s14_____.k177____ = "ddqpmazbs63b87r2";
+        self->s14_____.k178____ = "5smybac1mk9filee";
+        self->s14_____.k179____ = "soxgvmdsfpr6obcj";
+        self->s14_____.k180____ = "rf92valngapiza33";
+        self->s14_____.k181____ = "ymh7zi6t27uddwuc";
+        self->s14_____.k182____ = "exht46r0zwk9jatg";
+        self->s14_____.k183____ = "l4hu4i0q0d24i4wh";
+        self->s14_____.s15_____.k184____ = "ozcgo6x96agoguu6";
+        self->s14_____.s15_____.k185____ = "kys1tetjjnisu8pq";
+        self->s14_____.s15_____.k186____ = "z587xu2mkc0jpug7";
+        self->s14_____.s15_____.k187____ = "2kwgte3oqh1jro37";
+        self->s14_____.s15_____.k188____ = "6noimuo37yru1maw";
+        self->s14_____.s15_____.k189____ = "1ucsmrdi0fh6w410";
+        self->s14_____.s15_____.k190____ = "ktn5qztcxkn56i3l";
+        self->s14_____.s15_____.k191____ = "o0f3b3mb3xpx0oe6";
+        self->k192____ = "nfr0rjb50yu532hy";
+        self->k193____ = "6yjur3c45vo4pocv";
+        self->k194____ = "axf3sft23lawjirr";
+        self->k195____ = "t96dkbu1oa0ftw9g";
+        self->k196____ = "446voz6k5rm3g3s0";
+        self->k197____ = "jv64wv3yf03emdnl";
+        self->k198____ = "ny6ypj8hohdag72t";
+        self->k199____ = "u5i71z1f1ybhft9y";
+        self->s16_____.k200____ = "hs5dlbmm7v15drzn";
+        self->s16_____.k201____ = "93dq27awcsjhr5mj";
+        self->s16_____.k202____ = "4yh0ub7rd1d8avdc";
+        self->s16_____.k203____ = "jdtdu749jeiswtww";
+        self->s16_____.k204____ = "jcd3rftkcvgz2vj9";
+        self->s16_____.k205____ = "q39h786npkezd565";
+        self->s16_____.k206____ = "5a427ouxq1kejr0q";
+        self->s16_____.k207____ = "d5co4crskqmyx9nr";
+        self->s16_____.s17_____.k208____ = "ssw18k8ehzzyg3in";
+        self->s16_____.s17_____.k209____ = "zzkj0o9dyo9h2xto";
+        self->s16_____.s17_____.k210____ = "vys010yfs6rdg38o";
+        self->s16_____.s17_____.k211____ = "ym7ytsr2xz10qp6x";
+        self->s16_____.s17_____.k212____ = "x5bw10zhic3ctotl";
+        self->s16_____.s17_____.k213____ = "soz1t047sxojj2cm";
+        self->s16_____.s17_____.k214____ = "073b64xupa63hgvi";
+        self->s16_____.s17_____.k215____ = "nazwm0e02noqcemf";
+        self->k216____ = "m92yqsv3gsi26co0";
+        self->k217____ = "u4qv7czphhgucevc";
+        self->k218____ = "lbuhr0go2yi1rwu1";
+        self->k219____ = "8mm2741m0vv1dy5l";
+        self->k220____ = "g1es0wm99414rwk2";
+        self->k221____ = "zke2ctj42p7sqena";
+        self->k222____ = "afdjk536r613swpf";
+        self->k223____ = "qmtp5xod9r7zeik4";
+        self->s18_____.k224____ = "5h1e59x7u0cbhc38";
+        self->s18_____.k225____ = "s4xs5duurhaenuup";
+        self->s18_____.k226____ = "orlp2dfs1nc21opd";
+        self->s18_____.k227____ = "7vo7e5kv6oixzmrm";
+        self->s18_____.k228____ = "6u4xix4ubpcxuluu";
+        self->s18_____.k229____ = "9xcqa9p0p29soj1n";
+        self->s18_____.k230____ = "tkc43h2327voydo7";
+        self->s18_____.k231____ = "0ncp7pzhz013dz3w";
+        self->s18_____.s19_____.k232____ = "fi3z3pc4hxjff5l1";
+        self->s18_____.s19_____.k233____ = "vpjg05cyqu5v5vwd";
+        self->s18_____.s19_____.k234____ = "ywzu01hd7fb6ghjq";
+        self->s18_____.s19_____.k235____ = "h77jop2zd8sy6jaa";
+        self->s18_____.s19_____.k236____ = "9unlltzea1q9wdtr";
+        self->s18_____.s19_____.k237____ = "w5nj12g5vik1vrcf";
+        self->s18_____.s19_____.k238____ = "zcacdy8bsbiwh9u4";
+        self->s18_____.s19_____.k239____ = "b7qy6q1myo40z3lh";
+        self->k240____ = "umuru6acvpl8y5cp";
+        self->k241____ = "ppudi2brkefvgr3i";
+        self->k242____ = "1gqenu45mcp72xuu";
+        self->k243____ = "4c1knq5gzxne4zoj";
+        self->k244____ = "73h6nmlv4e1e3qjz";
+        self->k245____ = "ayxv32a5irqd1oyw";
+        self->k246____ = "m5ddgaj83cw1nu5o";
+        self->k247____ = "9kh2cegu0x2cagwd";
+        self->s20_____.k248____ = "gnk406phuesgwuey";
+        self->s20_____.k249____ = "cm8xty1nfrakqwle";
+        self->s20_____.k250____ = "z9cjdiyakc0vdiw7";
+        self->s20_____.k251____ = "ao80lu34qlxjvcz7";
+        self->s20_____.k252____ = "yvsye24zfq7u126c";
+        self->s20_____.k253____ = "pygkun1igbpi0kxs";
+        self->s20_____.k254____ = "kxvp6r5c5wvl6qvl";
+        self->s20_____.k255____ = "okrvjvizftt18kea";
+        self->s20_____.s21_____.k256____ = "nb7w3zrt4eexfmpa";
+        self->s20_____.s21_____.k257____ = "y2zyvbc4prck1sgr";
+        self->s20_____.s21_____.k258____ = "ylfb43ha3xi0ne3j";
+        self->s20_____.s21_____.k259____ = "95ytcfy9oecf5wlg";
+        self->s20_____.s21_____.k260____ = "00uv87icpb274fk8";
+        self->s20_____.s21_____.k261____ = "vvm0s7zuf4jaqtzl";
+        self->s20_____.s21_____.k262____ = "famat3shk1xmw7yd";
+        self->s20_____.s21_____.k263____ = "6pur1z9bhi7pnlxa";
+        self->k264____ = "h0hx9beejjpd5rjr";
+        self->k265____ = "ljh2m7qs4kbdvlen";
+        self->k266____ = "0a14mjj7p194231w";
+        self->k267____ = "7xxpyvshbuqss14c";
+        self->k268____ = "381nnrx8s3cnyfv9";
+        self->k269____ = "ibppbwqft8qfhpmd";
+        self->k270____ = "tqgur42p2pce7nga";
+        self->k271____ = "l1488oro8ayaptnb";
+        self->s22_____.k272____ = "cok1g0sad7fegvur";
+        self->s22_____.k273____ = "nv0bsstdqg91q158";
+        self->s22_____.k274____ = "rukg1g6v8q790zw8";
+        self->s22_____.k275____ = "66b61cfa9n9869y1";
+        self->s22_____.k276____ = "p5n81kb9mkvkpkdl";
+        self->s22_____.k277____ = "ksvt5k0bk14rrusi";
+        self->s22_____.k278____ = "cvz3ikhu16m7xkr2";
+        self->s22_____.k279____ = "bm3gmsuwy34m8umn";
+        self->s22_____.s23_____.k280____ = "ahqum833wge6q0gw";
+        self->s22_____.s23_____.k281____ = "6sy3ro3ttl4a4a7k";
+        self->s22_____.s23_____.k282____ = "1329b8gceeyxvcyl";
+        self->s22_____.s23_____.k283____ = "k2ee3ol283bxxy55";
+        self->s22_____.s23_____.k284____ = "89awwsu5dglw70s2";
+        self->s22_____.s23_____.k285____ = "b4me8x7calv8uabm";
+        self->s22_____.s23_____.k286____ = "an9rgpnenmtjs4hz";
+        self->s22_____.s23_____.k287____ = "eqphl18hx7f7eys0";
+        self->k288____ = "hldehlhb6843l0zk";
+        self->k289____ = "kolw116aftaqbmud";
+        self->k290____ = "8jd169vot3g6hsd5";
+        self->k291____ = "njcvitojuku17enu";
+        self->k292____ = "i601e9oa7949ehm2";
+        self->k293____ = "xtc2i91kxud0ovlv";
+        self->k294____ = "l8osb9aja3n8u107";
+        self->k295____ = "8fwpvpb17khntjng";
+        self->s24_____.k296____ = "7ez3f1gkh1vvfp9d";
+        self->s24_____.k297____ = "vhbg09kq2i5b1n8x";
+        self->s24_____.k298____ = "esjq0ptpzrjqslrq";
+        self->s24_____.k299____ = "d7vjsl639woqu7ie";
+        self->s24_____.k300____ = "xm7x9pr6qxml4xlf";
+        self->s24_____.k301____ = "opbn52w1nashvnob";
+        self->s24_____.k302____ = "jkyo92s7ojy019ec";
+        self->s24_____.k303____ = "vjeematuaggcf3p5";
+        self->s24_____.s25_____.k304____ = "mmizyeuc3ldse5gp";
+        self->s24_____.s25_____.k305____ = "hlm96q33cq3nknfy";
+        self->s24_____.s25_____.k306____ = "xsy2be8xywx7uxqi";
+        self->s24_____.s25_____.k307____ = "0s5wbyxgn9rukfwj";
+        self->s24_____.s25_____.k308____ = "jf5q3697oqhqr2z3";
+        self->s24_____.s25_____.k309____ = "iapzn6qtuvy1t8i4";
+        self->s24_____.s25_____.k310____ = "ahtls2vsnogpfilk";
+        self->s24_____.s25_____.k311____ = "p0pycu4is1ygi0gx";
+        self->k312____ = "0noggud12m84k6e6";
+        self->k313____ = "gi8pxa1j7nuoe0dy";
+        self->k314____ = "vpwrh22q88gjdiwb";
+        self->k315____ = "yg84li7s6xxvvo3b";
+        self->k316____ = "yv8qym43fmv6p2q4";
+        self->k317____ = "xysoezpygflmcw5w";
+        self->k318____ = "417ti35sp07ty6nx";
+        self->k319____ = "s0fffjyjnlp5sk2y";
+        self->s26_____.k320____ = "bfnsnz7dwmmpve96";
+        self->s26_____.k321____ = "qa32rf809jo0t8cf";
+        self->s26_____.k322____ = "ehrjszhun9acfqvb";
+        self->s26_____.k323____ = "9lyh0nut0uwv9gtw";
+        self->s26_____.k324____ = "ssqboni85vezcn4o";
+        self->s26_____.k325____ = "3vek4vr2vkbu61zt";
+        self->s26_____.k326____ = "7iuix3wto1pm8jyl";
+        self->s26_____.k327____ = "ahe7lrpjhuz1bd5a";
+        self->s26_____.s27_____.k328____ = "1kpdhz2q73xh53br";
+        self->s26_____.s27_____.k329____ = "1fdi2fyo0cblrpan";
+        self->s26_____.s27_____.k330____ = "sytk2nvfxxtcyv1c";
+        self->s26_____.s27_____.k331____ = "355d2r4xbaacsxk4";
+        self->s26_____.s27_____.k332____ = "nw9rj7d48n8nir3l";
+        self->s26_____.s27_____.k333____ = "27dpz0anhcanl5m5";
+        self->s26_____.s27_____.k334____ = "t6gyzwyxix8evz46";
+        self->s26_____.s27_____.k335____ = "p1gk0o30sa2m1h3n";
+        self->k336____ = "kk89o8kmx7b2cvaf";
+        self->k337____ = "bb4bk011i4dt2p9s";
+        self->k338____ = "f6g4d4q7gizd030s";
+        self->k339____ = "qafud83uhnhwmlux";
+        self->k340____ = "ttn0pcbde0r8x4ht";
+        self->k341____ = "0439p8sj0p4v3egm";
+        self->k342____ = "4nfrugt6lqa71sj2";
+        self->k343____ = "r6no64ycm386siyb";
+        self->s28_____.k344____ = "i9iuu47nosm6i0ow";
+        self->s28_____.k345____ = "uwyn70rp9hsuomfg";
+        self->s28_____.k346____ = "dfy5jcwseyu5jcu9";
+        self->s28_____.k347____ = "c622zg1qgjvxdu5t";
+        self->s28_____.k348____ = "01ik40mhh450v4wm";
+        self->s28_____.k349____ = "fk2ighv02xr06aji";
+        self->s28_____.k350____ = "entrgt32nepjck9b";
+        self->s28_____.k351____ = "yq51x1c9h377qqwg";
+        self->s28_____.s29_____.k352____ = "hxxe1htbygkvlw7g";
+        self->s28_____.s29_____.k353____ = "ks50xl6ev1eanqu1";
+        self->s28_____.s29_____.k354____ = "krhdu5fg5jwq5c9x";
+        self->s28_____.s29_____.k355____ = "7r8rqlcjukel7yna";
+        self->s28_____.s29_____.k356____ = "y6ct6twu7909a1yq";
+        self->s28_____.s29_____.k357____ = "9pouql9gl61wk7tj";
+        self->s28_____.s29_____.k358____ = "l00cbharaffgmtgf";
+        self->s28_____.s29_____.k359____ = "g7ol3135zolbhjro";
+        self->k360____ = "jmr331o0ttrn7t5l";
+        self->k361____ = "zh3cwdkaa6x3pvgd";
+        self->k362____ = "i8rqo9d1ff7mg1ru";
+        self->k363____ = "hvfvwhyndkw26bym";
+        self->k364____ = "l63txx3665ahs91f";
+        self->k365____ = "s5zjdaklziwh3ncr";
+        self->k366____ = "70is9q8rojaodhy4";
+        self->k367____ = "j7emiixi2wcoffp5";
+        self->s30_____.k368____ = "2mezimm8rhlcydo9";
+        self->s30_____.k369____ = "9l25majb4yfn43je";
+        self->s30_____.k370____ = "lcqqjy8t2ohful2y";
+        self->s30_____.k371____ = "8k1o3a9cnpbq0ngj";
+        self->s30_____.k372____ = "7f9q76dvwitir27f";
+        self->s30_____.k373____ = "eedj7u2te3qdxsic";
+        self->s30_____.k374____ = "6p9h4a74zg8t3axw";
+        self->s30_____.k375____ = "5glqo28qcxag6ss5";
+        self->s30_____.s31_____.k376____ = "wz4w86xlea8o8umi";
+        self->s30_____.s31_____.k377____ = "gu8tpelf3jmwmk9e";
+        self->s30_____.s31_____.k378____ = "fpwbtqmekgsbhagb";
+        self->s30_____.s31_____.k379____ = "uwcklezgm99rrwfj";
+        self->s30_____.s31_____.k380____ = "qn8aaagff2bat268";
+        self->s30_____.s31_____.k381____ = "xuckarlm07paocxc";
+        self->s30_____.s31_____.k382____ = "0d7hyzto5ontimft";
+        self->s30_____.s31_____.k383____ = "skfzznijjtd1wwee";
+        self->k384____ = "nzbo7zflom2hfe52";
+        self->k385____ = "y236ffckl7coh883";
+        self->k386____ = "u1n70nt2ztmw7q33";
+        self->k387____ = "llqlszi9oeojdslc";
+        self->k388____ = "w8a7sbygh3m74jgc";
+        self->k389____ = "rnako3nmzkn2qh7p";
+        self->k390____ = "nm2etrsh0ppagru9";
+        self->k391____ = "m9mjp3lj1yf1fd5q";
+        self->s32_____.k392____ = "dg1ptbmu7bhhxzbf";
+        self->s32_____.k393____ = "tjt2efi4swbp712r";
+        self->s32_____.k394____ = "gy1cqnnnlx1o67t4";
+        self->s32_____.k395____ = "f195evkdj660oh0s";
+        self->s32_____.k396____ = "fct7zzl8gjo7i3z1";
+        self->s32_____.k397____ = "6711zsubhwinphy9";
+        self->s32_____.k398____ = "5mk2jgit2p8y33su";
+        self->s32_____.k399____ = "p54og4z006yyp9fr";
+        self->s32_____.s33_____.k400____ = "0w494g4uprnicba3";
+        self->s32_____.s33_____.k401____ = "73wbwwplawdt2pd4";
+        self->s32_____.s33_____.k402____ = "v6os9smngajp83sc";
+        self->s32_____.s33_____.k403____ = "uybql0ja9r50uh29";
+        self->s32_____.s33_____.k404____ = "t5389cjlawb4xsl9";
+        self->s32_____.s33_____.k405____ = "c0f5hgobwxofryke";
+        self->s32_____.s33_____.k406____ = "cbvv60xa5qyv94nq";
+        self->s32_____.s33_____.k407____ = "7qf0i02k2n8mk62v";
+        self->k408____ = "axeq64fzs0ea2cwc";
+        self->k409____ = "mgq3jc7ll5gqserg";
+        self->k410____ = "d3ud7cc82mepbo2t";
+        self->k411____ = "kym2385e4zr9p6ll";
+        self->k412____ = "0likccq1d4hof0o2";
+        self->k413____ = "bwq60hrwexbkq6vq";
+        self->k414____ = "uv9bch76rqxjw09z";
+        self->k415____ = "euxdphsppvrzemgo";
+        self->s34_____.k416____ = "xhh6155r688nh8rc";
+        self->s34_____.k417____ = "s8d4l1uej5e2fmup";
+        self->s34_____.k418____ = "wnxxutbc1z4i9s1p";
+        self->s34_____.k419____ = "brwv2h0n6oel72rq";
+        self->s34_____.k420____ = "i24tetkqv9kpqham";
+        self->s34_____.k421____ = "hl42m9toxu9gkj9f";
+        self->s34_____.k422____ = "1o4kbd2bq7fs2hsj";
+        self->s34_____.k423____ = "oz4535btrkdvtrfk";
+        self->s34_____.s35_____.k424____ = "fynr3ps0hh7b79hp";
+        self->s34_____.s35_____.k425____ = "fpfco94ummxrxjsp";
+        self->s34_____.s35_____.k426____ = "i8z2kxddjzrm89b2";
+        self->s34_____.s35_____.k427____ = "1z3b8lmzx8giebmy";
+        self->s34_____.s35_____.k428____ = "9ajtdhre6pqx4ddj";
+        self->s34_____.s35_____.k429____ = "whvrx685v681jjcj";
+        self->s34_____.s35_____.k430____ = "7gqoxy4zs3ychpig";
+        self->s34_____.s35_____.k431____ = "vzquaedmq08srv55";
+        self->k432____ = "y2a72m6sn51we18t";
+        self->k433____ = "95692qf7w23ncvvu";
+        self->k434____ = "tkmm3islqg132p2m";
+        self->k435____ = "045ozqtczhv28fcz";
+        self->k436____ = "j316zexn8itybyz7";
+        self->k437____ = "qadrfmi5ev25xcq8";
+        self->k438____ = "itp1gy3sjo01f6do";
+        self->k439____ = "l4pesukqodqkasw1";
+        self->s36_____.k440____ = "kfg8celxa2scwu2i";
+        self->s36_____.k441____ = "0mktdip3vfe8mstq";
+        self->s36_____.k442____ = "v947la6ukckfxmkn";
+        self->s36_____.k443____ = "e0c4lan4atprjsrv";
+        self->s36_____.k444____ = "qz0yeaczfmjqluig";
+        self->s36_____.k445____ = "hm40irpq47higo9c";
+        self->s36_____.k446____ = "0hvxa7d8xw7lu2f9";
+        self->s36_____.k447____ = "ogz3zfm73xtxckee";
+        self->s36_____.s37_____.k448____ = "fjrk7jvp4ey9vu5q";
+        self->s36_____.s37_____.k449____ = "e6ji3bc05rwklk4r";
+        self->s36_____.s37_____.k450____ = "u1nvsj9endiof6zv";
+        self->s36_____.s37_____.k451____ = "hdaxof6tg2on9o9s";
+        self->s36_____.s37_____.k452____ = "wkijk7uspbqvgjkg";
+        self->s36_____.s37_____.k453____ = "3fa8ofnib4jyepvt";
+        self->s36_____.s37_____.k454____ = "3u2qxvgpctxuc3ud";
+        self->s36_____.s37_____.k455____ = "q92jdzx3lmjxrlp2";
+        self->k456____ = "1gh59baqrfltxzjr";
+        self->k457____ = "p31im7ukogb571qj";
+        self->k458____ = "0qp02znvx1pcq3xs";
+        self->k459____ = "7l9hqzot72e8gpos";
+        self->k460____ = "7c5zz3xkgrcbyzj1";
+        self->k461____ = "2v55bsm79o6z9pux";
+        self->k462____ = "tucqrcy5q1ci3fgu";
+        self->k463____ = "ldcscg7g4im2pd7f";
+        self->s38_____.k464____ = "c80h08oqxbf687eb";
+        self->s38_____.k465____ = "bfcb8w112chti9hg";
+        self->s38_____.k466____ = "bmgwp8mzs2nhoj0w";
+        self->s38_____.k467____ = "2efux4ru5ztk256l";
+        self->s38_____.k468____ = "pd7whs75u0zw94h5";
+        self->s38_____.k469____ = "4w3px8w78hsnji4e";
+        self->s38_____.k470____ = "k3vva0tip6u7xkfu";
+        self->s38_____.k471____ = "fiv0eou4a7wy0ay3";
+        self->s38_____.s39_____.k472____ = "m5eimkj384aiu0ko";
+        self->s38_____.s39_____.k473____ = "ig2nj879t14igmrc";
+        self->s38_____.s39_____.k474____ = "9bepbo0w66md7s2h";
+        self->s38_____.s39_____.k475____ = "8e2e78da0vz5xe1h";
+        self->s38_____.s39_____.k476____ = "0xu440el98lw7wc2";
+        self->s38_____.s39_____.k477____ = "r4m6wpv025bgiyra";
+        self->s38_____.s39_____.k478____ = "m3dn4hzqzm130o17";
+        self->s38_____.s39_____.k479____ = "qa9hxlcll33remwg";
+        self->k480____ = "191y1th3m04fhsfs";
+        self->k481____ = "8s9g1dyiz5iuvmm5";
+        self->k482____ = "srpx6pj4pnwilg1h";
+        self->k483____ = "zbsfiponmwet7yze";
+        self->k484____ = "ymk9qtoqfp8tqteq";
+        self->k485____ = "51o6qhh8h2tgwv5r";
+        self->k486____ = "pg08jpm76nnk6hgv";
+        self->k487____ = "ozslf1r93013dz34";
+        self->s40_____.k488____ = "vmnr790kp1rv71th";
+        self->s40_____.k489____ = "zljg458622xrxns5";
+        self->s40_____.k490____ = "ekvi4hdh3nryc176";
+        self->s40_____.k491____ = "1rnbkx6rhc4iqzae";
+        self->s40_____.k492____ = "5erld5zu6l6pw9d7";
+        self->s40_____.k493____ = "khzjta4dba0dzbwv";
+        self->s40_____.k494____ = "jw24pqwf07qkd5ac";
+        self->s40_____.k495____ = "bnmmiy5m2soofnhh";
+        self->s40_____.s41_____.k496____ = "aq67u6q0zlxgyxwx";
+        self->s40_____.s41_____.k497____ = "hty5a277o2fngzr2";
+        self->s40_____.s41_____.k498____ = "182q72ghy8xrqhi2";
+        self->s40_____.s41_____.k499____ = "4814zaxof5vm8z4f";
+        self->s40_____.s41_____.k500____ = "7nh2nuxr8qxunqr7";
+        self->s40_____.s41_____.k501____ = "yypnvyat27qt9wek";
+        self->s40_____.s41_____.k502____ = "21p9sarsbcspn6x4";
+        self->s40_____.s41_____.k503____ = "t09qg6c2slmcm0kd";
+        self->k504____ = "kzwoci5tiigwsyq6";
+        self->k505____ = "gmwxxmlrr36o68hy";
+        self->k506____ = "7dk71yya0k8vhi8n";
+        self->k507____ = "6sg0t670ethb7cbj";
+        self->k508____ = "q3c62msr7irqlmi0";
+        self->k509____ = "ta402fl2knxi8wpo";
+        self->k510____ = "cln5i7d0tg3xyqf9";
+        self->k511____ = "o837nv2jbp1l4c2y";
+        self->s42_____.k512____ = "vjf87v39sy29fqh6";
+        self->s42_____.k513____ = "umvuj3scp7cgdg07";
+        self->s42_____.k514____ = "upzrwf1m3x6ovibn";
+        self->s42_____.k515____ = "pp2pozmhk2w75c1o";
+        self->s42_____.k516____ = "0keb0j6glzq747gk";
+        self->s42_____.k517____ = "brekwbzqb0za6xzd";
+        self->s42_____.k518____ = "z6uytfohwl52wjq5";
+        self->s42_____.k519____ = "m96flfh7x2jpj112";
+        self->s42_____.s43_____.k520____ = "9k1h1fueffttxb7z";
+        self->s42_____.s43_____.k521____ = "x3taizqsos3pzha7";
+        self->s42_____.s43_____.k522____ = "8ul0mzn3x91certc";
+        self->s42_____.s43_____.k523____ = "fl5x2bohv6qs4tkw";
+        self->s42_____.s43_____.k524____ = "zc1bzj1cg3sz2vz5";
+        self->s42_____.s43_____.k525____ = "ifhtr0ejd4a3t12p";
+        self->s42_____.s43_____.k526____ = "tasy302xipsmvr4m";
+        self->s42_____.s43_____.k527____ = "dxwgw8jswq2y1lvn";
+        self->k528____ = "40w9ws8idnfugbuj";
+        self->k529____ = "nvobck1duwh1u5lk";
+        self->k530____ = "jic8hwy7wuj9cnwg";
+        self->k531____ = "26bel4zi5bxc2lm5";
+        self->k532____ = "x9z0d8jtakjw5459";
+        self->k533____ = "kkvpd40n0d8jfuwu";
+        self->k534____ = "grvjmg9ihayfhwje";
+        self->k535____ = "varouwmg2386gmez";
+        self->s44_____.k536____ = "ihaeewjr8wymm0ow";
+        self->s44_____.k537____ = "qo6bncrp5p0mwavw";
+        self->s44_____.k538____ = "t3ydvo4c6uidnge9";
+        self->s44_____.k539____ = "cam2bg964rbd1app";
+        self->s44_____.k540____ = "0ty8o0elxwponcoe";
+        self->s44_____.k541____ = "z8iy4lzsatzcam7e";
+        self->s44_____.k542____ = "i3djs1nyba9f4c1z";
+        self->s44_____.k543____ = "6m5dtdg5d77jy6ss";
+        self->s44_____.s45_____.k544____ = "l9ti91tbikoflsf0";
+        self->s44_____.s45_____.k545____ = "ww1shlyaf1iu766l";
+        self->s44_____.s45_____.k546____ = "ojtx2lv0x3gq50ph";
+        self->s44_____.s45_____.k547____ = "rfgf2twz6guhzeja";
+        self->s44_____.s45_____.k548____ = "q2odi9g23lk5at2a";
+        self->s44_____.s45_____.k549____ = "hhki2114pm5ccz9j";
+        self->s44_____.s45_____.k550____ = "t4osbpqnmrv86ds3";
+        self->s44_____.s45_____.k551____ = "o74xjhf178dfdn3c";
+        self->k552____ = "vejffh4499vj7xl5";
+        self->k553____ = "np7ootwaeixvh7w9";
+        self->k554____ = "ygr2wdltb7nes5ve";
+        self->k555____ = "hz3f49mbhg4mqbe6";
+        self->k556____ = "t2bpx5rq6lm1cx9z";
+        self->k557____ = "slbv9u0t3ug9nzsj";
+        self->k558____ = "742cl2kbcvmk9l2k";
+        self->k559____ = "nn26e692a8wkfjhl";
+        self->s46_____.k560____ = "ae2zuqawrl90e941";
+        self->s46_____.k561____ = "x1e9iafvgy3v0vn2";
+        self->s46_____.k562____ = "9cm2nm89y0lvmpmq";
+        self->s46_____.k563____ = "s4xsvy1w753mg383";
+        self->s46_____.k564____ = "zvderid74ep6bebf";
+        self->s46_____.k565____ = "um5zjmyt6v6xpgi4";
+        self->s46_____.k566____ = "u5pdwu7c3w09r2d0";
+        self->s46_____.k567____ = "1whygak6glm0m8sl";
+        self->s46_____.s47_____.k568____ = "c3gswath2mokgmuq";
+        self->s46_____.s47_____.k569____ = "82s5dit7jrq8i41a";
+        self->s46_____.s47_____.k570____ = "7tgbpq6qcocflygz";
+        self->s46_____.s47_____.k571____ = "m0g81ifwitl7rk33";
+        self->s46_____.s47_____.k572____ = "yz0yi2krrir2966w";
+        self->s46_____.s47_____.k573____ = "xm4cybxukjl208pc";
+        self->s46_____.s47_____.k574____ = "0p3xujhglsv9ueft";
+        self->s46_____.s47_____.k575____ = "c4j3rzubfx1988ea";
+        self->k576____ = "rrbwnzbpwau1vu5e";
+        self->k577____ = "iev6rz4k9rwc1wof";
+        self->k578____ = "mlnvkbxybhm4j2bn";
+        self->k579____ = "9lmpsvu9s6czts5k";
+        self->k580____ = "88qj4368lvmzkrcc";
+        self->k581____ = "zb2ckr7ir8zaa5bd";
+        self->k582____ = "36euxfwtgtdyc3qd";
+        self->k583____ = "qhizdnhvt2fdrp5i";
+        self->s48_____.k584____ = "18hpxziun3lxxz3v";
+        self->s48_____.k585____ = "1blyije0cc35b5qz";
+        self->s48_____.k586____ = "4ipcub3bdd9ger10";
+        self->s48_____.k587____ = "395pmvc5ziewodo4";
+        self->s48_____.k588____ = "rwp7j3h48z0zmjbl";
+        self->s48_____.k589____ = "qvttrwe3tsurd9m9";
+        self->s48_____.k590____ = "5qcyb02xm54ifbsq";
+        self->s48_____.k591____ = "9d04wofccmaux57n";
+        self->s48_____.s49_____.k592____ = "c0s904sq9r3acnmj";
+        self->s48_____.s49_____.k593____ = "7ngjgchlmcdhulho";
+        self->s48_____.s49_____.k594____ = "busktkejsmzhg788";
+        self->s48_____.s49_____.k595____ = "ey765gzapz9k2lex";
+        self->s48_____.s49_____.k596____ = "1t7kx4btu4rkl8ll";
+        self->s48_____.s49_____.k597____ = "w8zd9k8fgt8vfecq";
+        self->s48_____.s49_____.k598____ = "cbvvqkhuh22bxkjm";
+        self->s48_____.s49_____.k599____ = "3a38uo2curgakymj";
+        self->k600____ = "yxiyi4nfckquecss";
+        self->k601____ = "2cu3f0vxl5ouwmvk";
+        self->k602____ = "9fy5v08smeup7oax";
+        self->k603____ = "wu22no1agvzx12l1";
+        self->k604____ = "8pmo046llot0jswu";
+        self->k605____ = "r0uaopbk2x3kaeru";
+        self->k606____ = "yb9fkdzeratjs01b";
+        self->k607____ = "i259dtwdtzv3umk4";
+        self->s50_____.k608____ = "thlap1xzuog7l0r8";
+        self->s50_____.k609____ = "kk94pxeq31m2zayt";
+        self->s50_____.k610____ = "cr15ihbsxrk6x019";
+        self->s50_____.k611____ = "b3wfq147a4ilrm7e";
+        self->s50_____.k612____ = "ey8pyxgifps5epqu";
+        self->s50_____.k613____ = "pxkiu5xklitow31r";
+        self->s50_____.k614____ = "5o40bxunabbk2lgj";
+        self->s50_____.k615____ = "ofox7hrlv8lftbvg";
+        self->s50_____.s51_____.k616____ = "fir7zl48xdb37dlh";
+        self->s50_____.s51_____.k617____ = "f1nsw94emyxvtfwh";
+        self->s50_____.s51_____.k618____ = "ew3qcx1x7vzek9vi";
+        self->s50_____.s51_____.k619____ = "d3fvoty3psgaubiu";
+        self->s50_____.s51_____.k620____ = "pin5hh3my5ux0l1v";
+        self->s50_____.s51_____.k621____ = "sdvrtuwhfukpbr8j";
+        self->s50_____.s51_____.k622____ = "zkq4dqov03mcp1mk";
+        self->s50_____.s51_____.k623____ = "vruqq2xy6cwgzjxh";
+        self->k624____ = "yi6zauuozltk6tgp";
+        self->k625____ = "llqlae3f8ynb8vja";
+        self->k626____ = "1wimnecxi0t7ql6e";
+        self->k627____ = "skto3qx8bhj28z8r";
+        self->k628____ = "nzx6re9jwalyjqn3";
+        self->k629____ = "eapznmq5qvyphsa4";
+        self->k630____ = "2dhx0a7g3o8pb2xc";
+        self->k631____ = "9sxu860uw52kuwsh";
+        self->s52_____.k632____ = "g340cqdp6m8c4me6";
+        self->s52_____.k633____ = "4yg9h6tff7iweoha";
+        self->s52_____.k634____ = "3tkj1ee64w4bty87";
+        self->s52_____.k635____ = "awc09ur02ttf7g3z";
+        self->s52_____.k636____ = "yng2i2wzb2r6lay4";
+        self->s52_____.k637____ = "l2kg6n12wvx60g9k";
+        self->s52_____.k638____ = "0t7h2f14poz5aafx";
+        self->s52_____.k639____ = "4cbrjryr71tpw8e6";
+        self->s52_____.s53_____.k640____ = "bzzkbvj18mutf65e";
+        self->s52_____.s53_____.k641____ = "eibqzjootzco5o4n";
+        self->s52_____.s53_____.k642____ = "65v7s756v9ekfirn";
+        self->s52_____.s53_____.k643____ = "l16x0n25ce87h0do";
+        self->s52_____.s53_____.k644____ = "ckiz4vec9ze7czs4";
+        self->s52_____.s53_____.k645____ = "jfmkgbjevsj6a5bt";
+        self->s52_____.s53_____.k646____ = "niyet3oh8ptqgru9";
+        self->s52_____.s53_____.k647____ = "mpifxnxbhmrpfltu";
+        self->k648____ = "ds9t5f2u7fp5xzfn";
+        self->k649____ = "hzxq63es4g3xfh2f";
+        self->k650____ = "wi9kijrjplxwqj1s";
+        self->k651____ = "7l116f41bu644tsg";
+        self->k652____ = "r8pfvzh40z8rm7b5";
+        self->k653____ = "i7dl30e31w27dlqx";
+        self->k654____ = "tykqncitm5s6rvoe";
+        self->k655____ = "txgcksnsoy2i5tz7";
+        self->s54_____.k656____ = "88w1c84ulnzykfq3";
+        self->s54_____.k657____ = "zz4jc0lheolxalds";
+        self->s54_____.k658____ = "3mc4h86r0m7xkf0s";
+        self->s54_____.k659____ = "22vetwr65rt82d2x";
+        self->s54_____.k660____ = "99vkd8jx243ol0td";
+        self->s54_____.k661____ = "oo7plckb4ls3jq8u";
+        self->s54_____.k662____ = "ozfvu4hih26314na";
+        self->s54_____.k663____ = "3avoe8qs67ca4qej";
+        self->s54_____.s55_____.k664____ = "ypmmq0vn04uyysck";
+        self->s54_____.s55_____.k665____ = "i8ir3wr5xtcyo6r4";
+        self->s54_____.s55_____.k666____ = "l3e1b8k8qa253oyp";
+        self->s54_____.s55_____.k667____ = "w2e6z4pe0zzt5ahh";
+        self->s54_____.s55_____.k668____ = "g5ugwk211spo300m";
+        self->s54_____.s55_____.k669____ = "bw66k1n06hnki2vm";
+        self->s54_____.s55_____.k670____ = "ib1n81zibuh7gw1z";
+        self->s54_____.s55_____.k671____ = "quxpdpo1xfjfaess";
+        self->k672____ = "p5ludt9jesozpof0";
+        self->k673____ = "ocdopxaajxmafqi1";
+        self->k674____ = "sntdad3g9f8uxgl9";
+        self->k675____ = "zjkvilcrawexbmzi";
+        self->k676____ = "6qghat42n14l2h6u";
+        self->k677____ = "l5w62dp4py1ok79f";
+        self->k678____ = "pckwb1iz6bzkmp0n";
+        self->k679____ = "gnwtf93pjkhbhff0";
+        self->s56_____.k680____ = "jyvnvl845d3r751p";
+        self->s56_____.k681____ = "jtv80p4ay6x7hvkd";
+        self->s56_____.k682____ = "qovq8lx1rnzagpfq";
+        self->s56_____.k683____ = "pnvvglyvxcwamzmu";
+        self->s56_____.k684____ = "lqj5lxrqitudc1hb";
+        self->s56_____.k685____ = "k1n7pa0lbawx7f03";
+        self->s56_____.k686____ = "b0io1yonknqwxpm4";
+        self->s56_____.k687____ = "zzy2qepqqcowvv9x";
+        self->s56_____.s57_____.k688____ = "2uarqy64fl1cmt4d";
+        self->s56_____.s57_____.k689____ = "9hqp2mnv0m3z4nf2";
+        self->s56_____.s57_____.k690____ = "l4y67ykpmstr25e2";
+        self->s56_____.s57_____.k691____ = "4kh0futojx7q8nsv";
+        self->s56_____.s57_____.k692____ = "fjxefqtfse5ebyrr";
+        self->s56_____.s57_____.k693____ = "mqdf76mtqfa5542k";
+        self->s56_____.s57_____.k694____ = "ih1dcy7434glzelc";
+        self->s56_____.s57_____.k695____ = "hwtusewac9e0ikct";
+        self->k696____ = "cnw4421xei400yya";
+        self->k697____ = "42wppudf7nawugte";
+        self->k698____ = "vd43l62mk8kjdicb";
+        self->k699____ = "mg4wp6r4m9dzj837";
+        self->k700____ = "63gqa6sfnyjmdm6g";
+        self->k701____ = "1604q7lisnp28k54";
+        self->k702____ = "cxft6vhgpw7tq6fl";
+        self->k703____ = "sgn7zzevvtd5ws2u";
+        self->s58_____.k704____ = "bnv0zrrt0iat3yh6";
+        self->s58_____.k705____ = "iyv2zz4gdbw0xssv";
+        self->s58_____.k706____ = "i57rc3ha7tygrenf";
+        self->s58_____.k707____ = "19ql4r258q4v5sxs";
+        self->s58_____.k708____ = "ksy3kvas1j2vob0c";
+        self->s58_____.k709____ = "rjigsfzu7wfamdrp";
+        self->s58_____.k710____ = "fiampf8h01h6gb2l";
+        self->s58_____.k711____ = "i5qrt7l3xy75bp1m";
+        self->s58_____.s59_____.k712____ = "9wxthrim3vd9xjrb";
+        self->s58_____.s59_____.k713____ = "9vteif6k0s3t39iz";
+        self->s58_____.s59_____.k714____ = "k214ennrhx9oendo";
+        self->s58_____.s59_____.k715____ = "rdthy7kxveawgx44";
+        self->s58_____.s59_____.k716____ = "r497r7tckb8vaf79";
+        self->s58_____.s59_____.k717____ = "275xrkmbloqzdl65";
+        self->s58_____.s59_____.k718____ = "leg2nguxqpcmvfcm";
+        self->s58_____.s59_____.k719____ = "hlgkwk7oo6uyptnj";
+        self->k720____ = "ko8tw4om5b3monyn";
+        self->k721____ = "rngz0cdh6whdmx1o";
+        self->k722____ = "n28wpw2v0mrl43gk";
+        self->k723____ = "aqrulgj65nt4ux2x";
+        self->k724____ = "l5709s756k385otd";
+        self->k725____ = "c4jh5g0rgpwrz2cm";
+        self->k726____ = "8rzjy49yhyqj1svm";
+        self->k727____ = "bi30iku0a746wiyf";
+        self->s60_____.k728____ = "itu62srf0ci6ys40";
+        self->s60_____.k729____ = "akirfkz5598e0ejk";
+        self->s60_____.k730____ = "tb217ccga2qxb0yd";
+        self->s60_____.k731____ = "cymujk9isbb1xel1";
+        self->s60_____.k732____ = "odmsscqh98dw30sq";
+        self->s60_____.k733____ = "fgqmk1zguhncqujy";
+        self->s60_____.k734____ = "mbhv01n2zy9vos9f";
+        self->s60_____.k735____ = "ui151hsdxbzruaw8";
+        self->s60_____.s61_____.k736____ = "1tde9ddreoczpkfs";
+        self->s60_____.s61_____.k737____ = "sgx8pt2izpqijqu9";
+        self->s60_____.s61_____.k738____ = "0rp1m9z0dboqds19";
+        self->s60_____.s61_____.k739____ = "fb0r6947usipve3u";
+        self->s60_____.s61_____.k740____ = "uecxa50yjl4pa5ea";
+        self->s60_____.s61_____.k741____ = "x5cai5t8hqlckbpj";
+        self->s60_____.s61_____.k742____ = "p4so3dyv2zng2xo7";
+        self->s60_____.s61_____.k743____ = "83cl7l3lzw1btjj8";
+        self->k744____ = "fi3fv18sx1fj79pl";
+        self->k745____ = "r1nks5oyeexn5rcd";
+        self->k746____ = "q0v2kdt5rjnqopj2";
+        self->k747____ = "hv7z0d2vl4ouij66";
+        self->k748____ = "pqzhhpz22tu5c9lv";
+        self->k749____ = "wlff5y45rywpbz4z";
+        self->k750____ = "r8y0lqc38zy8xde0";
+        self->k751____ = "73u66m1y6s8kbj95";
+        self->s62_____.k752____ = "ueejemq835hw614t";
+        self->s62_____.k753____ = "5x61min7senfoj32";
+        self->s62_____.k754____ = "5ki63q4dasdju52y";
+        self->s62_____.k755____ = "04dkn2h839b2s38z";
+        self->s62_____.k756____ = "3zl2zalfcqtaf2nv";
+        self->s62_____.k757____ = "iydjz2u1eb61xgig";
+        self->s62_____.k758____ = "6pd98ar4b8wlbmds";
+        self->s62_____.k759____ = "h8dioe82c5eceoo1";
+        self->s62_____.s63_____.k760____ = "kbk482dp6ackomy2";
+        self->s62_____.s63_____.k761____ = "gmw1lihf332s2w16";
+        self->s62_____.s63_____.k762____ = "b9wrtuquggov1u8r";
+        self->s62_____.s63_____.k763____ = "6g04dyvgmp93zobb";
+        self->s62_____.s63_____.k764____ = "m30que03rybmlii4";
+        self->s62_____.s63_____.k765____ = "1eocmfx68v5iosd8";
+        self->s62_____.s63_____.k766____ = "01bpevl81wj9y2fl";
+        self->s62_____.s63_____.k767____ = "cwjnv36f79hd88e2";
+        self->k768____ = "rjzgv7zh8eyln65q";
+        self->k769____ = "mqvmrb0cpjkcdo83";
+        self->k770____ = "mlvbgzxi3lakbq7f";
+        self->k771____ = "11ahkzu98egrlcdc";
+        self->k772____ = "wo2nwbm4hbmzkb8s";
+        self->k773____ = "fni0cvje7kva2dft";
+        self->k774____ = "nm6qlzc9015i476l";
+        self->k775____ = "6lmzhbpn523hvt1a";
+        self->s64_____.k776____ = "p4pxxr2ybz5hx7jn";
+        self->s64_____.k777____ = "57heyricsw3tjhmf";
+        self->s64_____.k778____ = "4690yvjrxd9k6j9g";
+        self->s64_____.k779____ = "r1p9q741n6q0opow";
+        self->s64_____.k780____ = "r0dbnjps4z8benrh";
+        self->s64_____.k781____ = "eb5lrkuzpo2rdpyp";
+        self->s64_____.k782____ = "xmg6z4uh6l8mr78e";
+        self->s64_____.k783____ = "1dskw038c26etxrf";
+        self->s64_____.s65_____.k784____ = "kcclos825rv2o3qr";
+        self->s64_____.s65_____.k785____ = "rf87gsl5y8p1etpc";
+        self->s64_____.s65_____.k786____ = "zqgw9ka3km3h4fcc";
+        self->s64_____.s65_____.k787____ = "u6fihc3a9vtge165";
+        self->s64_____.s65_____.k788____ = "157o1cbp68zg90ll";
+        self->s64_____.s65_____.k789____ = "g47p5wkjgdk3bewm";
+        self->s64_____.s65_____.k790____ = "8f3v2klipaanpkze";
+        self->s64_____.s65_____.k791____ = "bqr0686k6zky4q2r";
+        self->k792____ = "m16uq0r7c8iaq4cc";
+        self->k793____ = "64inn0zxhhwywu7w";
+        self->k794____ = "p3ydjk4wqy21n4i5";
+        self->k795____ = "8aym38hu03rtlyxx";
+        self->k796____ = "wdqg08qdh01oj0gy";
+        self->k797____ = "bwqm49jk2pbg6ajm";
+        self->k798____ = "ujtnot72zmxbwo9f";
+        self->k799____ = "uahddp8dl3zv6igg";
+        self->s66_____.k800____ = "tpdqdppnmk8rtwj4";
+        self->s66_____.k801____ = "44ds9lamfdq6bae9";
+        self->s66_____.k802____ = "0j5pi57o9zo21kp9";
+        self->s66_____.k803____ = "zvgv61wri02x7q3e";
+        self->s66_____.k804____ = "uiolyhk6jl01uheq";
+        self->s66_____.k805____ = "5xw26htgp2xggflv";
+        self->s66_____.k806____ = "xkswvdyb63j869gf";
+        self->s66_____.k807____ = "0rg1jhbtzshzdvf4";
+        self->s66_____.s67_____.k808____ = "nefvzdc8tlv7fhld";
+        self->s66_____.s67_____.k809____ = "3h70odsmqex7db89";
+        self->s66_____.s67_____.k810____ = "mw3ac1x9nbza89fi";
+        self->s66_____.s67_____.k811____ = "prff0du3hwsiajqe";
+        self->s66_____.s67_____.k812____ = "tard5tjme5uhshlz";
+        self->s66_____.s67_____.k813____ = "01nzp2gxjac1nnk7";
+        self->s66_____.s67_____.k814____ = "rg2w92oz8va4p16o";
+        self->s66_____.s67_____.k815____ = "bju2iahuawks33px";
+        self->k816____ = "26q3aa28fh5gupgt";
+        self->k817____ = "9hid6ab7k2bbw7ru";
+        self->k818____ = "hoe6ja0xq0hjut6m";
+        self->k819____ = "g81kzexwr5nek303";
+        self->k820____ = "3bx6z21jki5mbubf";
+        self->k821____ = "2yp3zaydiret1ses";
+        self->k822____ = "ath1c23grsk1by1w";
+        self->k823____ = "hk5ucysm4lakyssx";
+        self->s68_____.k824____ = "k3c8gy192q48km6q";
+        self->s68_____.k825____ = "wegh5yd7vju0uk52";
+        self->s68_____.k826____ = "np4rhmma808j9io3";
+        self->s68_____.k827____ = "6ckotqnsudhj3krr";
+        self->s68_____.k828____ = "u3426yszvav69ei4";
+        self->s68_____.k829____ = "tak4uvhi8b1i4oxg";
+        self->s68_____.k830____ = "0x3di7dgh8zhyynd";
+        self->s68_____.k831____ = "08rnfnan7dld4062";
+        self->s68_____.s69_____.k832____ = "3nvw7f7lo2adbmx2";
+        self->s68_____.s69_____.k833____ = "62jebjkw9n4whog3";
+        self->s68_____.s69_____.k834____ = "ihvbwvxmrd6w3qfn";
+        self->s68_____.s69_____.k835____ = "ddmtwbm9k603tg5w";
+        self->s68_____.s69_____.k836____ = "c8mn4ze0tbur070g";
+        self->s68_____.s69_____.k837____ = "zbu0cn7inkvymdjl";
+        self->s68_____.s69_____.k838____ = "vu2a97gd8h1iozet";
+        self->s68_____.s69_____.k839____ = "u9qvp71r5qvpndle";
+        self->k840____ = "pglxpfqa3rhl57rv";
+        self->k841____ = "5zxa23ewo03xj5ur";
+        self->k842____ = "cup0y7vr1ppsazpc";
+        self->k843____ = "759dq7c5n6ig05gs";
+        self->k844____ = "rg9r375ogz0j6n71";
+        self->k845____ = "a3d13sa354uvtxal";
+        self->k846____ = "du42z4qhi98mfz4q";
+        self->k847____ = "phokc4bgweiu15r3";
+        self->s70_____.k848____ = "88odo8kel7vqsrmv";
+        self->s70_____.k849____ = "zrwnowppi8txu158";
+        self->s70_____.k850____ = "b204d8m7ou7l4fw4";
+        self->s70_____.k851____ = "q63mh4nih798y5ed";
+        self->s70_____.k852____ = "dln0hcvlu4zwpg59";
+        self->s70_____.k853____ = "gczldwgnodk3ziw2";
+        self->s70_____.k854____ = "gz7v6oxu52un1g7m";
+        self->s70_____.k855____ = "36vwmoywubwmsyqz";
+        self->s70_____.s71_____.k856____ = "alm6icvj88uiiskc";
+        self->s70_____.s71_____.k857____ = "6c2nzgjpxxsmkyrc";
+        self->s70_____.s71_____.k858____ = "97atjwc4mq29jkm1";
+        self->s70_____.s71_____.k859____ = "ca6yn4t68vbxdehp";
+        self->s70_____.s71_____.k860____ = "c5uo8oa9hwpsnksq";
+        self->s70_____.s71_____.k861____ = "z8q60x3wulfcuuvu";
+        self->s70_____.s71_____.k862____ = "ej1z8xfivuxboshr";
+        self->s70_____.s71_____.k863____ = "qehddt8txjzzmuo8";
+        self->k864____ = "91l2pttfi0kj1gzg";
+        self->k865____ = "owhct96m3xumr6q9";
+        self->k866____ = "0rptq9rghvgexs99";
+        self->k867____ = "37w72xonicmljufy";
+        self->k868____ = "qigpa9kift01yx6m";
+        self->k869____ = "1psiax58dqlgob5n";
+        self->k870____ = "lcksntq3avfgyh43";
+        self->k871____ = "sfsdn5ztr8ljdfvg";
+        self->s72_____.k872____ = "fev7flc81tvrf9xt";
+        self->s72_____.k873____ = "rdjc8lg2yexv53s1";
+        self->s72_____.k874____ = "64rukthdz7rywlnu";
+        self->s72_____.k875____ = "d3j7sli3l40qqfiy";
+        self->s72_____.k876____ = "xmbld1nmqlmdo9h7";
+        self->s72_____.k877____ = "odv3lm05v285z7kz";
+        self->s72_____.k878____ = "vwaktywb43y09x6o";
+        self->s72_____.k879____ = "b3eqamh62oo87z19";
+        self->s72_____.s73_____.k880____ = "y62veimozlh0ml4t";
+        self->s72_____.s73_____.k881____ = "llixayn34mv7k77e";
+        self->s72_____.s73_____.k882____ = "d8meb20lq0dr25yi";
+        self->s72_____.s73_____.k883____ = "04psnu5grxze4vwn";
+        self->s72_____.s73_____.k884____ = "z3pqv2xzwqlejirz";
+        self->s72_____.s73_____.k885____ = "iyxbfu692j619wik";
+        self->s72_____.s73_____.k886____ = "mtlhgizk708d7etg";
+        self->s72_____.s73_____.k887____ = "9wl2cakiot2gq489";
+        self->k888____ = "w7g00iddiu8sgqua";
+        self->k889____ = "om01tetrjrm4ew5u";
+        self->k890____ = "npkvlayig8oblygb";
+        self->k891____ = "mo8cpi34a9t33c73";
+        self->k892____ = "ansy224bzyf2lu6g";
+        self->k893____ = "52oger9usfd2sw1g";
+        self->k894____ = "41jlq3141cjhq2vh";
+        self->k895____ = "cojnn3yjvx9dcwum";
+        self->s74_____.k896____ = "nzzcjfftsau53a16";
+        self->s74_____.k897____ = "qq3yvvsctvsg98ov";
+        self->s74_____.k898____ = "e17bwz1urdmg3e3n";
+        self->s74_____.k899____ = "99ydkr6l020v9k1o";
+        self->s74_____.k900____ = "oouvsnm09r6z0rsc";
+        self->s74_____.k901____ = "7zagkzzqjw72id3l";
+        self->s74_____.k902____ = "ryyq5v4tgd564vqx";
+        self->s74_____.k903____ = "ixinhntnx6jlv5xe";
+        self->s74_____.s75_____.k904____ = "h4lttz26zf5t5jzr";
+        self->s74_____.s75_____.k905____ = "9zxa2z20gw3539yz";
+        self->s74_____.s75_____.k906____ = "gud4effzl514qzp4";
+        self->s74_____.s75_____.k907____ = "3xxtifg9veeg0h8s";
+        self->s74_____.s75_____.k908____ = "zwhr375kk3s3efjx";
+        self->s74_____.s75_____.k909____ = "qzt1rgqfd02r9ty1";
+        self->s74_____.s75_____.k910____ = "5aoi3oa5yhc6vr8m";
+        self->s74_____.s75_____.k911____ = "1h448wv44me21pfb";
+        self->k912____ = "cc0xwg4e973e0vur";
+        self->k913____ = "ffg3w49xactt6tto";
+        self->k914____ = "72wc1wa7kuvxkvww";
+        self->k915____ = "6yjyd8ru9nx8ilyt";
+        self->k916____ = "txrstc3lm8n0pkhx";
+        self->k917____ = "44v51883kxcrrucy";
+        self->k918____ = "4nbr2gtilimb9gji";
+        self->k919____ = "3mfomwysafw6we6v";
+        self->s76_____.k920____ = "i9ymmcvn8oqmisg8";
+        self->s76_____.k921____ = "asejrov915ge0afg";
+        self->s76_____.k922____ = "xvulr4kk6mqtbsa1";
+        self->s76_____.k923____ = "4yaef0tqwnfdti1t";
+        self->s76_____.k924____ = "kha8086l9c5o74sm";
+        self->s76_____.k925____ = "7gyag1vgypzsiir6";
+        self->s76_____.k926____ = "ajxbotbevm938wpn";
+        self->s76_____.k927____ = "qetdtdcx5njveisk";
+        self->s76_____.s77_____.k928____ = "5dlm1pxnm8cbd8rc";
+        self->s76_____.s77_____.k929____ = "8894d1iijduiveu1";
+        self->s76_____.s77_____.k930____ = "kftxa5fwhrk69o1h";
+        self->s76_____.s77_____.k931____ = "rv4z2x0fm0mhnivq";
+        self->s76_____.s77_____.k932____ = "q6w9i98679opu1qq";
+        self->s76_____.s77_____.k933____ = "lhseuxd4hqtw07xv";
+        self->s76_____.s77_____.k934____ = "hs4kfpifm3jsm1w7";
+        self->s76_____.s77_____.k935____ = "c3sdbdv5bglzt7vo";
+        self->k936____ = "rqfnzh80tx7fn595";
+        self->k937____ = "jpf0olwaaexvhb8h";
+        self->k938____ = "mwni8p1hz7f6w9fa";
+        self->k939____ = "hbrbst2b5ckaazie";
+        self->k940____ = "1qfddtbmul6t011j";
+        self->k941____ = "4lbz1mklj2stjn43";
+        self->k942____ = "b460hes343iglt68";
+        self->k943____ = "7rieimt6q4k8n7td";
+        self->s78_____.k944____ = "aemfqiy0rp1kapwl";
+        self->s78_____.k945____ = "5te9eifvw2j34jny";
+        self->s78_____.k946____ = "986unuc5a8t7qxee";
+        self->s78_____.k947____ = "ck5g7edcv1rmgfw7";
+        self->s78_____.k948____ = "zr5ifa9j4ypub2zz";
+        self->s78_____.k949____ = "eqp7byi92nqxl0ak";
+        self->s78_____.k950____ = "exhlcevsno4drqho";
+        self->s78_____.k951____ = "9g964606stag6ooh";
+        self->s78_____.s79_____.k952____ = "0ngwgq1hauogceii";
+        self->s78_____.s79_____.k953____ = "ca4h5mtbbzekig9a";
+        self->s78_____.s79_____.k954____ = "r1g352iycskf1ysv";
+        self->s78_____.s79_____.k955____ = "io0kdinoy59f703r";
+        self->s78_____.s79_____.k956____ = "qz0eq2snnyrilaq4";
+        self->s78_____.s79_____.k957____ = "9i0ca31uor5eospk";
+        self->s78_____.s79_____.k958____ = "s53lmr58ps79ae3d";
+        self->s78_____.s79_____.k959____ = "sgnfbzq3fdxdw46y";
+        self->k960____ = "vjbk3znhwim5reh2";
+        self->k961____ = "ii3q7vgg5rcgpcwn";
+        self->k962____ = "utnj8v9yj5mgbq7n";
+        self->k963____ = "hxa54ji1s203901g";
+        self->k964____ = "ckqr4za4dfevc74o";
+        self->k965____ = "3nus8nvi3kbua531";
+        self->k966____ = "nyemt7ktox9q0vy9";
+        self->k967____ = "6tq3tntv9evlbxtu";
+        self->s80_____.k968____ = "l4ht17iufz5xd7nb";
+        self->s80_____.k969____ = "pfxey32ccsbpfty3";
+        self->s80_____.k970____ = "8ehcir7zthtsij90";
+        self->s80_____.k971____ = "f5plqnglbmmkw98w";
+        self->s80_____.k972____ = "7whb3jhoorc727j5";
+        self->s80_____.k973____ = "yjhljk6zxcq7ptyt";
+        self->s80_____.k974____ = "9iwq3si9q1kq3r4u";
+        self->s80_____.k975____ = "hlwo0czg0i225djb";
+        self->s80_____.s81_____.k976____ = "wokhc8g2d7zuc7e7";
+        self->s80_____.s81_____.k977____ = "vngjw8992cxxyx9c";
+        self->s80_____.s81_____.k978____ = "va401k2b023p8zco";
+        self->s80_____.s81_____.k979____ = "627ql8vax7tou1mh";
+        self->s80_____.s81_____.k980____ = "dxj0lsrxasfshkl1";
+        self->s80_____.s81_____.k981____ = "8w355w4vwtgvvy8a";
+        self->s80_____.s81_____.k982____ = "s7z36ghq9emvdcru";
+        self->s80_____.s81_____.k983____ = "vaf46oe8a3kmg2e7";
+        self->k984____ = "a9eyu0rjs8yuawc0";
+        self->k985____ = "qgarnwjlh5ca0arg";
+        self->k986____ = "93uhng8sem2hnkix";
+        self->k987____ = "4aa674pasvn55i11";
+        self->k988____ = "8lackwu51wdwfgwu";
+        self->k989____ = "7k6y0lnomhz0euza";
+        self->k990____ = "ijpz81vqzyhvs8xb";
+        self->k991____ = "mipxpl0p1f3rqaco";
+        self->s82_____.k992____ = "p5tqtd9rygkblov8";
+        self->s82_____.k993____ = "8wpwhhiazxyen6yt";
+        self->s82_____.k994____ = "4j19m1fo1no6l8hh";
+        self->s82_____.k995____ = "rbcze9cb2kutrynq";
+        self->s82_____.k996____ = "mq096h4yn58l2t2a";
+        self->s82_____.k997____ = "tt4qm9xk9al0g35j";
+        self->s82_____.k998____ = "lko079ubyznk6hsz";
+        self->s82_____.k999____ = "wz8hbdz9ng9bp7vk";
+}
+static const uint32_t benchdisplacements[251] =
+{
+        5, 113, 0, 1, 99, 106, 33, 0, 9, 11, 1, 47, 30, 32, 6, 6,
+        22, 180, 2, 7, 63, 40, 16, 1, 12, 83, 4, 20, 69, 0, 0, 18,
+        4, 54, 10, 0, 3, 33, 49, 12, 5, 14, 0, 89, 83, 0, 0, 368,
+        27, 4, 3, 67, 1, 139, 79, 118, 2, 19, 12, 52, 86, 31, 334, 109,
+        0, 213, 3, 209, 3, 4, 42, 24, 3, 320, 22, 93, 0, 128, 171, 0,
+        20, 4, 106, 6, 2, 132, 7, 120, 98, 8, 0, 399, 6, 2, 0, 73,
+        16, 5, 1, 32, 249, 11, 11, 9, 389, 366, 4, 11, 107, 196, 17, 15,
+        87, 69, 16, 0, 159, 262, 5, 1, 189, 14, 15, 0, 32, 676, 7, 226,
+        343, 282, 14, 55, 1, 163, 346, 229, 1, 15, 10, 0, 47, 3, 298, 135,
+        5, 573, 84, 25, 10, 79, 35, 243, 109, 2, 0, 3, 13, 31, 1055, 66,
+        25, 285, 261, 47, 2, 122, 8, 0, 32, 0, 692, 175, 446, 0, 2, 1451,
+        11, 121, 5, 75, 1064, 39, 101, 240, 35, 14, 22, 0, 1, 0, 134, 945,
+        431, 793, 36, 137, 154, 367, 155, 348, 120, 137, 133, 152, 284, 517, 0, 175,
+        127, 31, 24, 594, 696, 13, 14, 0, 126, 5, 126, 274, 2642, 0, 546, 6,
+        1066, 926, 1011, 3, 2, 499, 26, 89, 0, 11, 2744, 948, 33, 2440, 17, 45,
+        4, 5330, 131, 982, 94, 2161, 33, 0, 28, 366, 12,
+};
+static const struct { char *name; uint32_t length; int id; } benchslots[1000] =
+{
+        { "s8______.k106____", 17, BENCH_S8_______K106____ },
+        { "s52_____.k637____", 17, BENCH_S52______K637____ },
+        { "k653____", 8, BENCH_K653____ },
+        { "k798____", 8, BENCH_K798____ },
+        { "s54_____.s55_____.k666____", 26, BENCH_S54______S55______K666____ },
+        { "s48_____.k587____", 17, BENCH_S48______K587____ },
+        { "s12_____.k156____", 17, BENCH_S12______K156____ },
+        { "s4______.s5______.k71_____", 26, BENCH_S4_______S5_______K71_____ },
+        { "k7______", 8, BENCH_K7______ },
+        { "s78_____.k951____", 17, BENCH_S78______K951____ },
+        { "s0______.s1______.k21_____", 26, BENCH_S0_______S1_______K21_____ },
+        { "s14_____.k182____", 17, BENCH_S14______K182____ },
+        { "s48_____.s49_____.k595____", 26, BENCH_S48______S49______K595____ },
+        { "s18_____.s19_____.k232____", 26, BENCH_S18______S19______K232____ },
+        { "k245____", 8, BENCH_K245____ },
+        { "s14_____.k179____", 17, BENCH_S14______K179____ },
+        { "s12_____.k152____", 17, BENCH_S12______K152____ },
+        { "s60_____.k732____", 17, BENCH_S60______K732____ },
+        { "s58_____.k706____", 17, BENCH_S58______K706____ },
+        { "s62_____.k754____", 17, BENCH_S62______K754____ },
+        { "k29_____", 8, BENCH_K29_____ },
+        { "k317____", 8, BENCH_K317____ },
+        { "s38_____.s39_____.k472____", 26, BENCH_S38______S39______K472____ },
+        { "k196____", 8, BENCH_K196____ },
+        { "s72_____.s73_____.k882____", 26, BENCH_S72______S73______K882____ },
+        { "k408____", 8, BENCH_K408____ },
+        { "s30_____.s31_____.k383____", 26, BENCH_S30______S31______K383____ },
+        { "k912____", 8, BENCH_K912____ },
+        { "s28_____.s29_____.k352____", 26, BENCH_S28______S29______K352____ },
+        { "s56_____.s57_____.k692____", 26, BENCH_S56______S57______K692____ },
+        { "s22_____.s23_____.k282____", 26, BENCH_S22______S23______K282____ },
+        { "s18_____.s19_____.k236____", 26, BENCH_S18______S19______K236____ },
+        { "k457____", 8, BENCH_K457____ },
+        { "k531____", 8, BENCH_K531____ },
+        { "k291____", 8, BENCH_K291____ },
+        { "k415____", 8, BENCH_K415____ },
+        { "k24_____", 8, BENCH_K24_____ },
+        { "s80_____.s81_____.k978____", 26, BENCH_S80______S81______K978____ },
+        { "s30_____.s31_____.k376____", 26, BENCH_S30______S31______K376____ },
+        { "s6______.s7______.k88_____", 26, BENCH_S6_______S7_______K88_____ },
+        { "s18_____.s19_____.k237____", 26, BENCH_S18______S19______K237____ },
+        { "s72_____.k875____", 17, BENCH_S72______K875____ },
+        { "k601____", 8, BENCH_K601____ },
+        { "s64_____.k778____", 17, BENCH_S64______K778____ },
+        { "s12_____.s13_____.k163____", 26, BENCH_S12______S13______K163____ },
+        { "k435____", 8, BENCH_K435____ },
+        { "s16_____.k200____", 17, BENCH_S16______K200____ },
+        { "k195____", 8, BENCH_K195____ },
+        { "s30_____.k373____", 17, BENCH_S30______K373____ },
+        { "s64_____.k777____", 17, BENCH_S64______K777____ },
+        { "s62_____.s63_____.k767____", 26, BENCH_S62______S63______K767____ },
+        { "s10_____.s11_____.k143____", 26, BENCH_S10______S11______K143____ },
+        { "k266____", 8, BENCH_K266____ },
+        { "k341____", 8, BENCH_K341____ },
+        { "s62_____.k753____", 17, BENCH_S62______K753____ },
+        { "s60_____.s61_____.k742____", 26, BENCH_S60______S61______K742____ },
+        { "k842____", 8, BENCH_K842____ },
+        { "k746____", 8, BENCH_K746____ },
+        { "k771____", 8, BENCH_K771____ },
+        { "s80_____.s81_____.k983____", 26, BENCH_S80______S81______K983____ },
+        { "s28_____.s29_____.k357____", 26, BENCH_S28______S29______K357____ },
+        { "s72_____.k877____", 17, BENCH_S72______K877____ },
+        { "k795____", 8, BENCH_K795____ },
+        { "k553____", 8, BENCH_K553____ },
+        { "s26_____.s27_____.k328____", 26, BENCH_S26______S27______K328____ },
+        { "s0______.k10_____", 17, BENCH_S0_______K10_____ },
+        { "k98_____", 8, BENCH_K98_____ },
+        { "s44_____.s45_____.k546____", 26, BENCH_S44______S45______K546____ },
+        { "s68_____.k827____", 17, BENCH_S68______K827____ },
+        { "s28_____.k351____", 17, BENCH_S28______K351____ },
+        { "s2______.s3______.k42_____", 26, BENCH_S2_______S3_______K42_____ },
+        { "s26_____.s27_____.k334____", 26, BENCH_S26______S27______K334____ },
+        { "s64_____.s65_____.k785____", 26, BENCH_S64______S65______K785____ },
+        { "k841____", 8, BENCH_K841____ },
+        { "k960____", 8, BENCH_K960____ },
+        { "k197____", 8, BENCH_K197____ },
+        { "k630____", 8, BENCH_K630____ },
+        { "s68_____.k828____", 17, BENCH_S68______K828____ },
+        { "s74_____.k901____", 17, BENCH_S74______K901____ },
+        { "k840____", 8, BENCH_K840____ },
+        { "k192____", 8, BENCH_K192____ },
+        { "s42_____.k517____", 17, BENCH_S42______K517____ },
+        { "s12_____.k153____", 17, BENCH_S12______K153____ },
+        { "s26_____.k321____", 17, BENCH_S26______K321____ },
+        { "s36_____.k447____", 17, BENCH_S36______K447____ },
+        { "s14_____.k176____", 17, BENCH_S14______K176____ },
+        { "s56_____.k684____", 17, BENCH_S56______K684____ },
+        { "s16_____.s17_____.k214____", 26, BENCH_S16______S17______K214____ },
+        { "s6______.s7______.k90_____", 26, BENCH_S6_______S7_______K90_____ },
+        { "s2______.k34_____", 17, BENCH_S2_______K34_____ },
+        { "s8______.k105____", 17, BENCH_S8_______K105____ },
+        { "k696____", 8, BENCH_K696____ },
+        { "s82_____.k997____", 17, BENCH_S82______K997____ },
+        { "s72_____.k872____", 17, BENCH_S72______K872____ },
+        { "s44_____.s45_____.k551____", 26, BENCH_S44______S45______K551____ },
+        { "k434____", 8, BENCH_K434____ },
+        { "s48_____.k590____", 17, BENCH_S48______K590____ },
+        { "k943____", 8, BENCH_K943____ },
+        { "s26_____.k327____", 17, BENCH_S26______K327____ },
+        { "s28_____.k346____", 17, BENCH_S28______K346____ },
+        { "s36_____.k446____", 17, BENCH_S36______K446____ },
+        { "s58_____.s59_____.k715____", 26, BENCH_S58______S59______K715____ },
+        { "s52_____.s53_____.k646____", 26, BENCH_S52______S53______K646____ },
+        { "s44_____.s45_____.k548____", 26, BENCH_S44______S45______K548____ },
+        { "s0______.s1______.k16_____", 26, BENCH_S0_______S1_______K16_____ },
+        { "k433____", 8, BENCH_K433____ },
+        { "s34_____.s35_____.k426____", 26, BENCH_S34______S35______K426____ },
+        { "s74_____.k896____", 17, BENCH_S74______K896____ },
+        { "k797____", 8, BENCH_K797____ },
+        { "s6______.s7______.k92_____", 26, BENCH_S6_______S7_______K92_____ },
+        { "s64_____.k780____", 17, BENCH_S64______K780____ },
+        { "k748____", 8, BENCH_K748____ },
+        { "k219____", 8, BENCH_K219____ },
+        { "k103____", 8, BENCH_K103____ },
+        { "s30_____.k368____", 17, BENCH_S30______K368____ },
+        { "s80_____.s81_____.k982____", 26, BENCH_S80______S81______K982____ },
+        { "s4______.k62_____", 17, BENCH_S4_______K62_____ },
+        { "s34_____.s35_____.k428____", 26, BENCH_S34______S35______K428____ },
+        { "k485____", 8, BENCH_K485____ },
+        { "s64_____.s65_____.k786____", 26, BENCH_S64______S65______K786____ },
+        { "k774____", 8, BENCH_K774____ },
+        { "s74_____.s75_____.k910____", 26, BENCH_S74______S75______K910____ },
+        { "k698____", 8, BENCH_K698____ },
+        { "k821____", 8, BENCH_K821____ },
+        { "s34_____.k418____", 17, BENCH_S34______K418____ },
+        { "k123____", 8, BENCH_K123____ },
+        { "k437____", 8, BENCH_K437____ },
+        { "k865____", 8, BENCH_K865____ },
+        { "k936____", 8, BENCH_K936____ },
+        { "s68_____.s69_____.k839____", 26, BENCH_S68______S69______K839____ },
+        { "s38_____.k465____", 17, BENCH_S38______K465____ },
+        { "s30_____.s31_____.k378____", 26, BENCH_S30______S31______K378____ },
+        { "s10_____.k129____", 17, BENCH_S10______K129____ },
+        { "s68_____.k824____", 17, BENCH_S68______K824____ },
+        { "s28_____.s29_____.k356____", 26, BENCH_S28______S29______K356____ },
+        { "k579____", 8, BENCH_K579____ },
+        { "s70_____.k851____", 17, BENCH_S70______K851____ },
+        { "s66_____.k803____", 17, BENCH_S66______K803____ },
+        { "k101____", 8, BENCH_K101____ },
+        { "k799____", 8, BENCH_K799____ },
+        { "s12_____.k154____", 17, BENCH_S12______K154____ },
+        { "k52_____", 8, BENCH_K52_____ },
+        { "s76_____.s77_____.k930____", 26, BENCH_S76______S77______K930____ },
+        { "s80_____.s81_____.k980____", 26, BENCH_S80______S81______K980____ },
+        { "k721____", 8, BENCH_K721____ },
+        { "s16_____.s17_____.k213____", 26, BENCH_S16______S17______K213____ },
+        { "s76_____.s77_____.k933____", 26, BENCH_S76______S77______K933____ },
+        { "s48_____.s49_____.k593____", 26, BENCH_S48______S49______K593____ },
+        { "s14_____.k183____", 17, BENCH_S14______K183____ },
+        { "s70_____.s71_____.k857____", 26, BENCH_S70______S71______K857____ },
+        { "s18_____.k228____", 17, BENCH_S18______K228____ },
+        { "k338____", 8, BENCH_K338____ },
+        { "s42_____.k515____", 17, BENCH_S42______K515____ },
+        { "k73_____", 8, BENCH_K73_____ },
+        { "k486____", 8, BENCH_K486____ },
+        { "s20_____.s21_____.k261____", 26, BENCH_S20______S21______K261____ },
+        { "s52_____.s53_____.k642____", 26, BENCH_S52______S53______K642____ },
+        { "k631____", 8, BENCH_K631____ },
+        { "s62_____.s63_____.k765____", 26, BENCH_S62______S63______K765____ },
+        { "k125____", 8, BENCH_K125____ },
+        { "k990____", 8, BENCH_K990____ },
+        { "k725____", 8, BENCH_K725____ },
+        { "s24_____.s25_____.k304____", 26, BENCH_S24______S25______K304____ },
+        { "s50_____.s51_____.k618____", 26, BENCH_S50______S51______K618____ },
+        { "s8______.k110____", 17, BENCH_S8_______K110____ },
+        { "k988____", 8, BENCH_K988____ },
+        { "s78_____.s79_____.k955____", 26, BENCH_S78______S79______K955____ },
+        { "s60_____.k733____", 17, BENCH_S60______K733____ },
+        { "k459____", 8, BENCH_K459____ },
+        { "s28_____.k345____", 17, BENCH_S28______K345____ },
+        { "s14_____.s15_____.k190____", 26, BENCH_S14______S15______K190____ },
+        { "s72_____.s73_____.k886____", 26, BENCH_S72______S73______K886____ },
+        { "s34_____.s35_____.k430____", 26, BENCH_S34______S35______K430____ },
+        { "k385____", 8, BENCH_K385____ },
+        { "s14_____.s15_____.k185____", 26, BENCH_S14______S15______K185____ },
+        { "k75_____", 8, BENCH_K75_____ },
+        { "s58_____.k711____", 17, BENCH_S58______K711____ },
+        { "s2______.s3______.k41_____", 26, BENCH_S2_______S3_______K41_____ },
+        { "s22_____.k279____", 17, BENCH_S22______K279____ },
+        { "s16_____.s17_____.k211____", 26, BENCH_S16______S17______K211____ },
+        { "s50_____.k612____", 17, BENCH_S50______K612____ },
+        { "s54_____.k661____", 17, BENCH_S54______K661____ },
+        { "k866____", 8, BENCH_K866____ },
+        { "k74_____", 8, BENCH_K74_____ },
+        { "s80_____.k975____", 17, BENCH_S80______K975____ },
+        { "k604____", 8, BENCH_K604____ },
+        { "s54_____.k663____", 17, BENCH_S54______K663____ },
+        { "s70_____.s71_____.k861____", 26, BENCH_S70______S71______K861____ },
+        { "k511____", 8, BENCH_K511____ },
+        { "s68_____.k826____", 17, BENCH_S68______K826____ },
+        { "k194____", 8, BENCH_K194____ },
+        { "s38_____.s39_____.k473____", 26, BENCH_S38______S39______K473____ },
+        { "k292____", 8, BENCH_K292____ },
+        { "k170____", 8, BENCH_K170____ },
+        { "s40_____.k491____", 17, BENCH_S40______K491____ },
+        { "k342____", 8, BENCH_K342____ },
+        { "k606____", 8, BENCH_K606____ },
+        { "s4______.s5______.k66_____", 26, BENCH_S4_______S5_______K66_____ },
+        { "s34_____.s35_____.k429____", 26, BENCH_S34______S35______K429____ },
+        { "s34_____.k421____", 17, BENCH_S34______K421____ },
+        { "s2______.k32_____", 17, BENCH_S2_______K32_____ },
+        { "s44_____.k540____", 17, BENCH_S44______K540____ },
+        { "k173____", 8, BENCH_K173____ },
+        { "s20_____.s21_____.k262____", 26, BENCH_S20______S21______K262____ },
+        { "s48_____.k584____", 17, BENCH_S48______K584____ },
+        { "k528____", 8, BENCH_K528____ },
+        { "s76_____.k927____", 17, BENCH_S76______K927____ },
+        { "s54_____.k660____", 17, BENCH_S54______K660____ },
+        { "s42_____.k518____", 17, BENCH_S42______K518____ },
+        { "s54_____.s55_____.k664____", 26, BENCH_S54______S55______K664____ },
+        { "s24_____.s25_____.k306____", 26, BENCH_S24______S25______K306____ },
+        { "k216____", 8, BENCH_K216____ },
+        { "s42_____.s43_____.k524____", 26, BENCH_S42______S43______K524____ },
+        { "k510____", 8, BENCH_K510____ },
+        { "s66_____.k800____", 17, BENCH_S66______K800____ },
+        { "k819____", 8, BENCH_K819____ },
+        { "k319____", 8, BENCH_K319____ },
+        { "k264____", 8, BENCH_K264____ },
+        { "k268____", 8, BENCH_K268____ },
+        { "s44_____.s45_____.k544____", 26, BENCH_S44______S45______K544____ },
+        { "s36_____.k442____", 17, BENCH_S36______K442____ },
+        { "s0______.k14_____", 17, BENCH_S0_______K14_____ },
+        { "k533____", 8, BENCH_K533____ },
+        { "s68_____.s69_____.k836____", 26, BENCH_S68______S69______K836____ },
+        { "s70_____.s71_____.k860____", 26, BENCH_S70______S71______K860____ },
+        { "s56_____.k687____", 17, BENCH_S56______K687____ },
+        { "s48_____.s49_____.k592____", 26, BENCH_S48______S49______K592____ },
+        { "s40_____.k490____", 17, BENCH_S40______K490____ },
+        { "s46_____.s47_____.k571____", 26, BENCH_S46______S47______K571____ },
+        { "s0______.s1______.k20_____", 26, BENCH_S0_______S1_______K20_____ },
+        { "s82_____.k998____", 17, BENCH_S82______K998____ },
+        { "s14_____.s15_____.k188____", 26, BENCH_S14______S15______K188____ },
+        { "s34_____.s35_____.k427____", 26, BENCH_S34______S35______K427____ },
+        { "k919____", 8, BENCH_K919____ },
+        { "k675____", 8, BENCH_K675____ },
+        { "s4______.k57_____", 17, BENCH_S4_______K57_____ },
+        { "s76_____.s77_____.k929____", 26, BENCH_S76______S77______K929____ },
+        { "s12_____.k157____", 17, BENCH_S12______K157____ },
+        { "s38_____.k466____", 17, BENCH_S38______K466____ },
+        { "s30_____.k369____", 17, BENCH_S30______K369____ },
+        { "s80_____.k974____", 17, BENCH_S80______K974____ },
+        { "s0______.k9______", 17, BENCH_S0_______K9______ },
+        { "s78_____.k944____", 17, BENCH_S78______K944____ },
+        { "s70_____.k854____", 17, BENCH_S70______K854____ },
+        { "s4______.k56_____", 17, BENCH_S4_______K56_____ },
+        { "s62_____.s63_____.k763____", 26, BENCH_S62______S63______K763____ },
+        { "s64_____.k779____", 17, BENCH_S64______K779____ },
+        { "s50_____.s51_____.k616____", 26, BENCH_S50______S51______K616____ },
+        { "k314____", 8, BENCH_K314____ },
+        { "s46_____.s47_____.k572____", 26, BENCH_S46______S47______K572____ },
+        { "s4______.s5______.k69_____", 26, BENCH_S4_______S5_______K69_____ },
+        { "s58_____.k708____", 17, BENCH_S58______K708____ },
+        { "s8______.s9______.k118____", 26, BENCH_S8_______S9_______K118____ },
+        { "k915____", 8, BENCH_K915____ },
+        { "s16_____.s17_____.k215____", 26, BENCH_S16______S17______K215____ },
+        { "k411____", 8, BENCH_K411____ },
+        { "s52_____.s53_____.k640____", 26, BENCH_S52______S53______K640____ },
+        { "s32_____.s33_____.k400____", 26, BENCH_S32______S33______K400____ },
+        { "k410____", 8, BENCH_K410____ },
+        { "k413____", 8, BENCH_K413____ },
+        { "s82_____.k994____", 17, BENCH_S82______K994____ },
+        { "s20_____.s21_____.k257____", 26, BENCH_S20______S21______K257____ },
+        { "s6______.s7______.k93_____", 26, BENCH_S6_______S7_______K93_____ },
+        { "s2______.k36_____", 17, BENCH_S2_______K36_____ },
+        { "s66_____.k807____", 17, BENCH_S66______K807____ },
+        { "s26_____.k322____", 17, BENCH_S26______K322____ },
+        { "s62_____.s63_____.k766____", 26, BENCH_S62______S63______K766____ },
+        { "s6______.s7______.k91_____", 26, BENCH_S6_______S7_______K91_____ },
+        { "s0______.k15_____", 17, BENCH_S0_______K15_____ },
+        { "s46_____.s47_____.k568____", 26, BENCH_S46______S47______K568____ },
+        { "s52_____.k636____", 17, BENCH_S52______K636____ },
+        { "s76_____.s77_____.k932____", 26, BENCH_S76______S77______K932____ },
+        { "k792____", 8, BENCH_K792____ },
+        { "k558____", 8, BENCH_K558____ },
+        { "s18_____.s19_____.k238____", 26, BENCH_S18______S19______K238____ },
+        { "s38_____.s39_____.k476____", 26, BENCH_S38______S39______K476____ },
+        { "s68_____.k829____", 17, BENCH_S68______K829____ },
+        { "s18_____.s19_____.k239____", 26, BENCH_S18______S19______K239____ },
+        { "s26_____.k325____", 17, BENCH_S26______K325____ },
+        { "s12_____.k159____", 17, BENCH_S12______K159____ },
+        { "k870____", 8, BENCH_K870____ },
+        { "s32_____.k396____", 17, BENCH_S32______K396____ },
+        { "s78_____.k946____", 17, BENCH_S78______K946____ },
+        { "k869____", 8, BENCH_K869____ },
+        { "k6______", 8, BENCH_K6______ },
+        { "k222____", 8, BENCH_K222____ },
+        { "s26_____.s27_____.k333____", 26, BENCH_S26______S27______K333____ },
+        { "k1______", 8, BENCH_K1______ },
+        { "s42_____.k514____", 17, BENCH_S42______K514____ },
+        { "s4______.k59_____", 17, BENCH_S4_______K59_____ },
+        { "k939____", 8, BENCH_K939____ },
+        { "s22_____.s23_____.k286____", 26, BENCH_S22______S23______K286____ },
+        { "s6______.k80_____", 17, BENCH_S6_______K80_____ },
+        { "k26_____", 8, BENCH_K26_____ },
+        { "s48_____.s49_____.k594____", 26, BENCH_S48______S49______K594____ },
+        { "s80_____.s81_____.k979____", 26, BENCH_S80______S81______K979____ },
+        { "s12_____.k155____", 17, BENCH_S12______K155____ },
+        { "s16_____.s17_____.k208____", 26, BENCH_S16______S17______K208____ },
+        { "s22_____.k272____", 17, BENCH_S22______K272____ },
+        { "s20_____.k254____", 17, BENCH_S20______K254____ },
+        { "s72_____.k874____", 17, BENCH_S72______K874____ },
+        { "s60_____.k734____", 17, BENCH_S60______K734____ },
+        { "s60_____.k730____", 17, BENCH_S60______K730____ },
+        { "s68_____.s69_____.k833____", 26, BENCH_S68______S69______K833____ },
+        { "s12_____.s13_____.k162____", 26, BENCH_S12______S13______K162____ },
+        { "s60_____.s61_____.k737____", 26, BENCH_S60______S61______K737____ },
+        { "k556____", 8, BENCH_K556____ },
+        { "k674____", 8, BENCH_K674____ },
+        { "s74_____.k902____", 17, BENCH_S74______K902____ },
+        { "s46_____.s47_____.k575____", 26, BENCH_S46______S47______K575____ },
+        { "k295____", 8, BENCH_K295____ },
+        { "s44_____.k543____", 17, BENCH_S44______K543____ },
+        { "k583____", 8, BENCH_K583____ },
+        { "s48_____.k586____", 17, BENCH_S48______K586____ },
+        { "s20_____.k248____", 17, BENCH_S20______K248____ },
+        { "s12_____.s13_____.k165____", 26, BENCH_S12______S13______K165____ },
+        { "k820____", 8, BENCH_K820____ },
+        { "s76_____.k925____", 17, BENCH_S76______K925____ },
+        { "s16_____.k201____", 17, BENCH_S16______K201____ },
+        { "s36_____.k443____", 17, BENCH_S36______K443____ },
+        { "k0______", 8, BENCH_K0______ },
+        { "k127____", 8, BENCH_K127____ },
+        { "s52_____.s53_____.k645____", 26, BENCH_S52______S53______K645____ },
+        { "s48_____.k585____", 17, BENCH_S48______K585____ },
+        { "k269____", 8, BENCH_K269____ },
+        { "k508____", 8, BENCH_K508____ },
+        { "k676____", 8, BENCH_K676____ },
+        { "k365____", 8, BENCH_K365____ },
+        { "k337____", 8, BENCH_K337____ },
+        { "s74_____.s75_____.k905____", 26, BENCH_S74______S75______K905____ },
+        { "s0______.s1______.k23_____", 26, BENCH_S0_______S1_______K23_____ },
+        { "k582____", 8, BENCH_K582____ },
+        { "s0______.s1______.k19_____", 26, BENCH_S0_______S1_______K19_____ },
+        { "s8______.s9______.k112____", 26, BENCH_S8_______S9_______K112____ },
+        { "s74_____.s75_____.k907____", 26, BENCH_S74______S75______K907____ },
+        { "k360____", 8, BENCH_K360____ },
+        { "s16_____.k203____", 17, BENCH_S16______K203____ },
+        { "s60_____.k731____", 17, BENCH_S60______K731____ },
+        { "k28_____", 8, BENCH_K28_____ },
+        { "s50_____.k611____", 17, BENCH_S50______K611____ },
+        { "k648____", 8, BENCH_K648____ },
+        { "k3______", 8, BENCH_K3______ },
+        { "k5______", 8, BENCH_K5______ },
+        { "k120____", 8, BENCH_K120____ },
+        { "s66_____.k805____", 17, BENCH_S66______K805____ },
+        { "s20_____.k252____", 17, BENCH_S20______K252____ },
+        { "s2______.s3______.k40_____", 26, BENCH_S2_______S3_______K40_____ },
+        { "k650____", 8, BENCH_K650____ },
+        { "s20_____.k253____", 17, BENCH_S20______K253____ },
+        { "k126____", 8, BENCH_K126____ },
+        { "s72_____.s73_____.k884____", 26, BENCH_S72______S73______K884____ },
+        { "s34_____.s35_____.k424____", 26, BENCH_S34______S35______K424____ },
+        { "s42_____.s43_____.k521____", 26, BENCH_S42______S43______K521____ },
+        { "k987____", 8, BENCH_K987____ },
+        { "k387____", 8, BENCH_K387____ },
+        { "s10_____.k128____", 17, BENCH_S10______K128____ },
+        { "s28_____.k344____", 17, BENCH_S28______K344____ },
+        { "k843____", 8, BENCH_K843____ },
+        { "s42_____.s43_____.k526____", 26, BENCH_S42______S43______K526____ },
+        { "s14_____.s15_____.k184____", 26, BENCH_S14______S15______K184____ },
+        { "k770____", 8, BENCH_K770____ },
+        { "s78_____.k949____", 17, BENCH_S78______K949____ },
+        { "k2______", 8, BENCH_K2______ },
+        { "s64_____.s65_____.k784____", 26, BENCH_S64______S65______K784____ },
+        { "s62_____.k756____", 17, BENCH_S62______K756____ },
+        { "s0______.k13_____", 17, BENCH_S0_______K13_____ },
+        { "s38_____.s39_____.k479____", 26, BENCH_S38______S39______K479____ },
+        { "s42_____.k513____", 17, BENCH_S42______K513____ },
+        { "s40_____.s41_____.k497____", 26, BENCH_S40______S41______K497____ },
+        { "s36_____.s37_____.k448____", 26, BENCH_S36______S37______K448____ },
+        { "k218____", 8, BENCH_K218____ },
+        { "k868____", 8, BENCH_K868____ },
+        { "s56_____.s57_____.k695____", 26, BENCH_S56______S57______K695____ },
+        { "k339____", 8, BENCH_K339____ },
+        { "k989____", 8, BENCH_K989____ },
+        { "k432____", 8, BENCH_K432____ },
+        { "s58_____.s59_____.k716____", 26, BENCH_S58______S59______K716____ },
+        { "s58_____.k709____", 17, BENCH_S58______K709____ },
+        { "s66_____.k806____", 17, BENCH_S66______K806____ },
+        { "s24_____.k303____", 17, BENCH_S24______K303____ },
+        { "k507____", 8, BENCH_K507____ },
+        { "s40_____.s41_____.k501____", 26, BENCH_S40______S41______K501____ },
+        { "s78_____.k945____", 17, BENCH_S78______K945____ },
+        { "s66_____.s67_____.k815____", 26, BENCH_S66______S67______K815____ },
+        { "s10_____.k134____", 17, BENCH_S10______K134____ },
+        { "s18_____.k229____", 17, BENCH_S18______K229____ },
+        { "s44_____.s45_____.k550____", 26, BENCH_S44______S45______K550____ },
+        { "k532____", 8, BENCH_K532____ },
+        { "s60_____.k729____", 17, BENCH_S60______K729____ },
+        { "s70_____.k850____", 17, BENCH_S70______K850____ },
+        { "k529____", 8, BENCH_K529____ },
+        { "s58_____.s59_____.k717____", 26, BENCH_S58______S59______K717____ },
+        { "s40_____.s41_____.k496____", 26, BENCH_S40______S41______K496____ },
+        { "s76_____.k921____", 17, BENCH_S76______K921____ },
+        { "s42_____.s43_____.k520____", 26, BENCH_S42______S43______K520____ },
+        { "s60_____.s61_____.k738____", 26, BENCH_S60______S61______K738____ },
+        { "s50_____.k608____", 17, BENCH_S50______K608____ },
+        { "s68_____.s69_____.k838____", 26, BENCH_S68______S69______K838____ },
+        { "s40_____.k492____", 17, BENCH_S40______K492____ },
+        { "s4______.s5______.k64_____", 26, BENCH_S4_______S5_______K64_____ },
+        { "s54_____.k657____", 17, BENCH_S54______K657____ },
+        { "s32_____.k395____", 17, BENCH_S32______K395____ },
+        { "s2______.k33_____", 17, BENCH_S2_______K33_____ },
+        { "k720____", 8, BENCH_K720____ },
+        { "k414____", 8, BENCH_K414____ },
+        { "k316____", 8, BENCH_K316____ },
+        { "s32_____.s33_____.k406____", 26, BENCH_S32______S33______K406____ },
+        { "k530____", 8, BENCH_K530____ },
+        { "s42_____.k519____", 17, BENCH_S42______K519____ },
+        { "s58_____.s59_____.k719____", 26, BENCH_S58______S59______K719____ },
+        { "s22_____.s23_____.k283____", 26, BENCH_S22______S23______K283____ },
+        { "s44_____.s45_____.k549____", 26, BENCH_S44______S45______K549____ },
+        { "k483____", 8, BENCH_K483____ },
+        { "k312____", 8, BENCH_K312____ },
+        { "s18_____.s19_____.k234____", 26, BENCH_S18______S19______K234____ },
+        { "s60_____.k728____", 17, BENCH_S60______K728____ },
+        { "s74_____.s75_____.k909____", 26, BENCH_S74______S75______K909____ },
+        { "s14_____.k177____", 17, BENCH_S14______K177____ },
+        { "s64_____.k776____", 17, BENCH_S64______K776____ },
+        { "s6______.k83_____", 17, BENCH_S6_______K83_____ },
+        { "s40_____.s41_____.k498____", 26, BENCH_S40______S41______K498____ },
+        { "s68_____.k831____", 17, BENCH_S68______K831____ },
+        { "s10_____.k132____", 17, BENCH_S10______K132____ },
+        { "s44_____.s45_____.k547____", 26, BENCH_S44______S45______K547____ },
+        { "k722____", 8, BENCH_K722____ },
+        { "s76_____.s77_____.k935____", 26, BENCH_S76______S77______K935____ },
+        { "k198____", 8, BENCH_K198____ },
+        { "s14_____.k181____", 17, BENCH_S14______K181____ },
+        { "s44_____.k539____", 17, BENCH_S44______K539____ },
+        { "s6______.k86_____", 17, BENCH_S6_______K86_____ },
+        { "s18_____.k230____", 17, BENCH_S18______K230____ },
+        { "s66_____.k801____", 17, BENCH_S66______K801____ },
+        { "s76_____.s77_____.k931____", 26, BENCH_S76______S77______K931____ },
+        { "k816____", 8, BENCH_K816____ },
+        { "s18_____.s19_____.k233____", 26, BENCH_S18______S19______K233____ },
+        { "s4______.s5______.k67_____", 26, BENCH_S4_______S5_______K67_____ },
+        { "k892____", 8, BENCH_K892____ },
+        { "s70_____.k848____", 17, BENCH_S70______K848____ },
+        { "s74_____.s75_____.k908____", 26, BENCH_S74______S75______K908____ },
+        { "k627____", 8, BENCH_K627____ },
+        { "k481____", 8, BENCH_K481____ },
+        { "k147____", 8, BENCH_K147____ },
+        { "k172____", 8, BENCH_K172____ },
+        { "s30_____.s31_____.k380____", 26, BENCH_S30______S31______K380____ },
+        { "k793____", 8, BENCH_K793____ },
+        { "s22_____.k277____", 17, BENCH_S22______K277____ },
+        { "k961____", 8, BENCH_K961____ },
+        { "s20_____.k255____", 17, BENCH_S20______K255____ },
+        { "k576____", 8, BENCH_K576____ },
+        { "s62_____.k758____", 17, BENCH_S62______K758____ },
+        { "s4______.k63_____", 17, BENCH_S4_______K63_____ },
+        { "s32_____.s33_____.k404____", 26, BENCH_S32______S33______K404____ },
+        { "s48_____.s49_____.k597____", 26, BENCH_S48______S49______K597____ },
+        { "s80_____.k970____", 17, BENCH_S80______K970____ },
+        { "k847____", 8, BENCH_K847____ },
+        { "s72_____.s73_____.k883____", 26, BENCH_S72______S73______K883____ },
+        { "s66_____.s67_____.k813____", 26, BENCH_S66______S67______K813____ },
+        { "s66_____.s67_____.k814____", 26, BENCH_S66______S67______K814____ },
+        { "k409____", 8, BENCH_K409____ },
+        { "s32_____.k397____", 17, BENCH_S32______K397____ },
+        { "s24_____.k298____", 17, BENCH_S24______K298____ },
+        { "s28_____.s29_____.k358____", 26, BENCH_S28______S29______K358____ },
+        { "s4______.s5______.k68_____", 26, BENCH_S4_______S5_______K68_____ },
+        { "k220____", 8, BENCH_K220____ },
+        { "s44_____.s45_____.k545____", 26, BENCH_S44______S45______K545____ },
+        { "s24_____.s25_____.k305____", 26, BENCH_S24______S25______K305____ },
+        { "k772____", 8, BENCH_K772____ },
+        { "s70_____.k852____", 17, BENCH_S70______K852____ },
+        { "k747____", 8, BENCH_K747____ },
+        { "s64_____.s65_____.k791____", 26, BENCH_S64______S65______K791____ },
+        { "s52_____.k634____", 17, BENCH_S52______K634____ },
+        { "s36_____.s37_____.k453____", 26, BENCH_S36______S37______K453____ },
+        { "s26_____.s27_____.k331____", 26, BENCH_S26______S27______K331____ },
+        { "s22_____.s23_____.k280____", 26, BENCH_S22______S23______K280____ },
+        { "s70_____.k849____", 17, BENCH_S70______K849____ },
+        { "s2______.s3______.k43_____", 26, BENCH_S2_______S3_______K43_____ },
+        { "k54_____", 8, BENCH_K54_____ },
+        { "s72_____.s73_____.k881____", 26, BENCH_S72______S73______K881____ },
+        { "k366____", 8, BENCH_K366____ },
+        { "s46_____.s47_____.k574____", 26, BENCH_S46______S47______K574____ },
+        { "s82_____.k993____", 17, BENCH_S82______K993____ },
+        { "s22_____.s23_____.k285____", 26, BENCH_S22______S23______K285____ },
+        { "k893____", 8, BENCH_K893____ },
+        { "s36_____.s37_____.k452____", 26, BENCH_S36______S37______K452____ },
+        { "s58_____.k710____", 17, BENCH_S58______K710____ },
+        { "s64_____.s65_____.k788____", 26, BENCH_S64______S65______K788____ },
+        { "s62_____.s63_____.k760____", 26, BENCH_S62______S63______K760____ },
+        { "s36_____.k444____", 17, BENCH_S36______K444____ },
+        { "s52_____.s53_____.k647____", 26, BENCH_S52______S53______K647____ },
+        { "s78_____.s79_____.k953____", 26, BENCH_S78______S79______K953____ },
+        { "k965____", 8, BENCH_K965____ },
+        { "k293____", 8, BENCH_K293____ },
+        { "s58_____.s59_____.k713____", 26, BENCH_S58______S59______K713____ },
+        { "s78_____.s79_____.k958____", 26, BENCH_S78______S79______K958____ },
+        { "s14_____.k180____", 17, BENCH_S14______K180____ },
+        { "s36_____.s37_____.k455____", 26, BENCH_S36______S37______K455____ },
+        { "k343____", 8, BENCH_K343____ },
+        { "k871____", 8, BENCH_K871____ },
+        { "s46_____.k566____", 17, BENCH_S46______K566____ },
+        { "s10_____.s11_____.k136____", 26, BENCH_S10______S11______K136____ },
+        { "s74_____.k899____", 17, BENCH_S74______K899____ },
+        { "s30_____.s31_____.k381____", 26, BENCH_S30______S31______K381____ },
+        { "s2______.k38_____", 17, BENCH_S2_______K38_____ },
+        { "s24_____.s25_____.k308____", 26, BENCH_S24______S25______K308____ },
+        { "k914____", 8, BENCH_K914____ },
+        { "k77_____", 8, BENCH_K77_____ },
+        { "s52_____.k639____", 17, BENCH_S52______K639____ },
+        { "k174____", 8, BENCH_K174____ },
+        { "s74_____.k900____", 17, BENCH_S74______K900____ },
+        { "k554____", 8, BENCH_K554____ },
+        { "s42_____.s43_____.k527____", 26, BENCH_S42______S43______K527____ },
+        { "s64_____.s65_____.k790____", 26, BENCH_S64______S65______K790____ },
+        { "s16_____.k202____", 17, BENCH_S16______K202____ },
+        { "k701____", 8, BENCH_K701____ },
+        { "s70_____.s71_____.k863____", 26, BENCH_S70______S71______K863____ },
+        { "s50_____.s51_____.k621____", 26, BENCH_S50______S51______K621____ },
+        { "k578____", 8, BENCH_K578____ },
+        { "s2______.k35_____", 17, BENCH_S2_______K35_____ },
+        { "k626____", 8, BENCH_K626____ },
+        { "s50_____.k613____", 17, BENCH_S50______K613____ },
+        { "k677____", 8, BENCH_K677____ },
+        { "k673____", 8, BENCH_K673____ },
+        { "s34_____.s35_____.k431____", 26, BENCH_S34______S35______K431____ },
+        { "s78_____.s79_____.k959____", 26, BENCH_S78______S79______K959____ },
+        { "k102____", 8, BENCH_K102____ },
+        { "k964____", 8, BENCH_K964____ },
+        { "s80_____.k969____", 17, BENCH_S80______K969____ },
+        { "k775____", 8, BENCH_K775____ },
+        { "k149____", 8, BENCH_K149____ },
+        { "s46_____.k563____", 17, BENCH_S46______K563____ },
+        { "s40_____.k494____", 17, BENCH_S40______K494____ },
+        { "k654____", 8, BENCH_K654____ },
+        { "k773____", 8, BENCH_K773____ },
+        { "k51_____", 8, BENCH_K51_____ },
+        { "k823____", 8, BENCH_K823____ },
+        { "s14_____.s15_____.k189____", 26, BENCH_S14______S15______K189____ },
+        { "s40_____.s41_____.k502____", 26, BENCH_S40______S41______K502____ },
+        { "k246____", 8, BENCH_K246____ },
+        { "k822____", 8, BENCH_K822____ },
+        { "s78_____.s79_____.k957____", 26, BENCH_S78______S79______K957____ },
+        { "s32_____.s33_____.k401____", 26, BENCH_S32______S33______K401____ },
+        { "s40_____.k495____", 17, BENCH_S40______K495____ },
+        { "s72_____.s73_____.k887____", 26, BENCH_S72______S73______K887____ },
+        { "s20_____.k251____", 17, BENCH_S20______K251____ },
+        { "k362____", 8, BENCH_K362____ },
+        { "s70_____.k855____", 17, BENCH_S70______K855____ },
+        { "s24_____.k297____", 17, BENCH_S24______K297____ },
+        { "s22_____.k273____", 17, BENCH_S22______K273____ },
+        { "s20_____.s21_____.k259____", 26, BENCH_S20______S21______K259____ },
+        { "k487____", 8, BENCH_K487____ },
+        { "s28_____.s29_____.k354____", 26, BENCH_S28______S29______K354____ },
+        { "k267____", 8, BENCH_K267____ },
+        { "k223____", 8, BENCH_K223____ },
+        { "s46_____.k561____", 17, BENCH_S46______K561____ },
+        { "k895____", 8, BENCH_K895____ },
+        { "k891____", 8, BENCH_K891____ },
+        { "k79_____", 8, BENCH_K79_____ },
+        { "s44_____.k538____", 17, BENCH_S44______K538____ },
+        { "k221____", 8, BENCH_K221____ },
+        { "s68_____.s69_____.k835____", 26, BENCH_S68______S69______K835____ },
+        { "k99_____", 8, BENCH_K99_____ },
+        { "s80_____.k972____", 17, BENCH_S80______K972____ },
+        { "s2______.s3______.k47_____", 26, BENCH_S2_______S3_______K47_____ },
+        { "s8______.s9______.k115____", 26, BENCH_S8_______S9_______K115____ },
+        { "s68_____.s69_____.k834____", 26, BENCH_S68______S69______K834____ },
+        { "s36_____.s37_____.k450____", 26, BENCH_S36______S37______K450____ },
+        { "s34_____.s35_____.k425____", 26, BENCH_S34______S35______K425____ },
+        { "s64_____.k781____", 17, BENCH_S64______K781____ },
+        { "s50_____.k610____", 17, BENCH_S50______K610____ },
+        { "k336____", 8, BENCH_K336____ },
+        { "s22_____.s23_____.k287____", 26, BENCH_S22______S23______K287____ },
+        { "k535____", 8, BENCH_K535____ },
+        { "s22_____.k276____", 17, BENCH_S22______K276____ },
+        { "k552____", 8, BENCH_K552____ },
+        { "s72_____.s73_____.k880____", 26, BENCH_S72______S73______K880____ },
+        { "k726____", 8, BENCH_K726____ },
+        { "s24_____.s25_____.k309____", 26, BENCH_S24______S25______K309____ },
+        { "k436____", 8, BENCH_K436____ },
+        { "k794____", 8, BENCH_K794____ },
+        { "s28_____.k349____", 17, BENCH_S28______K349____ },
+        { "s40_____.s41_____.k503____", 26, BENCH_S40______S41______K503____ },
+        { "s34_____.k419____", 17, BENCH_S34______K419____ },
+        { "k144____", 8, BENCH_K144____ },
+        { "k918____", 8, BENCH_K918____ },
+        { "s48_____.k588____", 17, BENCH_S48______K588____ },
+        { "s8______.s9______.k117____", 26, BENCH_S8_______S9_______K117____ },
+        { "k124____", 8, BENCH_K124____ },
+        { "s34_____.k420____", 17, BENCH_S34______K420____ },
+        { "s46_____.s47_____.k570____", 26, BENCH_S46______S47______K570____ },
+        { "s52_____.s53_____.k644____", 26, BENCH_S52______S53______K644____ },
+        { "s54_____.s55_____.k668____", 26, BENCH_S54______S55______K668____ },
+        { "s28_____.k347____", 17, BENCH_S28______K347____ },
+        { "s32_____.k392____", 17, BENCH_S32______K392____ },
+        { "s46_____.s47_____.k569____", 26, BENCH_S46______S47______K569____ },
+        { "s62_____.k759____", 17, BENCH_S62______K759____ },
+        { "s14_____.k178____", 17, BENCH_S14______K178____ },
+        { "s30_____.s31_____.k377____", 26, BENCH_S30______S31______K377____ },
+        { "k913____", 8, BENCH_K913____ },
+        { "s66_____.s67_____.k810____", 26, BENCH_S66______S67______K810____ },
+        { "k50_____", 8, BENCH_K50_____ },
+        { "k867____", 8, BENCH_K867____ },
+        { "s48_____.k591____", 17, BENCH_S48______K591____ },
+        { "s64_____.s65_____.k787____", 26, BENCH_S64______S65______K787____ },
+        { "k145____", 8, BENCH_K145____ },
+        { "s52_____.s53_____.k643____", 26, BENCH_S52______S53______K643____ },
+        { "k438____", 8, BENCH_K438____ },
+        { "s56_____.k683____", 17, BENCH_S56______K683____ },
+        { "s40_____.s41_____.k500____", 26, BENCH_S40______S41______K500____ },
+        { "k290____", 8, BENCH_K290____ },
+        { "s32_____.k394____", 17, BENCH_S32______K394____ },
+        { "s54_____.s55_____.k670____", 26, BENCH_S54______S55______K670____ },
+        { "k31_____", 8, BENCH_K31_____ },
+        { "s26_____.k324____", 17, BENCH_S26______K324____ },
+        { "k555____", 8, BENCH_K555____ },
+        { "s6______.k81_____", 17, BENCH_S6_______K81_____ },
+        { "s38_____.k468____", 17, BENCH_S38______K468____ },
+        { "s18_____.k225____", 17, BENCH_S18______K225____ },
+        { "k702____", 8, BENCH_K702____ },
+        { "k581____", 8, BENCH_K581____ },
+        { "k534____", 8, BENCH_K534____ },
+        { "s20_____.k249____", 17, BENCH_S20______K249____ },
+        { "s18_____.k226____", 17, BENCH_S18______K226____ },
+        { "s32_____.k399____", 17, BENCH_S32______K399____ },
+        { "s42_____.s43_____.k523____", 26, BENCH_S42______S43______K523____ },
+        { "k700____", 8, BENCH_K700____ },
+        { "k605____", 8, BENCH_K605____ },
+        { "s36_____.s37_____.k451____", 26, BENCH_S36______S37______K451____ },
+        { "k55_____", 8, BENCH_K55_____ },
+        { "s10_____.s11_____.k139____", 26, BENCH_S10______S11______K139____ },
+        { "s58_____.k707____", 17, BENCH_S58______K707____ },
+        { "s34_____.k422____", 17, BENCH_S34______K422____ },
+        { "k655____", 8, BENCH_K655____ },
+        { "s38_____.k467____", 17, BENCH_S38______K467____ },
+        { "k150____", 8, BENCH_K150____ },
+        { "k894____", 8, BENCH_K894____ },
+        { "s22_____.s23_____.k281____", 26, BENCH_S22______S23______K281____ },
+        { "s10_____.k135____", 17, BENCH_S10______K135____ },
+        { "s24_____.k296____", 17, BENCH_S24______K296____ },
+        { "s66_____.s67_____.k808____", 26, BENCH_S66______S67______K808____ },
+        { "s40_____.s41_____.k499____", 26, BENCH_S40______S41______K499____ },
+        { "k168____", 8, BENCH_K168____ },
+        { "s78_____.k948____", 17, BENCH_S78______K948____ },
+        { "k963____", 8, BENCH_K963____ },
+        { "s20_____.s21_____.k258____", 26, BENCH_S20______S21______K258____ },
+        { "s6______.k82_____", 17, BENCH_S6_______K82_____ },
+        { "k602____", 8, BENCH_K602____ },
+        { "k169____", 8, BENCH_K169____ },
+        { "s82_____.k996____", 17, BENCH_S82______K996____ },
+        { "s36_____.s37_____.k454____", 26, BENCH_S36______S37______K454____ },
+        { "k937____", 8, BENCH_K937____ },
+        { "s0______.k8______", 17, BENCH_S0_______K8______ },
+        { "s74_____.s75_____.k906____", 26, BENCH_S74______S75______K906____ },
+        { "k289____", 8, BENCH_K289____ },
+        { "k624____", 8, BENCH_K624____ },
+        { "s32_____.s33_____.k403____", 26, BENCH_S32______S33______K403____ },
+        { "s56_____.s57_____.k688____", 26, BENCH_S56______S57______K688____ },
+        { "s44_____.k537____", 17, BENCH_S44______K537____ },
+        { "s32_____.s33_____.k405____", 26, BENCH_S32______S33______K405____ },
+        { "k175____", 8, BENCH_K175____ },
+        { "s42_____.k516____", 17, BENCH_S42______K516____ },
+        { "s10_____.s11_____.k140____", 26, BENCH_S10______S11______K140____ },
+        { "k27_____", 8, BENCH_K27_____ },
+        { "s54_____.k659____", 17, BENCH_S54______K659____ },
+        { "s70_____.s71_____.k856____", 26, BENCH_S70______S71______K856____ },
+        { "s70_____.s71_____.k859____", 26, BENCH_S70______S71______K859____ },
+        { "s50_____.k614____", 17, BENCH_S50______K614____ },
+        { "k727____", 8, BENCH_K727____ },
+        { "s12_____.s13_____.k166____", 26, BENCH_S12______S13______K166____ },
+        { "s78_____.s79_____.k952____", 26, BENCH_S78______S79______K952____ },
+        { "k389____", 8, BENCH_K389____ },
+        { "s34_____.k416____", 17, BENCH_S34______K416____ },
+        { "k697____", 8, BENCH_K697____ },
+        { "k76_____", 8, BENCH_K76_____ },
+        { "s52_____.k633____", 17, BENCH_S52______K633____ },
+        { "s68_____.s69_____.k832____", 26, BENCH_S68______S69______K832____ },
+        { "s6______.s7______.k94_____", 26, BENCH_S6_______S7_______K94_____ },
+        { "s30_____.k372____", 17, BENCH_S30______K372____ },
+        { "s32_____.s33_____.k402____", 26, BENCH_S32______S33______K402____ },
+        { "s16_____.k204____", 17, BENCH_S16______K204____ },
+        { "k651____", 8, BENCH_K651____ },
+        { "s48_____.k589____", 17, BENCH_S48______K589____ },
+        { "k844____", 8, BENCH_K844____ },
+        { "s18_____.k224____", 17, BENCH_S18______K224____ },
+        { "s38_____.s39_____.k477____", 26, BENCH_S38______S39______K477____ },
+        { "s38_____.s39_____.k474____", 26, BENCH_S38______S39______K474____ },
+        { "s32_____.k393____", 17, BENCH_S32______K393____ },
+        { "s82_____.k999____", 17, BENCH_S82______K999____ },
+        { "k649____", 8, BENCH_K649____ },
+        { "s10_____.s11_____.k138____", 26, BENCH_S10______S11______K138____ },
+        { "s74_____.k897____", 17, BENCH_S74______K897____ },
+        { "s22_____.s23_____.k284____", 26, BENCH_S22______S23______K284____ },
+        { "k966____", 8, BENCH_K966____ },
+        { "k818____", 8, BENCH_K818____ },
+        { "k991____", 8, BENCH_K991____ },
+        { "s50_____.s51_____.k619____", 26, BENCH_S50______S51______K619____ },
+        { "k171____", 8, BENCH_K171____ },
+        { "k412____", 8, BENCH_K412____ },
+        { "s38_____.s39_____.k475____", 26, BENCH_S38______S39______K475____ },
+        { "s66_____.k804____", 17, BENCH_S66______K804____ },
+        { "k744____", 8, BENCH_K744____ },
+        { "k72_____", 8, BENCH_K72_____ },
+        { "s8______.k111____", 17, BENCH_S8_______K111____ },
+        { "k938____", 8, BENCH_K938____ },
+        { "s78_____.s79_____.k956____", 26, BENCH_S78______S79______K956____ },
+        { "s80_____.s81_____.k981____", 26, BENCH_S80______S81______K981____ },
+        { "k315____", 8, BENCH_K315____ },
+        { "k217____", 8, BENCH_K217____ },
+        { "k484____", 8, BENCH_K484____ },
+        { "k817____", 8, BENCH_K817____ },
+        { "s68_____.s69_____.k837____", 26, BENCH_S68______S69______K837____ },
+        { "k391____", 8, BENCH_K391____ },
+        { "k768____", 8, BENCH_K768____ },
+        { "s6______.s7______.k95_____", 26, BENCH_S6_______S7_______K95_____ },
+        { "s2______.k39_____", 17, BENCH_S2_______K39_____ },
+        { "s74_____.k898____", 17, BENCH_S74______K898____ },
+        { "k625____", 8, BENCH_K625____ },
+        { "s76_____.s77_____.k934____", 26, BENCH_S76______S77______K934____ },
+        { "k265____", 8, BENCH_K265____ },
+        { "k460____", 8, BENCH_K460____ },
+        { "s72_____.k879____", 17, BENCH_S72______K879____ },
+        { "s34_____.k417____", 17, BENCH_S34______K417____ },
+        { "s6______.k87_____", 17, BENCH_S6_______K87_____ },
+        { "s56_____.s57_____.k694____", 26, BENCH_S56______S57______K694____ },
+        { "s64_____.k783____", 17, BENCH_S64______K783____ },
+        { "k270____", 8, BENCH_K270____ },
+        { "s2______.s3______.k44_____", 26, BENCH_S2_______S3_______K44_____ },
+        { "s10_____.k133____", 17, BENCH_S10______K133____ },
+        { "s52_____.k632____", 17, BENCH_S52______K632____ },
+        { "k363____", 8, BENCH_K363____ },
+        { "s12_____.k158____", 17, BENCH_S12______K158____ },
+        { "s64_____.k782____", 17, BENCH_S64______K782____ },
+        { "k384____", 8, BENCH_K384____ },
+        { "s78_____.s79_____.k954____", 26, BENCH_S78______S79______K954____ },
+        { "s26_____.k326____", 17, BENCH_S26______K326____ },
+        { "s32_____.k398____", 17, BENCH_S32______K398____ },
+        { "s38_____.k471____", 17, BENCH_S38______K471____ },
+        { "s56_____.k686____", 17, BENCH_S56______K686____ },
+        { "s82_____.k995____", 17, BENCH_S82______K995____ },
+        { "s70_____.s71_____.k862____", 26, BENCH_S70______S71______K862____ },
+        { "s40_____.k488____", 17, BENCH_S40______K488____ },
+        { "s38_____.k464____", 17, BENCH_S38______K464____ },
+        { "s6______.k84_____", 17, BENCH_S6_______K84_____ },
+        { "s0______.s1______.k18_____", 26, BENCH_S0_______S1_______K18_____ },
+        { "s24_____.s25_____.k310____", 26, BENCH_S24______S25______K310____ },
+        { "k652____", 8, BENCH_K652____ },
+        { "s22_____.k278____", 17, BENCH_S22______K278____ },
+        { "s76_____.k920____", 17, BENCH_S76______K920____ },
+        { "s20_____.s21_____.k263____", 26, BENCH_S20______S21______K263____ },
+        { "s54_____.s55_____.k671____", 26, BENCH_S54______S55______K671____ },
+        { "k53_____", 8, BENCH_K53_____ },
+        { "k580____", 8, BENCH_K580____ },
+        { "k49_____", 8, BENCH_K49_____ },
+        { "k985____", 8, BENCH_K985____ },
+        { "s58_____.s59_____.k718____", 26, BENCH_S58______S59______K718____ },
+        { "s4______.s5______.k65_____", 26, BENCH_S4_______S5_______K65_____ },
+        { "s4______.k61_____", 17, BENCH_S4_______K61_____ },
+        { "s18_____.k227____", 17, BENCH_S18______K227____ },
+        { "s80_____.s81_____.k977____", 26, BENCH_S80______S81______K977____ },
+        { "s40_____.k493____", 17, BENCH_S40______K493____ },
+        { "s42_____.s43_____.k525____", 26, BENCH_S42______S43______K525____ },
+        { "s44_____.k541____", 17, BENCH_S44______K541____ },
+        { "k294____", 8, BENCH_K294____ },
+        { "s78_____.k950____", 17, BENCH_S78______K950____ },
+        { "k340____", 8, BENCH_K340____ },
+        { "s36_____.k441____", 17, BENCH_S36______K441____ },
+        { "s26_____.s27_____.k329____", 26, BENCH_S26______S27______K329____ },
+        { "k247____", 8, BENCH_K247____ },
+        { "s42_____.s43_____.k522____", 26, BENCH_S42______S43______K522____ },
+        { "s56_____.s57_____.k691____", 26, BENCH_S56______S57______K691____ },
+        { "k386____", 8, BENCH_K386____ },
+        { "s16_____.s17_____.k212____", 26, BENCH_S16______S17______K212____ },
+        { "s4______.k60_____", 17, BENCH_S4_______K60_____ },
+        { "s54_____.s55_____.k665____", 26, BENCH_S54______S55______K665____ },
+        { "s26_____.k320____", 17, BENCH_S26______K320____ },
+        { "s56_____.s57_____.k689____", 26, BENCH_S56______S57______K689____ },
+        { "s62_____.k755____", 17, BENCH_S62______K755____ },
+        { "s60_____.s61_____.k740____", 26, BENCH_S60______S61______K740____ },
+        { "k390____", 8, BENCH_K390____ },
+        { "s76_____.k922____", 17, BENCH_S76______K922____ },
+        { "s56_____.k681____", 17, BENCH_S56______K681____ },
+        { "k940____", 8, BENCH_K940____ },
+        { "k97_____", 8, BENCH_K97_____ },
+        { "k603____", 8, BENCH_K603____ },
+        { "k318____", 8, BENCH_K318____ },
+        { "s38_____.k469____", 17, BENCH_S38______K469____ },
+        { "k607____", 8, BENCH_K607____ },
+        { "k240____", 8, BENCH_K240____ },
+        { "k121____", 8, BENCH_K121____ },
+        { "s26_____.s27_____.k332____", 26, BENCH_S26______S27______K332____ },
+        { "k367____", 8, BENCH_K367____ },
+        { "s28_____.k348____", 17, BENCH_S28______K348____ },
+        { "s54_____.s55_____.k667____", 26, BENCH_S54______S55______K667____ },
+        { "s32_____.s33_____.k407____", 26, BENCH_S32______S33______K407____ },
+        { "s54_____.s55_____.k669____", 26, BENCH_S54______S55______K669____ },
+        { "k271____", 8, BENCH_K271____ },
+        { "s52_____.s53_____.k641____", 26, BENCH_S52______S53______K641____ },
+        { "s62_____.s63_____.k764____", 26, BENCH_S62______S63______K764____ },
+        { "s8______.k108____", 17, BENCH_S8_______K108____ },
+        { "s54_____.k658____", 17, BENCH_S54______K658____ },
+        { "k361____", 8, BENCH_K361____ },
+        { "s50_____.s51_____.k617____", 26, BENCH_S50______S51______K617____ },
+        { "k505____", 8, BENCH_K505____ },
+        { "s72_____.k878____", 17, BENCH_S72______K878____ },
+        { "k151____", 8, BENCH_K151____ },
+        { "k439____", 8, BENCH_K439____ },
+        { "k199____", 8, BENCH_K199____ },
+        { "s24_____.s25_____.k307____", 26, BENCH_S24______S25______K307____ },
+        { "s30_____.s31_____.k379____", 26, BENCH_S30______S31______K379____ },
+        { "s80_____.k973____", 17, BENCH_S80______K973____ },
+        { "s56_____.k680____", 17, BENCH_S56______K680____ },
+        { "k845____", 8, BENCH_K845____ },
+        { "s80_____.k971____", 17, BENCH_S80______K971____ },
+        { "s36_____.k440____", 17, BENCH_S36______K440____ },
+        { "s66_____.k802____", 17, BENCH_S66______K802____ },
+        { "s34_____.k423____", 17, BENCH_S34______K423____ },
+        { "s66_____.s67_____.k812____", 26, BENCH_S66______S67______K812____ },
+        { "s20_____.s21_____.k260____", 26, BENCH_S20______S21______K260____ },
+        { "k986____", 8, BENCH_K986____ },
+        { "s28_____.s29_____.k355____", 26, BENCH_S28______S29______K355____ },
+        { "s46_____.k562____", 17, BENCH_S46______K562____ },
+        { "s30_____.k371____", 17, BENCH_S30______K371____ },
+        { "s10_____.s11_____.k137____", 26, BENCH_S10______S11______K137____ },
+        { "s10_____.k130____", 17, BENCH_S10______K130____ },
+        { "k967____", 8, BENCH_K967____ },
+        { "s10_____.s11_____.k142____", 26, BENCH_S10______S11______K142____ },
+        { "k751____", 8, BENCH_K751____ },
+        { "k100____", 8, BENCH_K100____ },
+        { "s2______.s3______.k46_____", 26, BENCH_S2_______S3_______K46_____ },
+        { "s60_____.s61_____.k739____", 26, BENCH_S60______S61______K739____ },
+        { "s24_____.s25_____.k311____", 26, BENCH_S24______S25______K311____ },
+        { "s70_____.s71_____.k858____", 26, BENCH_S70______S71______K858____ },
+        { "s82_____.k992____", 17, BENCH_S82______K992____ },
+        { "s70_____.k853____", 17, BENCH_S70______K853____ },
+        { "s52_____.k638____", 17, BENCH_S52______K638____ },
+        { "s72_____.k873____", 17, BENCH_S72______K873____ },
+        { "k78_____", 8, BENCH_K78_____ },
+        { "s40_____.k489____", 17, BENCH_S40______K489____ },
+        { "k577____", 8, BENCH_K577____ },
+        { "s74_____.s75_____.k911____", 26, BENCH_S74______S75______K911____ },
+        { "s66_____.s67_____.k811____", 26, BENCH_S66______S67______K811____ },
+        { "s58_____.s59_____.k714____", 26, BENCH_S58______S59______K714____ },
+        { "k504____", 8, BENCH_K504____ },
+        { "s76_____.s77_____.k928____", 26, BENCH_S76______S77______K928____ },
+        { "s6______.s7______.k89_____", 26, BENCH_S6_______S7_______K89_____ },
+        { "s56_____.s57_____.k690____", 26, BENCH_S56______S57______K690____ },
+        { "k193____", 8, BENCH_K193____ },
+        { "s74_____.k903____", 17, BENCH_S74______K903____ },
+        { "s44_____.k542____", 17, BENCH_S44______K542____ },
+        { "s14_____.s15_____.k187____", 26, BENCH_S14______S15______K187____ },
+        { "s22_____.k274____", 17, BENCH_S22______K274____ },
+        { "s4______.k58_____", 17, BENCH_S4_______K58_____ },
+        { "s12_____.s13_____.k164____", 26, BENCH_S12______S13______K164____ },
+        { "s58_____.s59_____.k712____", 26, BENCH_S58______S59______K712____ },
+        { "k148____", 8, BENCH_K148____ },
+        { "s30_____.k370____", 17, BENCH_S30______K370____ },
+        { "k462____", 8, BENCH_K462____ },
+        { "k146____", 8, BENCH_K146____ },
+        { "k30_____", 8, BENCH_K30_____ },
+        { "s24_____.k299____", 17, BENCH_S24______K299____ },
+        { "s36_____.s37_____.k449____", 26, BENCH_S36______S37______K449____ },
+        { "k559____", 8, BENCH_K559____ },
+        { "s48_____.s49_____.k598____", 26, BENCH_S48______S49______K598____ },
+        { "s0______.s1______.k17_____", 26, BENCH_S0_______S1_______K17_____ },
+        { "k628____", 8, BENCH_K628____ },
+        { "s56_____.k685____", 17, BENCH_S56______K685____ },
+        { "s28_____.s29_____.k353____", 26, BENCH_S28______S29______K353____ },
+        { "s68_____.k830____", 17, BENCH_S68______K830____ },
+        { "k463____", 8, BENCH_K463____ },
+        { "s24_____.k301____", 17, BENCH_S24______K301____ },
+        { "s80_____.k968____", 17, BENCH_S80______K968____ },
+        { "s60_____.s61_____.k741____", 26, BENCH_S60______S61______K741____ },
+        { "s64_____.s65_____.k789____", 26, BENCH_S64______S65______K789____ },
+        { "s78_____.k947____", 17, BENCH_S78______K947____ },
+        { "k629____", 8, BENCH_K629____ },
+        { "s16_____.s17_____.k210____", 26, BENCH_S16______S17______K210____ },
+        { "k456____", 8, BENCH_K456____ },
+        { "s30_____.s31_____.k382____", 26, BENCH_S30______S31______K382____ },
+        { "s62_____.k757____", 17, BENCH_S62______K757____ },
+        { "k388____", 8, BENCH_K388____ },
+        { "k96_____", 8, BENCH_K96_____ },
+        { "s8______.s9______.k119____", 26, BENCH_S8_______S9_______K119____ },
+        { "s10_____.k131____", 17, BENCH_S10______K131____ },
+        { "s60_____.k735____", 17, BENCH_S60______K735____ },
+        { "s20_____.k250____", 17, BENCH_S20______K250____ },
+        { "s26_____.s27_____.k335____", 26, BENCH_S26______S27______K335____ },
+        { "s0______.k12_____", 17, BENCH_S0_______K12_____ },
+        { "k796____", 8, BENCH_K796____ },
+        { "k699____", 8, BENCH_K699____ },
+        { "s16_____.s17_____.k209____", 26, BENCH_S16______S17______K209____ },
+        { "k888____", 8, BENCH_K888____ },
+        { "s58_____.k704____", 17, BENCH_S58______K704____ },
+        { "s60_____.s61_____.k743____", 26, BENCH_S60______S61______K743____ },
+        { "s50_____.k609____", 17, BENCH_S50______K609____ },
+        { "s0______.k11_____", 17, BENCH_S0_______K11_____ },
+        { "k25_____", 8, BENCH_K25_____ },
+        { "s46_____.s47_____.k573____", 26, BENCH_S46______S47______K573____ },
+        { "s26_____.s27_____.k330____", 26, BENCH_S26______S27______K330____ },
+        { "k288____", 8, BENCH_K288____ },
+        { "k243____", 8, BENCH_K243____ },
+        { "s28_____.k350____", 17, BENCH_S28______K350____ },
+        { "k313____", 8, BENCH_K313____ },
+        { "s50_____.k615____", 17, BENCH_S50______K615____ },
+        { "s48_____.s49_____.k596____", 26, BENCH_S48______S49______K596____ },
+        { "s8______.k104____", 17, BENCH_S8_______K104____ },
+        { "s48_____.s49_____.k599____", 26, BENCH_S48______S49______K599____ },
+        { "s46_____.k567____", 17, BENCH_S46______K567____ },
+        { "s76_____.k924____", 17, BENCH_S76______K924____ },
+        { "s30_____.k375____", 17, BENCH_S30______K375____ },
+        { "s50_____.s51_____.k620____", 26, BENCH_S50______S51______K620____ },
+        { "s22_____.k275____", 17, BENCH_S22______K275____ },
+        { "s44_____.k536____", 17, BENCH_S44______K536____ },
+        { "s0______.s1______.k22_____", 26, BENCH_S0_______S1_______K22_____ },
+        { "k942____", 8, BENCH_K942____ },
+        { "s72_____.k876____", 17, BENCH_S72______K876____ },
+        { "s54_____.k662____", 17, BENCH_S54______K662____ },
+        { "s30_____.k374____", 17, BENCH_S30______K374____ },
+        { "s2______.k37_____", 17, BENCH_S2_______K37_____ },
+        { "k241____", 8, BENCH_K241____ },
+        { "s38_____.s39_____.k478____", 26, BENCH_S38______S39______K478____ },
+        { "s76_____.k923____", 17, BENCH_S76______K923____ },
+        { "s50_____.s51_____.k622____", 26, BENCH_S50______S51______K622____ },
+        { "s76_____.k926____", 17, BENCH_S76______K926____ },
+        { "k4______", 8, BENCH_K4______ },
+        { "s62_____.k752____", 17, BENCH_S62______K752____ },
+        { "k122____", 8, BENCH_K122____ },
+        { "s14_____.s15_____.k186____", 26, BENCH_S14______S15______K186____ },
+        { "k461____", 8, BENCH_K461____ },
+        { "k917____", 8, BENCH_K917____ },
+        { "k480____", 8, BENCH_K480____ },
+        { "k244____", 8, BENCH_K244____ },
+        { "s52_____.k635____", 17, BENCH_S52______K635____ },
+        { "k482____", 8, BENCH_K482____ },
+        { "k724____", 8, BENCH_K724____ },
+        { "s56_____.s57_____.k693____", 26, BENCH_S56______S57______K693____ },
+        { "s8______.k109____", 17, BENCH_S8_______K109____ },
+        { "s16_____.k205____", 17, BENCH_S16______K205____ },
+        { "s46_____.k564____", 17, BENCH_S46______K564____ },
+        { "k769____", 8, BENCH_K769____ },
+        { "s28_____.s29_____.k359____", 26, BENCH_S28______S29______K359____ },
+        { "s16_____.k207____", 17, BENCH_S16______K207____ },
+        { "s26_____.k323____", 17, BENCH_S26______K323____ },
+        { "k48_____", 8, BENCH_K48_____ },
+        { "k679____", 8, BENCH_K679____ },
+        { "s6______.k85_____", 17, BENCH_S6_______K85_____ },
+        { "s18_____.k231____", 17, BENCH_S18______K231____ },
+        { "k506____", 8, BENCH_K506____ },
+        { "s2______.s3______.k45_____", 26, BENCH_S2_______S3_______K45_____ },
+        { "k962____", 8, BENCH_K962____ },
+        { "s38_____.k470____", 17, BENCH_S38______K470____ },
+        { "k364____", 8, BENCH_K364____ },
+        { "s56_____.k682____", 17, BENCH_S56______K682____ },
+        { "k749____", 8, BENCH_K749____ },
+        { "k723____", 8, BENCH_K723____ },
+        { "k916____", 8, BENCH_K916____ },
+        { "k864____", 8, BENCH_K864____ },
+        { "k846____", 8, BENCH_K846____ },
+        { "s46_____.k565____", 17, BENCH_S46______K565____ },
+        { "s8______.k107____", 17, BENCH_S8_______K107____ },
+        { "s54_____.k656____", 17, BENCH_S54______K656____ },
+        { "s18_____.s19_____.k235____", 26, BENCH_S18______S19______K235____ },
+        { "s62_____.s63_____.k762____", 26, BENCH_S62______S63______K762____ },
+        { "s36_____.k445____", 17, BENCH_S36______K445____ },
+        { "s62_____.s63_____.k761____", 26, BENCH_S62______S63______K761____ },
+        { "s8______.s9______.k114____", 26, BENCH_S8_______S9_______K114____ },
+        { "s50_____.s51_____.k623____", 26, BENCH_S50______S51______K623____ },
+        { "s12_____.s13_____.k167____", 26, BENCH_S12______S13______K167____ },
+        { "s8______.s9______.k116____", 26, BENCH_S8_______S9_______K116____ },
+        { "s14_____.s15_____.k191____", 26, BENCH_S14______S15______K191____ },
+        { "k557____", 8, BENCH_K557____ },
+        { "s10_____.s11_____.k141____", 26, BENCH_S10______S11______K141____ },
+        { "k242____", 8, BENCH_K242____ },
+        { "k678____", 8, BENCH_K678____ },
+        { "s16_____.k206____", 17, BENCH_S16______K206____ },
+        { "s20_____.s21_____.k256____", 26, BENCH_S20______S21______K256____ },
+        { "s12_____.s13_____.k160____", 26, BENCH_S12______S13______K160____ },
+        { "k703____", 8, BENCH_K703____ },
+        { "k984____", 8, BENCH_K984____ },
+        { "s80_____.s81_____.k976____", 26, BENCH_S80______S81______K976____ },
+        { "k600____", 8, BENCH_K600____ },
+        { "s8______.s9______.k113____", 26, BENCH_S8_______S9_______K113____ },
+        { "s46_____.k560____", 17, BENCH_S46______K560____ },
+        { "k889____", 8, BENCH_K889____ },
+        { "s4______.s5______.k70_____", 26, BENCH_S4_______S5_______K70_____ },
+        { "k890____", 8, BENCH_K890____ },
+        { "s24_____.k300____", 17, BENCH_S24______K300____ },
+        { "s68_____.k825____", 17, BENCH_S68______K825____ },
+        { "s42_____.k512____", 17, BENCH_S42______K512____ },
+        { "k941____", 8, BENCH_K941____ },
+        { "k750____", 8, BENCH_K750____ },
+        { "s24_____.k302____", 17, BENCH_S24______K302____ },
+        { "s74_____.s75_____.k904____", 26, BENCH_S74______S75______K904____ },
+        { "s58_____.k705____", 17, BENCH_S58______K705____ },
+        { "s66_____.s67_____.k809____", 26, BENCH_S66______S67______K809____ },
+        { "k458____", 8, BENCH_K458____ },
+        { "s72_____.s73_____.k885____", 26, BENCH_S72______S73______K885____ },
+        { "k509____", 8, BENCH_K509____ },
+        { "k672____", 8, BENCH_K672____ },
+        { "k745____", 8, BENCH_K745____ },
+        { "s12_____.s13_____.k161____", 26, BENCH_S12______S13______K161____ },
+        { "s60_____.s61_____.k736____", 26, BENCH_S60______S61______K736____ },
+};
+static uint32_t
+benchslot(const char *string, size_t length)
+{
+        uint64_t hash = 14695981039346656037ULL;
+        for(size_t i = 0; i < length; i++) hash = (hash ^ (unsigned char)string[i]) * 1099511628211ULL;
+        uint64_t mix = hash ^ (hash >> 33);
+        mix *= 0xff51afd7ed558ccdULL;
+        mix ^= mix >> 33;
+        mix = hash ^ (benchdisplacements[mix % 251] * 0x9e3779b97f4a7c15ULL);
+        mix ^= mix >> 33;
+        mix *= 0xff51afd7ed558ccdULL;
+        mix ^= mix >> 33;
+        return((uint32_t)(mix % 1000));
+}
+static int
+benchprobe(uint32_t slot, const char *string, size_t length)
+{
+        if(benchslots[slot].length == length &&
+           memcmp(benchslots[slot].name, string, length) == 0)
+        {
+                return(benchslots[slot].id);
+        }
+        return(-1);
+}
+int
+benchkeyidn(const char *string, size_t length)
+{
+        return(benchprobe(benchslot(string, length), string, length));
+}
+int
+benchkeyid(char *string)
+{
+        return(benchkeyidn(string, strlen(string)));
+}
+char *
+benchgetbyid(const bench *self, int id)
+{
+        return(*(char * const *)((const char *)self + benchoffsets[id]));
+}
+unsigned int
+benchfindn(const bench *self, const char *string, size_t length, char **value)
+{
+        int id = benchkeyidn(string, length);
+        if(id < 0)
+        {
+                return(0);
+        }
+        *value = benchgetbyid(self, id);
+        return(!0);
+}
+unsigned int
+benchfind(const bench *self, char *string, char **value)
+{
+        return(benchfindn(self, string, strlen(string), value));
+}
+unsigned int
+benchhaskeyn(const bench *self, const char *string, size_t length)
+{
+        (void)self;
+        return(benchkeyidn(string, length) >= 0);
+}
+unsigned int
+benchhaskey(const bench *self, char *string)
+{
+        return(benchhaskeyn(self, string, strlen(string)));
+}
+char *
+benchgetn(const bench *self, const char *string, size_t length)
+{
+        char *value = NULL;
+        benchfindn(self, string, length, &value);
+        return(value);
+}
+char *
+benchget(const bench *self, char *string)
+{
+        return(benchgetn(self, string, strlen(string)));
+}
+int
+benchvisit(const bench *self, bench_visitor visit, void *context)
+{
+        for(int i = 0; i < BENCH_KEY_COUNT; i++)
+        {
+                const bench_descriptor *descriptor = &benchdescriptors[i];
+                int result = visit(descriptor, (const char *)self + descriptor->offset, context);
+                if(result != 0)
+                {
+                        return(result);
+                }
+        }
+        return(0);
+}
+static uint32_t /* First of descriptors [Begin, End) not sorting before String then Next, past Skip bytes of each name. No Next if negative. */
+benchlowerbound(uint32_t begin, uint32_t end, uint32_t skip, const char *string, size_t length, int next)
+{
+        while(begin < end)
+        {
+                uint32_t middle = begin + (end - begin) / 2;
+                const bench_descriptor *descriptor = &benchdescriptors[middle];
+                const char *name = benchnames + descriptor->name + skip;
+                size_t rest = descriptor->length - skip;
+                int order = memcmp(name, string, (rest < length) ? rest : length);
+                if(order == 0 && rest > length && next >= 0) order = (unsigned char)name[length] - next;
+                else if(order == 0 && (rest < length || (rest == length && next >= 0))) order = -1;
+                if(order < 0) begin = middle + 1;
+                else end = middle;
+        }
+        return(begin);
+}
+bench_node
+benchsubtreen(const char *string, size_t length)
+{
+        bench_node node = { 0, BENCH_KEY_COUNT, 0 };
+        if(length == 0)
+        {
+                return(node);
+        }
+        node.begin = benchlowerbound(0, node.end, 0, string, length, '.');
+        node.end = benchlowerbound(node.begin, node.end, 0, string, length, '/');
+        node.length = (uint32_t)length + 1;
+        return(node);
+}
+bench_node
+benchsubtree(char *string)
+{
+        return(benchsubtreen(string, strlen(string)));
+}
+int
+benchchildn(bench_node parent, const char *string, size_t length)
+{
+        uint32_t index = benchlowerbound(parent.begin, parent.end, parent.length, string, length, -1);
+        if(index < parent.end)
+        {
+                const bench_descriptor *descriptor = &benchdescriptors[index];
+                if(descriptor->length == parent.length + length &&
+                   memcmp(benchnames + descriptor->name + parent.length, string, length) == 0)
+                {
+                        return(descriptor->id);
+                }
+        }
+        return(-1);
+}
+int
+benchchild(bench_node parent, char *string)
+{
+        return(benchchildn(parent, string, strlen(string)));
+}
+size_t
+benchgetmany(const bench *self, const char **strings, size_t count, char **values)
+{
+        size_t found = 0;
+        for(size_t begin = 0; begin < count; begin += 64)
+        {
+                size_t end = (count - begin < 64) ? count : begin + 64;
+                size_t lengths[64];
+                uint32_t slots[64];
+                for(size_t i = begin; i < end; i++)
+                {
+                        lengths[i - begin] = strlen(strings[i]);
+                        slots[i - begin] = benchslot(strings[i], lengths[i - begin]);
+                }
+                for(size_t i = begin; i < end; i++)
+                {
+                        int id = benchprobe(slots[i - begin], strings[i], lengths[i - begin]);
+                        values[i] = (id < 0) ? NULL : benchgetbyid(self, id);
+                        if(values[i] != NULL) found++;
+                }
+        }
+        return(found);
+}
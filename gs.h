@@ -268,28 +268,19 @@ GSStringCopyNoNull(char *Source, char *Dest, int Max)
         return(true);
 }
 
-/* NOTE: Assumes a maximum string length of 512 bytes. */
-unsigned int /* Returns number of bytes copied. */
+unsigned int /* Returns number of bytes copied. Modifies Source in-place. */
 GSStringTrimWhitespace(char *Source, unsigned int MaxLength)
 {
-        char Dest[512];
-        MaxLength = GSMin(512, MaxLength);
-
         int FirstChar, LastChar;
         for(FirstChar = 0; GSCharIsWhitespace(Source[FirstChar]); FirstChar++);
 
         int StringLength = GSStringLength(Source);
-        for(LastChar = StringLength - 1; GSCharIsWhitespace(Source[LastChar]); LastChar--);
+        for(LastChar = StringLength - 1; LastChar >= FirstChar && GSCharIsWhitespace(Source[LastChar]); LastChar--);
 
         int Count = 0;
         for(int S=FirstChar; S<=LastChar && Count < MaxLength; Count++, S++)
         {
-                Dest[Count] = Source[S];
-        }
-
-        for(int I=0; I<Count; I++)
-        {
-                Source[I] = Dest[I];
+                Source[Count] = Source[S];
         }
         Source[Count] = GSNullChar;
 
@@ -299,13 +290,12 @@ GSStringTrimWhitespace(char *Source, unsigned int MaxLength)
 /*
   For any ascii character following an underscore, remove the underscore
   and capitalize the ascii char.
-  This function assumes a maximum string size of 512 bytes.
+  Modifies Source in-place; the result is never longer than the input.
   The first character is capitalized.
 */
 unsigned int
 GSStringSnakeCaseToCamelCase(char *Source, unsigned int SourceLength)
 {
-        char Dest[512]; /* Scratch buffer. */
         int Si = 0, Di = 0; /* Iterable indices for Source and Dest. */
 
         if((Source[Si] == '_') &&
@@ -314,12 +304,10 @@ GSStringSnakeCaseToCamelCase(char *Source, unsigned int SourceLength)
         {
                 Si++;
         }
-        Dest[Di] = GSCharUpcase(Source[Si]);
+        Source[Di] = GSCharUpcase(Source[Si]);
         Si++;
         Di++;
 
-        SourceLength = GSMin(512, SourceLength);
-
         for(Si, Di; Si<SourceLength; Si++, Di++)
         {
                 /* Replace any '_*' with 'upcase(*)' where * is an ascii char. */
@@ -327,21 +315,15 @@ GSStringSnakeCaseToCamelCase(char *Source, unsigned int SourceLength)
                    (Si+1 < SourceLength) &&
                    GSCharIsAlphabetical(Source[Si+1]))
                 {
-                        Dest[Di] = GSCharUpcase(Source[Si+1]);
+                        Source[Di] = GSCharUpcase(Source[Si+1]);
                         Si++;
                 }
                 /* Copy chars normally. */
                 else
                 {
-                        Dest[Di] = Source[Si];
+                        Source[Di] = Source[Si];
                 }
         }
-
-        /* Write the modified string back to source. */
-        for(int I=0; I<Di; I++)
-        {
-                Source[I] = Dest[I];
-        }
         Source[Di] = GSNullChar;
 
         return(Di);
@@ -456,6 +438,191 @@ GSStringReject(char *Source, char *Dest, unsigned int MaxLength, GSStringFilterF
         return(DestIndex + 1);
 }
 
+/******************************************************************************
+ * Arena Allocator
+ *-----------------------------------------------------------------------------
+ *
+ * Usage:
+ *     size_t Size = 1024 * 1024;
+ *     gs_arena Arena;
+ *     GSArenaInit(&Arena, malloc(Size), Size);
+ *     GSArenaAllowGrowth(&Arena, malloc, free, 64 * Size); (optional)
+ *
+ *     char *String = (char *)GSArenaPush(&Arena, 256);
+ *     gs_arena_mark Mark = GSArenaMark(&Arena);
+ *     int *Numbers = (int *)GSArenaPushAligned(&Arena, sizeof(int) * 16, 64);
+ *     GSArenaPop(&Arena, Mark); (Releases Numbers, keeps String)
+ *     GSArenaReset(&Arena); (Releases everything)
+ *
+ * NOTE:
+ * Memory passed to GSArenaInit is owned by the caller.
+ * When growth is allowed, a full arena chains a new block of at least twice
+ * the size of the previous one from AllocFn, never exceeding MaxSize bytes in
+ * total. A MaxSize of 0 means unbounded. Push returns NULL when the request
+ * can't be satisfied.
+ ******************************************************************************/
+#define GSArenaDefaultAlignment (2 * sizeof(void *))
+
+typedef void *(*GSArenaAllocFn)(size_t Size);
+typedef void (*GSArenaFreeFn)(void *Memory);
+
+typedef struct gs_arena_block
+{
+        struct gs_arena_block *Previous;
+        size_t Capacity; /* Including this header. */
+        gs_bool IsOwned;
+} gs_arena_block;
+
+typedef struct gs_arena
+{
+        gs_arena_block *Block;
+        size_t Used; /* Bytes used in the current block, including its header. */
+
+        GSArenaAllocFn AllocFn;
+        GSArenaFreeFn FreeFn;
+        size_t MaxSize;
+        size_t TotalCapacity;
+        size_t PeakCapacity;
+} gs_arena;
+
+typedef struct gs_arena_mark
+{
+        gs_arena_block *Block;
+        size_t Used;
+} gs_arena_mark;
+
+gs_arena *
+GSArenaInit(gs_arena *Self, void *Memory, size_t Size)
+{
+        Self->Block = (gs_arena_block *)Memory;
+        Self->Block->Previous = NULL;
+        Self->Block->Capacity = Size;
+        Self->Block->IsOwned = false;
+        Self->Used = sizeof(gs_arena_block);
+
+        Self->AllocFn = NULL;
+        Self->FreeFn = NULL;
+        Self->MaxSize = 0;
+        Self->TotalCapacity = Size;
+        Self->PeakCapacity = Size;
+        return(Self);
+}
+
+void
+GSArenaAllowGrowth(gs_arena *Self, GSArenaAllocFn AllocFn, GSArenaFreeFn FreeFn, size_t MaxSize)
+{
+        Self->AllocFn = AllocFn;
+        Self->FreeFn = FreeFn;
+        Self->MaxSize = MaxSize;
+}
+
+gs_bool
+__GSArenaGrow(gs_arena *Self, size_t Size, size_t Alignment)
+{
+        if(Self->AllocFn == NULL) return(false);
+
+        size_t Wanted = sizeof(gs_arena_block) + Alignment + Size;
+        size_t Capacity = GSMax(Wanted, Self->Block->Capacity * 2);
+        if(Self->MaxSize != 0)
+        {
+                if(Self->TotalCapacity + Wanted > Self->MaxSize) return(false);
+                Capacity = GSMin(Capacity, Self->MaxSize - Self->TotalCapacity);
+        }
+
+        gs_arena_block *Block = (gs_arena_block *)Self->AllocFn(Capacity);
+        if(Block == NULL) return(false);
+
+        Block->Previous = Self->Block;
+        Block->Capacity = Capacity;
+        Block->IsOwned = true;
+        Self->Block = Block;
+        Self->Used = sizeof(gs_arena_block);
+        Self->TotalCapacity += Capacity;
+        Self->PeakCapacity = GSMax(Self->PeakCapacity, Self->TotalCapacity);
+
+        return(true);
+}
+
+void * /* Alignment must be a power of two. Returns NULL if out of memory. */
+GSArenaPushAligned(gs_arena *Self, size_t Size, size_t Alignment)
+{
+        size_t Base = (size_t)Self->Block;
+        size_t Offset = ((Base + Self->Used + Alignment - 1) & ~(Alignment - 1)) - Base;
+
+        if(Offset + Size > Self->Block->Capacity)
+        {
+                if(!__GSArenaGrow(Self, Size, Alignment)) return(NULL);
+                Base = (size_t)Self->Block;
+                Offset = ((Base + Self->Used + Alignment - 1) & ~(Alignment - 1)) - Base;
+        }
+
+        Self->Used = Offset + Size;
+        return((char *)Self->Block + Offset);
+}
+
+void *
+GSArenaPush(gs_arena *Self, size_t Size)
+{
+        return(GSArenaPushAligned(Self, Size, GSArenaDefaultAlignment));
+}
+
+/*
+  Grows the most recent allocation in place when possible, otherwise moves it
+  into a new allocation. Memory must have been pushed onto this arena.
+  Returns NULL if out of memory.
+*/
+void *
+GSArenaResize(gs_arena *Self, void *Memory, size_t OldSize, size_t NewSize)
+{
+        char *Top = (char *)Self->Block + Self->Used;
+        if((char *)Memory + OldSize == Top &&
+           ((char *)Memory - (char *)Self->Block) + NewSize <= Self->Block->Capacity)
+        {
+                Self->Used = ((char *)Memory - (char *)Self->Block) + NewSize;
+                return(Memory);
+        }
+
+        void *Result = GSArenaPush(Self, NewSize);
+        if(Result == NULL) return(NULL);
+        memcpy(Result, Memory, GSMin(OldSize, NewSize));
+        return(Result);
+}
+
+gs_arena_mark
+GSArenaMark(gs_arena *Self)
+{
+        gs_arena_mark Result;
+        Result.Block = Self->Block;
+        Result.Used = Self->Used;
+        return(Result);
+}
+
+void /* Releases everything pushed since Mark was taken. */
+GSArenaPop(gs_arena *Self, gs_arena_mark Mark)
+{
+        while(Self->Block != Mark.Block)
+        {
+                gs_arena_block *Block = Self->Block;
+                Self->Block = Block->Previous;
+                Self->TotalCapacity -= Block->Capacity;
+                if(Block->IsOwned && Self->FreeFn != NULL) Self->FreeFn(Block);
+        }
+        Self->Used = Mark.Used;
+}
+
+void /* Releases everything, including any chained blocks. */
+GSArenaReset(gs_arena *Self)
+{
+        while(Self->Block->Previous != NULL)
+        {
+                gs_arena_block *Block = Self->Block;
+                Self->Block = Block->Previous;
+                Self->TotalCapacity -= Block->Capacity;
+                if(Block->IsOwned && Self->FreeFn != NULL) Self->FreeFn(Block);
+        }
+        Self->Used = sizeof(gs_arena_block);
+}
+
 /******************************************************************************
  * Hash Map
  *-----------------------------------------------------------------------------
@@ -505,10 +672,11 @@ __GSHashMapComputeHash(gs_hash_map *Self, char *String)
 size_t
 GSHashMapAllocSize(unsigned int MaxKeyLength, unsigned int NumEntries)
 {
-        int AllocSize =
+        size_t AllocSize =
                 sizeof(gs_hash_map) +
                 (sizeof(char) * MaxKeyLength * NumEntries) +
                 (sizeof(void *) * NumEntries);
+        return(AllocSize);
 }
 
 gs_hash_map *
@@ -908,8 +1076,9 @@ GSFileCopyToBuffer(char *FileName, gs_buffer *Buffer)
 
         fseek(File, 0, SEEK_END);
         size_t FileSize = ftell(File);
-        int Remaining = (Buffer->Start + Buffer->Capacity) - Buffer->Cursor;
-        if(FileSize > Remaining) return(false);
+        size_t Remaining = (Buffer->Start + Buffer->Capacity) - Buffer->Cursor;
+        /* Leave room for the terminating NULL. */
+        if(FileSize >= Remaining) return(false);
 
         fseek(File, 0, SEEK_SET);
         fread(Buffer->Cursor, 1, FileSize, File);
@@ -14,15 +14,30 @@
 #ifndef GS_CFG_VERSION
 #define GS_CFG_VERSION 0.1.0
 
+#define _POSIX_C_SOURCE 200809L /* mmap, fstat, posix_madvise */
+
 #include <alloca.h>
 #include <stdio.h>
-#include <stdlib.h> /* EXIT_SUCCESS */
+#include <stdlib.h> /* EXIT_SUCCESS, qsort */
+#include <stdint.h> /* uint64_t */
+#include <errno.h>
+#include <limits.h> /* LLONG_MIN */
+#include <math.h> /* isfinite */
 #include <libgen.h> /* POSIX basename */
+#include <fcntl.h> /* open */
+#include <unistd.h> /* read, close, sysconf */
+#include <sys/mman.h> /* mmap */
+#include <sys/stat.h> /* fstat */
+#include <time.h> /* clock_gettime */
+#include <pthread.h>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 #include "gs.h"
 
 #define NULL_CHAR '\0'
-const int MaxStringLength = 255;
-const int MaxNestedStructs = 10;
 
 typedef enum source_style_e
 {
@@ -32,54 +47,320 @@ typedef enum source_style_e
         SOURCE_STYLE_CASEY
 } source_style_e;
 
+typedef enum lookup_e
+{
+        LOOKUP_CHAIN, /* One string compare per key, in file order or a profile's. */
+        LOOKUP_HASH, /* A perfect hash built at generation time. */
+        LOOKUP_SORTED /* A binary search over the name-sorted descriptors. */
+} lookup_e;
+
+typedef enum layout_e /* How the generated struct holds values. */
+{
+        LAYOUT_POINTER, /* One char * per key. */
+        LAYOUT_COMPACT  /* One uint32_t offset per key into a single string blob. */
+} layout_e;
+
 typedef struct config
 {
         char *StructName;
+        char *FunctionPrefix; /* StructName as it prefixes generated functions. */
         source_style_e SourceStyle;
+        lookup_e Lookup;
+        layout_e Layout;
+        gs_bool IsTyped; /* Infer int, float and bool values instead of emitting every value as a string. */
+        gs_bool IsStatic; /* Emit a static const instance instead of an init function. */
+        gs_bool IsInstrumented; /* Count lookup hits per key, and misses, in the generated accessors. */
+        gs_bool IsHeader; /* Emit a header of static inline accessors, defining the rest under GSCFG_IMPLEMENTATION. */
+        char *ProfileFile; /* Hits per key from an instrumented _dump_stats, or NULL. */
         int Indent;
 } config;
 
+typedef struct input_file
+{
+        gs_buffer Buffer;
+        gs_bool IsMapped;
+        size_t MappedSize;
+} input_file;
+
+typedef struct config_line
+{
+        unsigned int Indentation;
+        char *Key;
+        unsigned int KeyLength;
+        char *Value; /* NULL for a nested struct. */
+        unsigned int ValueLength;
+} config_line;
+
+typedef struct config_lines
+{
+        config_line *Lines;
+        unsigned int Count;
+        unsigned int Capacity;
+        unsigned int LineCount; /* Every line in the input, including skipped ones. */
+        gs_arena *Arena;
+} config_lines;
+
+typedef enum value_type_e /* In the order of the generated type constants. */
+{
+        VALUE_TYPE_STRING,
+        VALUE_TYPE_INT,
+        VALUE_TYPE_FLOAT,
+        VALUE_TYPE_BOOL,
+        VALUE_TYPE_COUNT
+} value_type_e;
+
+typedef struct typed_value
+{
+        value_type_e Type;
+        char *Text; /* The value without any type tag. */
+        unsigned int TextLength;
+        char Literal[32]; /* The parsed value as C source, unless Type is VALUE_TYPE_STRING. */
+        unsigned int LiteralLength;
+} typed_value;
+
+typedef struct config_entry /* One leaf, as the generated lookup functions see it. */
+{
+        char *Name; /* Compound name, eg.: "profile.icon.path". */
+        unsigned int NameLength;
+        value_type_e Type;
+        uint32_t NameOffset; /* Into the generated _names, once PrintDescriptors has run. */
+} config_entry;
+
+typedef struct config_entries
+{
+        config_entry *Entries;
+        unsigned int Count;
+        unsigned int Capacity;
+        gs_arena *Arena;
+} config_entries;
+
+typedef struct perfect_hash
+{
+        unsigned int *Slots; /* Entry index held by each slot. */
+        unsigned int SlotCount;
+        unsigned int *Displacements; /* One per bucket. */
+        unsigned int BucketCount;
+} perfect_hash;
+
+typedef struct lookup_key
+{
+        uint64_t Hash;
+        unsigned int Entry;
+} lookup_key;
+
+typedef struct lookup_bucket
+{
+        unsigned int Bucket;
+        unsigned int Start; /* Index of the bucket's first key once grouped. */
+        unsigned int Count;
+} lookup_bucket;
+
+typedef struct indentation
+{
+        char *Spaces; /* Width * Levels spaces; a prefix serves any shallower level. */
+        unsigned int Width;
+        unsigned int Levels;
+        gs_arena *Arena;
+} indentation;
+
+typedef struct section_chunk /* A full part of a section, left where it was written. */
+{
+        char *Start;
+        size_t Length;
+        struct section_chunk *Next;
+} section_chunk;
+
+typedef struct section
+{
+        gs_buffer Buffer; /* The chunk being written. */
+        section_chunk *First; /* Full chunks before Buffer's, in order. */
+        section_chunk *Last;
+        size_t FullLength; /* Of every full chunk. */
+        gs_arena *Arena;
+        indentation *Indentation;
+} section;
+
+typedef struct config_stack_level
+{
+        unsigned int NameOffset;
+        unsigned int NameLength;
+        int Indentation;
+} config_stack_level;
+
 typedef struct config_stack
 {
         char *Names;
-        int *NameOffsets;
-        unsigned int NextNameOffset;
-        int *Indentation;
+        unsigned int NamesLength;
+        unsigned int NamesCapacity;
+        config_stack_level *Levels;
         unsigned int Count;
+        unsigned int Capacity;
+        unsigned int PeakCount;
+        unsigned int PeakNamesLength;
+        gs_arena *Arena;
 } config_stack;
 
-/******************************************************************************
- * Globals
- ******************************************************************************/
+typedef enum section_e /* In the order they're written out. */
+{
+        SECTION_DEFINE,
+        SECTION_KEYS,
+        SECTION_OFFSETS,
+        SECTION_BLOB,
+        SECTION_LENGTHS,
+        SECTION_TYPES,
+        SECTION_DESCRIPTORS,
+        SECTION_INIT,
+        SECTION_QUERY,
+        SECTION_GET,
+        SECTION_COUNT
+} section_e;
+
+typedef enum phase_e
+{
+        PHASE_READ,
+        PHASE_TOKENIZE,
+        PHASE_EMIT,
+        PHASE_WRITE,
+        PHASE_COUNT
+} phase_e;
+
+typedef enum stats_format_e
+{
+        STATS_FORMAT_NONE,
+        STATS_FORMAT_HUMAN,
+        STATS_FORMAT_JSON
+} stats_format_e;
+
+typedef struct generator_stats
+{
+        size_t InputBytes;
+        unsigned int Lines;
+        unsigned int Keys;
+        unsigned int MaxDepth;
+        size_t ConfigStackPeakBytes;
+        size_t SectionBytes[SECTION_COUNT];
+        size_t OutputBytes;
+        size_t ArenaPeakBytes;
+        double WallSeconds[PHASE_COUNT];
+        double CpuSeconds[PHASE_COUNT];
+        double SplitCpuSeconds; /* Spent emitting by --split's other threads, added to emit's. */
+} generator_stats;
+
+typedef struct job /* Everything needed to generate one output file. */
+{
+        char *InputFileName;
+        char *OutputFileName; /* Beside the input. */
+        char *OutputBaseName; /* Within OutputFileName. */
+        config Config;
+        unsigned int SplitCount; /* Threads to split this file's generation across. */
+        generator_stats Stats;
+        gs_bool IsWritten; /* Whether the whole output reached OutputFileName. */
+} job;
+
+typedef struct job_output /* Where a job writes, to catch two jobs writing one file. */
+{
+        dev_t Device; /* Of the output's directory. */
+        ino_t Inode;
+        job *Job;
+} job_output;
+
+typedef struct fragment /* A run of lines that starts and ends at the top level. */
+{
+        unsigned int Begin;
+        unsigned int End; /* One past the last line. */
+        size_t BlobOffset; /* Where the fragment's first value lands in a LAYOUT_COMPACT blob. */
+        section Sections[SECTION_COUNT];
+        config_entries Entries;
+        generator_stats Stats;
+} fragment;
+
+typedef struct fragment_pool
+{
+        config *Config;
+        config_lines *Lines;
+        fragment *Fragments;
+        unsigned int Count;
+        unsigned int Next; /* Guarded by Lock. */
+        pthread_mutex_t Lock;
+} fragment_pool;
+
+typedef struct fragment_worker
+{
+        fragment_pool *Pool;
+        gs_arena Arena; /* Holds the worker's fragments until they're written. */
+        void *ArenaMemory;
+        pthread_t Thread;
+        double CpuSeconds;
+} fragment_worker;
+
+typedef struct source /* The generated file, as the sections to write out in order. */
+{
+        section **Sections;
+        unsigned int Count;
+        size_t Length;
+        fragment_worker *Workers; /* With --split, their arenas hold most of Sections. */
+        unsigned int WorkerCount;
+} source;
+
+typedef struct job_queue
+{
+        pthread_mutex_t Lock;
+        unsigned int Head; /* The owning worker takes from here. */
+        unsigned int Tail; /* Other workers steal from here. */
+} job_queue;
+
+typedef struct job_pool
+{
+        job *Jobs;
+        unsigned int JobCount;
+        job_queue *Queues; /* One per worker. */
+        unsigned int WorkerCount;
+        size_t MemoryLimit; /* Per worker. */
+} job_pool;
 
-config GConfig;
+typedef struct worker
+{
+        job_pool *Pool;
+        unsigned int Index;
+        pthread_t Thread;
+} worker;
 
 /******************************************************************************
  * Functions
  ******************************************************************************/
 
-void
-ConfigStackInit(config_stack *Self)
+void *
+ArenaPush(gs_arena *Arena, size_t Size)
 {
-        Self->Names = (char *)malloc(MaxStringLength * MaxNestedStructs);
-        memset(Self->Names, 0, MaxStringLength * MaxNestedStructs);
-
-        Self->NameOffsets = (int *)malloc(sizeof(int) * MaxNestedStructs);
-        memset(Self->NameOffsets, -1, MaxNestedStructs);
-
-        Self->Indentation = (int *)malloc(sizeof(int) * MaxNestedStructs);
-        memset(Self->Indentation, -1, MaxNestedStructs);
+        void *Result = GSArenaPush(Arena, Size);
+        if(Result == NULL) GSAbortWithMessage("Memory limit of %lu bytes exceeded\n", Arena->MaxSize);
+        return(Result);
+}
 
-        Self->NextNameOffset = 0;
-        Self->Count = 0;
+void *
+ArenaResize(gs_arena *Arena, void *Memory, size_t OldSize, size_t NewSize)
+{
+        void *Result = GSArenaResize(Arena, Memory, OldSize, NewSize);
+        if(Result == NULL) GSAbortWithMessage("Memory limit of %lu bytes exceeded\n", Arena->MaxSize);
+        return(Result);
 }
 
 void
-ConfigStackDestroy(config_stack *Self)
+ConfigStackInit(config_stack *Self, gs_arena *Arena)
 {
-        free(Self->Names);
-        free(Self->NameOffsets);
-        free(Self->Indentation);
+        Self->Arena = Arena;
+
+        Self->Capacity = 16;
+        Self->Levels = (config_stack_level *)ArenaPush(Arena, sizeof(config_stack_level) * Self->Capacity);
+
+        Self->NamesCapacity = 256;
+        Self->Names = (char *)ArenaPush(Arena, Self->NamesCapacity);
+        Self->Names[0] = NULL_CHAR;
+
+        Self->NamesLength = 0;
+        Self->Count = 0;
+        Self->PeakCount = 0;
+        Self->PeakNamesLength = 0;
 }
 
 unsigned int
@@ -88,13 +369,25 @@ ConfigStackDepth(config_stack *Self)
         return(Self->Count);
 }
 
-char * /* Returns NULL if Index is out of bounds. */
-ConfigStackNameAt(config_stack *Self, unsigned int Index)
+void /* Ensures Names can hold Wanted more bytes plus a terminating NULL. */
+ConfigStackReserveNames(config_stack *Self, unsigned int Wanted)
+{
+        if(Self->NamesLength + Wanted + 1 <= Self->NamesCapacity) return;
+
+        unsigned int Capacity = Self->NamesCapacity;
+        while(Self->NamesLength + Wanted + 1 > Capacity) Capacity *= 2;
+        Self->Names = (char *)ArenaResize(Self->Arena, Self->Names, Self->NamesCapacity, Capacity);
+        Self->NamesCapacity = Capacity;
+}
+
+char * /* Returns NULL if Index is out of bounds. Result is not NULL terminated. */
+ConfigStackNameAt(config_stack *Self, unsigned int Index, unsigned int *Length)
 {
         if(Index >= Self->Count) return(NULL);
 
-        int NameIndex = Self->NameOffsets[Index];
-        char *Result = &Self->Names[NameIndex];
+        config_stack_level *Level = &Self->Levels[Index];
+        *Length = Level->NameLength;
+        char *Result = &Self->Names[Level->NameOffset];
 
         return(Result);
 }
@@ -104,7 +397,7 @@ ConfigStackIndentationAt(config_stack *Self, unsigned int Index)
 {
         if(Index >= Self->Count) return(-1);
 
-        int Result = (int)Self->Indentation[Index];
+        int Result = (int)Self->Levels[Index].Indentation;
 
         return(Result);
 }
@@ -114,414 +407,3554 @@ ConfigStackDrop(config_stack *Self)
 {
         if(Self->Count <= 0) return(true);
 
-        int NameIndex = Self->NameOffsets[Self->Count - 1];
-        Self->Names[NameIndex] = NULL_CHAR;
-        Self->NextNameOffset = NameIndex;
-        Self->Indentation[Self->Count - 1] = -1;
         Self->Count--;
+        Self->NamesLength = Self->Levels[Self->Count].NameOffset;
+        Self->Names[Self->NamesLength] = NULL_CHAR;
         return(true);
 }
 
 gs_bool
-ConfigStackAdd(config_stack *Self, char *Name, unsigned int Indentation)
+ConfigStackAdd(config_stack *Self, char *Name, unsigned int StringLength, unsigned int Indentation)
 {
-        if(Self->Count == 0)
+        if(Self->Count == Self->Capacity)
         {
-                GSStringCopy(Name, &Self->Names[0], GSStringLength(Name));
-                Self->NameOffsets[0] = 0;
-                Self->Count = 1;
-                Self->NextNameOffset = GSStringLength(Name) + 1;
-                Self->Indentation[0] = Indentation;
+                size_t Size = sizeof(config_stack_level) * Self->Capacity;
+                Self->Levels = (config_stack_level *)ArenaResize(Self->Arena, Self->Levels, Size, Size * 2);
+                Self->Capacity *= 2;
         }
-        else
-        {
-                int StringLength = GSStringLength(Name);
 
-                if((StringLength + Self->NextNameOffset) > (MaxStringLength * MaxNestedStructs))
+        /* Names holds the dotted path of every open struct, eg.: "profile.icon." */
+        ConfigStackReserveNames(Self, StringLength + 1);
+        config_stack_level *Level = &Self->Levels[Self->Count];
+        Level->NameOffset = Self->NamesLength;
+        Level->NameLength = StringLength;
+        Level->Indentation = Indentation;
+
+        memcpy(&Self->Names[Self->NamesLength], Name, StringLength);
+        Self->NamesLength += StringLength;
+        Self->Names[Self->NamesLength++] = '.';
+        Self->Names[Self->NamesLength] = NULL_CHAR;
+        Self->Count++;
+
+        Self->PeakCount = GSMax(Self->PeakCount, Self->Count);
+        Self->PeakNamesLength = GSMax(Self->PeakNamesLength, Self->NamesLength);
+        return(true);
+}
+
+char * /* Returns "path.to.Name", valid until the stack is next modified. */
+ConfigStackCompoundName(config_stack *Self, char *Name, unsigned int StringLength, unsigned int *Length)
+{
+        ConfigStackReserveNames(Self, StringLength);
+        memcpy(&Self->Names[Self->NamesLength], Name, StringLength);
+        Self->Names[Self->NamesLength + StringLength] = NULL_CHAR;
+
+        *Length = Self->NamesLength + StringLength;
+        Self->PeakNamesLength = GSMax(Self->PeakNamesLength, *Length);
+        return(Self->Names);
+}
+
+/******************************************************************************
+ * Input
+ *-----------------------------------------------------------------------------
+ * Regular files are mapped read-only. Anything else (pipes, character
+ * devices) is streamed onto the arena. Either way Buffer->Start[Length] is
+ * guaranteed to be a readable NULL sentinel.
+ ******************************************************************************/
+
+gs_bool
+InputFileStream(input_file *Self, int File, gs_arena *Arena)
+{
+        size_t Capacity = 64 * 1024;
+        size_t Length = 0;
+        char *Memory = (char *)ArenaPush(Arena, Capacity);
+
+        while(true)
+        {
+                /* Always keep one byte free for the sentinel. */
+                if(Length + 1 >= Capacity)
                 {
-                        return(false);
+                        Memory = (char *)ArenaResize(Arena, Memory, Capacity, Capacity * 2);
+                        Capacity *= 2;
                 }
 
-                GSStringCopy(Name, &Self->Names[Self->NextNameOffset], GSStringLength(Name));
-                Self->NameOffsets[Self->Count] = Self->NextNameOffset;
-                Self->Indentation[Self->Count] = Indentation;
-                Self->Count++;
-                Self->NextNameOffset += (StringLength + 1);
+                ssize_t Count = read(File, Memory + Length, Capacity - Length - 1);
+                if(Count == 0) break;
+                if(Count < 0) return(false);
+                Length += Count;
         }
+        Memory[Length] = NULL_CHAR;
 
+        GSBufferInit(&Self->Buffer, Memory, Length + 1);
+        Self->Buffer.Length = Length;
+        Self->IsMapped = false;
+        Self->MappedSize = 0;
         return(true);
 }
 
-void
-PrintIndent(char *String, unsigned int Level)
+gs_bool
+InputFileOpen(input_file *Self, char *FileName, gs_arena *Arena)
 {
-        char Temp[255];
-        if(Level == 0)
+        int File = open(FileName, O_RDONLY);
+        if(File < 0) return(false);
+
+        struct stat Info;
+        if(fstat(File, &Info) != 0)
         {
-                sprintf(String, "%s", "");
+                close(File);
+                return(false);
         }
-        else
+
+        /*
+          The zero-filled tail of the last mapped page doubles as the sentinel.
+          Files that exactly fill their last page have no such tail, so those
+          are streamed instead, as are empty files which can't be mapped.
+        */
+        size_t Size = Info.st_size;
+        size_t PageSize = sysconf(_SC_PAGESIZE);
+        if(!S_ISREG(Info.st_mode) || Size == 0 || (Size % PageSize) == 0)
         {
-                sprintf(Temp, "%%%is%c", Level * GConfig.Indent, '\0');
-                sprintf(String, Temp, " ");
+                gs_bool Result = InputFileStream(Self, File, Arena);
+                close(File);
+                return(Result);
         }
+
+        void *Memory = mmap(NULL, Size, PROT_READ, MAP_PRIVATE, File, 0);
+        close(File);
+        if(Memory == MAP_FAILED) return(false);
+        posix_madvise(Memory, Size, POSIX_MADV_SEQUENTIAL);
+
+        GSBufferInit(&Self->Buffer, (char *)Memory, Size + 1);
+        Self->Buffer.Length = Size;
+        Self->IsMapped = true;
+        Self->MappedSize = Size;
+        return(true);
 }
 
-unsigned int /* Resultant ConfigStack depth. */
-UnwindNestedStructs(config_stack *ConfigStack, unsigned int NumSpaces, FILE *StructDefine)
+void /* Streamed input lives on the arena and is released with it. */
+InputFileClose(input_file *Self)
 {
-        char IndentString[MaxStringLength];
-        char Indent[MaxStringLength];
-        PrintIndent(Indent, 1);
-
-        int StructIndex = -1;
-        for(int I = 0; I < ConfigStack->Count; I++)
-        {
-                int Indentation = ConfigStackIndentationAt(ConfigStack, I);
-                if(-1 == Indentation) GSAbortWithMessage("This is unexpected!\n");
+        if(Self->IsMapped) munmap(Self->Buffer.Start, Self->MappedSize);
+}
 
-                if(NumSpaces == Indentation)
-                {
-                        StructIndex = I;
-                        break;
-                }
-        }
+/******************************************************************************
+ * Tokenizer
+ *-----------------------------------------------------------------------------
+ * A single forward pass over the input that records the indentation, key and
+ * value of every `key: value' line as spans into the input buffer.
+ * Lines without a colon are skipped. Keys and values are trimmed of
+ * surrounding whitespace; an empty value marks a nested struct.
+ ******************************************************************************/
 
-        if(-1 == StructIndex && NumSpaces != 0) GSAbortWithMessage("This is unexpected!\n");
+unsigned int
+TokenizerFirstBit(unsigned int Mask)
+{
+        return(__builtin_ctz(Mask));
+}
 
-        for(int I = ConfigStack->Count - 1; I > StructIndex; I--)
+char * /* Returns the first character of the line that isn't a space or tab. */
+TokenizerSkipIndentation(char *Cursor, char *End)
+{
+#if defined(__SSE2__)
+        __m128i Spaces = _mm_set1_epi8(' ');
+        __m128i Tabs = _mm_set1_epi8('\t');
+        while(End - Cursor >= 16)
         {
-                PrintIndent(IndentString, ConfigStack->Count - 1);
-                char *StructName = ConfigStackNameAt(ConfigStack, I);
-                fprintf(StructDefine, "%s%s} %s;\n", IndentString, Indent, StructName);
-                ConfigStackDrop(ConfigStack);
+                __m128i Chunk = _mm_loadu_si128((__m128i *)Cursor);
+                __m128i Blank = _mm_or_si128(_mm_cmpeq_epi8(Chunk, Spaces), _mm_cmpeq_epi8(Chunk, Tabs));
+                unsigned int Mask = ~_mm_movemask_epi8(Blank) & 0xFFFF;
+                if(Mask) return(Cursor + TokenizerFirstBit(Mask));
+                Cursor += 16;
         }
-
-        return(ConfigStack->Count);
+#endif
+        while(Cursor < End && (*Cursor == ' ' || *Cursor == '\t')) Cursor++;
+        return(Cursor);
 }
 
-void
-PrintFunctionIntros(FILE *Define, FILE *Init, FILE *Query, FILE *Get)
+char * /* Returns the line's terminating newline, or End. */
+TokenizerScanLine(char *Cursor, char *End, char **Colon)
 {
-        /* Define */
-        fprintf(Define, "#include <string.h> /* strncmp */\n");
-        fprintf(Define, "typedef struct %s\n", GConfig.StructName);
-        fprintf(Define, "{\n");
+        *Colon = NULL;
 
-        /* Print Init Function Intro */
-        fprintf(Init, "void\n");
-        switch(GConfig.SourceStyle)
+#if defined(__AVX2__)
+        __m256i Newlines32 = _mm256_set1_epi8('\n');
+        __m256i Colons32 = _mm256_set1_epi8(':');
+        while(End - Cursor >= 32)
         {
-                case(SOURCE_STYLE_CAMELCASE):
-                {
-                        fprintf(Init, "%sInit(%s *Self)\n", GConfig.StructName, GConfig.StructName);
-                } break;
-                case(SOURCE_STYLE_SNAKECASE):
-                {
-                        fprintf(Init, "%s_init(%s *self)\n", GConfig.StructName, GConfig.StructName);
-                } break;
-                case(SOURCE_STYLE_CASEY):
-                {
-                        char ModifiedStructName[MaxStringLength];
-                        memset(ModifiedStructName, 0, MaxStringLength);
-                        GSStringCopy(GConfig.StructName, ModifiedStructName, GSStringLength(GConfig.StructName));
-                        GSStringSnakeCaseToCamelCase(ModifiedStructName, GSStringLength(ModifiedStructName));
-                        fprintf(Init, "%sInit(%s *Self)\n", ModifiedStructName, GConfig.StructName);
-                } break;
-                default:
+                __m256i Chunk = _mm256_loadu_si256((__m256i *)Cursor);
+                unsigned int NewlineMask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(Chunk, Newlines32));
+                if(*Colon == NULL)
                 {
-                        fprintf(Init, "%sinit(%s *self)\n", GConfig.StructName, GConfig.StructName);
-                } break;
+                        unsigned int ColonMask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(Chunk, Colons32));
+                        /* Only colons before the first newline belong to this line. */
+                        if(NewlineMask) ColonMask &= (NewlineMask & -NewlineMask) - 1;
+                        if(ColonMask) *Colon = Cursor + TokenizerFirstBit(ColonMask);
+                }
+                if(NewlineMask) return(Cursor + TokenizerFirstBit(NewlineMask));
+                Cursor += 32;
         }
-        fprintf(Init, "{\n");
-
-        /* Print Query Function Intro */
-        fprintf(Query, "unsigned int\n");
-        switch(GConfig.SourceStyle)
+#endif
+#if defined(__SSE2__)
+        __m128i Newlines = _mm_set1_epi8('\n');
+        __m128i Colons = _mm_set1_epi8(':');
+        while(End - Cursor >= 16)
         {
-                case(SOURCE_STYLE_CAMELCASE):
-                {
-                        fprintf(Query, "%sHasKey(%s *Self, char *String)\n", GConfig.StructName, GConfig.StructName);
-                } break;
-                case(SOURCE_STYLE_SNAKECASE):
-                {
-                        fprintf(Query, "%s_has_key(%s *self, char *string)\n", GConfig.StructName, GConfig.StructName);
-                } break;
-                case(SOURCE_STYLE_CASEY):
-                {
-                        char ModifiedStructName[MaxStringLength];
-                        memset(ModifiedStructName, 0, MaxStringLength);
-                        GSStringCopy(GConfig.StructName, ModifiedStructName, GSStringLength(GConfig.StructName));
-                        GSStringSnakeCaseToCamelCase(ModifiedStructName, GSStringLength(ModifiedStructName));
-                        fprintf(Query, "%sHasKey(%s *Self, char *String)\n", ModifiedStructName, GConfig.StructName);
-                } break;
-                default:
+                __m128i Chunk = _mm_loadu_si128((__m128i *)Cursor);
+                unsigned int NewlineMask = _mm_movemask_epi8(_mm_cmpeq_epi8(Chunk, Newlines));
+                if(*Colon == NULL)
                 {
-                        fprintf(Query, "%shaskey(%s *self, char *string)\n", GConfig.StructName, GConfig.StructName);
-                } break;
+                        unsigned int ColonMask = _mm_movemask_epi8(_mm_cmpeq_epi8(Chunk, Colons));
+                        if(NewlineMask) ColonMask &= (NewlineMask & -NewlineMask) - 1;
+                        if(ColonMask) *Colon = Cursor + TokenizerFirstBit(ColonMask);
+                }
+                if(NewlineMask) return(Cursor + TokenizerFirstBit(NewlineMask));
+                Cursor += 16;
         }
-        fprintf(Query, "{\n");
-
-        /* Print Get Function Intro */
-        fprintf(Get, "char *\n");
-        switch(GConfig.SourceStyle)
+#endif
+        for(; Cursor < End; Cursor++)
         {
-                case(SOURCE_STYLE_CAMELCASE):
-                {
-                        fprintf(Get, "%sGet(%s *Self, char *String)\n", GConfig.StructName, GConfig.StructName);
-                } break;
-                case(SOURCE_STYLE_SNAKECASE):
-                {
-                        fprintf(Get, "%s_get(%s *self, char *string)\n", GConfig.StructName, GConfig.StructName);
-                } break;
-                case(SOURCE_STYLE_CASEY):
-                {
-                        char ModifiedStructName[MaxStringLength];
-                        memset(ModifiedStructName, 0, MaxStringLength);
-                        GSStringCopy(GConfig.StructName, ModifiedStructName, GSStringLength(GConfig.StructName));
-                        GSStringSnakeCaseToCamelCase(ModifiedStructName, GSStringLength(ModifiedStructName));
-                        fprintf(Get, "%sGet(%s *Self, char *String)\n", ModifiedStructName, GConfig.StructName);
-                } break;
-                default:
-                {
-                        fprintf(Get, "%sget(%s *self, char *string)\n", GConfig.StructName, GConfig.StructName);
-                } break;
+                if(*Cursor == '\n') break;
+                if(*Cursor == ':' && *Colon == NULL) *Colon = Cursor;
         }
-        fprintf(Get, "{\n");
+        return(Cursor);
 }
 
 void
-PrintFunctionSource(FILE *Init, FILE *Query, FILE *Get, char *Attribute, char *Value)
+ConfigLinesInit(config_lines *Self, gs_arena *Arena, unsigned int Capacity)
 {
-        char Indent[MaxStringLength];
-        PrintIndent(Indent, 1);
+        Self->Arena = Arena;
+        Self->Lines = (config_line *)ArenaPush(Arena, sizeof(config_line) * Capacity);
+        Self->Count = 0;
+        Self->Capacity = Capacity;
+        Self->LineCount = 0;
+}
 
-        /* Init */
-        switch(GConfig.SourceStyle)
+config_line *
+ConfigLinesPush(config_lines *Self)
+{
+        if(Self->Count == Self->Capacity)
         {
-                case(SOURCE_STYLE_CASEY):
-                case(SOURCE_STYLE_CAMELCASE):
-                {
-                        fprintf(Init, "%sSelf->%s = \"%s\";\n", Indent, Attribute, Value);
-                } break;
-                default:
-                {
-                        fprintf(Init, "%sself->%s = \"%s\";\n", Indent, Attribute, Value);
-                } break;
+                size_t Size = sizeof(config_line) * Self->Capacity;
+                Self->Lines = (config_line *)ArenaResize(Self->Arena, Self->Lines, Size, Size * 2);
+                Self->Capacity *= 2;
         }
 
-        /* Query */
-        fprintf(Query, "%sif(strncmp(String, \"%s\", %lu) == 0)\n", Indent, Attribute, GSStringLength(Attribute));
-        fprintf(Query, "%s{\n", Indent);
-        fprintf(Query, "%s%sreturn(!0);\n", Indent, Indent);
-        fprintf(Query, "%s}\n", Indent);
+        config_line *Result = &Self->Lines[Self->Count];
+        Self->Count++;
+        return(Result);
+}
+
+void
+Tokenize(gs_buffer *Buffer, config_lines *Lines)
+{
+        char *Cursor = Buffer->Start;
+        char *End = Buffer->Start + Buffer->Length;
 
-        /* Get */
-        fprintf(Get, "%sif(strncmp(String, \"%s\", %lu) == 0)\n", Indent,  Attribute, GSStringLength(Attribute));
-        fprintf(Get, "%s{\n", Indent);
-        switch(GConfig.SourceStyle)
+        while(Cursor < End)
         {
-                case(SOURCE_STYLE_CASEY):
-                case(SOURCE_STYLE_CAMELCASE):
-                {
-                        fprintf(Get, "%s%sreturn(Self->%s);\n", Indent, Indent, Attribute);
-                } break;
-                default:
+                char *Colon;
+                char *KeyStart = TokenizerSkipIndentation(Cursor, End);
+                char *Newline = TokenizerScanLine(KeyStart, End, &Colon);
+
+                if(Colon != NULL)
                 {
-                        fprintf(Get, "%s%sreturn(self->%s);\n", Indent, Indent, Attribute);
-                } break;
+                        char *KeyEnd = Colon;
+                        while(KeyEnd > KeyStart && GSCharIsWhitespace(KeyEnd[-1])) KeyEnd--;
+
+                        char *ValueStart = Colon + 1;
+                        char *ValueEnd = Newline;
+                        while(ValueStart < ValueEnd && GSCharIsWhitespace(*ValueStart)) ValueStart++;
+                        while(ValueEnd > ValueStart && GSCharIsWhitespace(ValueEnd[-1])) ValueEnd--;
+
+                        if(KeyEnd > KeyStart)
+                        {
+                                config_line *Line = ConfigLinesPush(Lines);
+                                Line->Indentation = KeyStart - Cursor;
+                                Line->Key = KeyStart;
+                                Line->KeyLength = KeyEnd - KeyStart;
+                                Line->Value = (ValueEnd > ValueStart) ? ValueStart : NULL;
+                                Line->ValueLength = ValueEnd - ValueStart;
+                        }
+                }
+
+                Cursor = Newline + 1;
+                Lines->LineCount++;
         }
-        fprintf(Get, "%s}\n", Indent);
 }
 
 void
-PrintFunctionOutros(FILE *Define, FILE *Init, FILE *Query, FILE *Get)
+ConfigEntriesInit(config_entries *Self, gs_arena *Arena, unsigned int Capacity)
 {
-        char Indent[MaxStringLength];
-        PrintIndent(Indent, 1);
-
-        /* Define */
-        fprintf(Define, "} %s;\n", GConfig.StructName);
-        /* Init */
-        fprintf(Init, "}\n");
-        /* Query */
-        fprintf(Query, "%sreturn(0);\n", Indent);
-        fprintf(Query, "}\n");
-        /* Get */
-        fprintf(Get, "%sreturn(NULL);\n", Indent);
-        fprintf(Get, "}\n");
+        Self->Arena = Arena;
+        Self->Count = 0;
+        Self->Capacity = GSMax(1, Capacity);
+        Self->Entries = (config_entry *)ArenaPush(Arena, sizeof(config_entry) * Self->Capacity);
 }
 
-void
-GenerateSourceFile(gs_buffer *Buffer, char *ConfigFileBaseName)
+void /* Name is copied. */
+ConfigEntriesPush(config_entries *Self, char *Name, unsigned int NameLength, value_type_e Type)
 {
-        char *Key;
-        char *Value;
-        char Temp[MaxStringLength];
-        config_stack ConfigStack;
-        ConfigStackInit(&ConfigStack);
-        char IndentString[MaxStringLength];
-        PrintIndent(IndentString, ConfigStack.Count);
+        if(Self->Count == Self->Capacity)
+        {
+                size_t Size = sizeof(config_entry) * Self->Capacity;
+                Self->Entries = (config_entry *)ArenaResize(Self->Arena, Self->Entries, Size, Size * 2);
+                Self->Capacity *= 2;
+        }
 
-        char *StructDefineFilename = "_struct_define.c";
-        FILE *StructDefine = fopen(StructDefineFilename, "w");
+        config_entry *Entry = &Self->Entries[Self->Count++];
+        Entry->Name = (char *)ArenaPush(Self->Arena, NameLength);
+        memcpy(Entry->Name, Name, NameLength);
+        Entry->NameLength = NameLength;
+        Entry->Type = Type;
+}
+
+/******************************************************************************
+ * Typed Values
+ *-----------------------------------------------------------------------------
+ * With --typed, values that read as an integer, a decimal number or a
+ * boolean are parsed here and emitted into int64_t, double and bool fields.
+ * A value may start with a type tag to override inference, eg.:
+ *     version: !!string 2.0
+ *     ratio:   !!float 1
+ * An explicit tag whose value doesn't parse is an error.
+ ******************************************************************************/
 
-        char *StructInitFilename = "_struct_init.c";
-        FILE *StructInit = fopen(StructInitFilename, "w");
+char *ValueTypeTags[VALUE_TYPE_COUNT] = { "!!string", "!!int", "!!float", "!!bool" };
+char *ValueTypeConstants[VALUE_TYPE_COUNT] = { "type_string", "type_int", "type_float", "type_bool" };
+char *ValueTypeFields[VALUE_TYPE_COUNT] = { "char *", "int64_t ", "double ", "bool " };
 
-        char *StructQueryFilename = "_struct_query.c";
-        FILE *StructQuery = fopen(StructQueryFilename, "w");
+gs_bool /* Whether Text is [+-]digits[.digits][(e|E)[+-]digits], with a digit somewhere before any exponent. */
+ValueIsDecimal(char *Text, gs_bool *HasFraction)
+{
+        char *Cursor = Text;
+        unsigned int Digits = 0;
+        *HasFraction = false;
 
-        char *StructGetFilename = "_struct_get.c";
-        FILE *StructGet = fopen(StructGetFilename, "w");
+        if(*Cursor == '+' || *Cursor == '-') Cursor++;
+        for(; GSCharIsDecimal(*Cursor); Cursor++) Digits++;
+        if(*Cursor == '.')
+        {
+                *HasFraction = true;
+                for(Cursor++; GSCharIsDecimal(*Cursor); Cursor++) Digits++;
+        }
+        if(Digits == 0) return(false);
 
-        PrintFunctionIntros(StructDefine, StructInit, StructQuery, StructGet);
+        if(*Cursor == 'e' || *Cursor == 'E')
+        {
+                *HasFraction = true;
+                Cursor++;
+                if(*Cursor == '+' || *Cursor == '-') Cursor++;
+                if(!GSCharIsDecimal(*Cursor)) return(false);
+                while(GSCharIsDecimal(*Cursor)) Cursor++;
+        }
 
-        while(true)
+        return(*Cursor == '\0');
+}
+
+gs_bool /* Parses Text as Type, writing it as C source into Self->Literal. */
+TypedValueParseAs(typed_value *Self, char *Text, value_type_e Type)
+{
+        gs_bool HasFraction;
+        int Length = -1;
+
+        switch(Type)
         {
-                if(GSBufferIsEOF(Buffer))
+                case(VALUE_TYPE_BOOL):
+                {
+                        if(GSStringIsEqual("true", Text, GSStringLength("true") + 1))
+                                Length = snprintf(Self->Literal, sizeof(Self->Literal), "true");
+                        else if(GSStringIsEqual("false", Text, GSStringLength("false") + 1))
+                                Length = snprintf(Self->Literal, sizeof(Self->Literal), "false");
+                } break;
+                case(VALUE_TYPE_INT):
+                {
+                        if(!ValueIsDecimal(Text, &HasFraction) || HasFraction) break;
+                        errno = 0;
+                        long long Int = strtoll(Text, NULL, 10);
+                        if(errno == ERANGE) break;
+                        /* -9223372036854775808 would be the negation of an out of range literal. */
+                        if(Int == LLONG_MIN) Length = snprintf(Self->Literal, sizeof(Self->Literal), "INT64_MIN");
+                        else                 Length = snprintf(Self->Literal, sizeof(Self->Literal), "%lld", Int);
+                } break;
+                case(VALUE_TYPE_FLOAT):
                 {
-                        if(ConfigStack.Count > 0)
+                        if(!ValueIsDecimal(Text, &HasFraction)) break;
+                        double Float = strtod(Text, NULL);
+                        if(!isfinite(Float)) break;
+                        /* The shortest form that reads back as exactly the same double. */
+                        for(int Precision = 15; Precision <= 17; Precision++)
                         {
-                                UnwindNestedStructs(&ConfigStack, 0, StructDefine);
+                                Length = snprintf(Self->Literal, sizeof(Self->Literal), "%.*g", Precision, Float);
+                                if(strtod(Self->Literal, NULL) == Float) break;
                         }
-                        break;
-                }
-
-                /* NOTE(AARON): sscanf doesn't work if doing: sscanf("key:value", %s:%s, Key, Value); */
-                /*              use strtok(...) instead. */
-                /* TODO(AARON): Breaks on URL value because of ':' */
-                char *Colon = strchr(Buffer->Cursor, ':');
-                char *Newline = strchr(Buffer->Cursor, '\n');
-                if(Colon == NULL || Newline < Colon)
-                {
-                        GSBufferNextLine(Buffer);
-                        continue;
-                }
-
-                int Length = Newline - Buffer->Cursor;
-                char *StringDup = (char *)alloca(Length + 1);
-                GSStringCopy(Buffer->Cursor, StringDup, Length);
-                Key = strtok(StringDup, ":\n");
-                Value = strtok(NULL, "\n");
+                } break;
+                default: break;
+        }
 
-                unsigned int StringLength;
-                memset(Temp, 0, MaxStringLength);
-                StringLength = GSMin(GSStringLength(Key), MaxStringLength);
-                GSStringCopy(Key, Temp, StringLength);
-                GSStringTrimWhitespace(Temp, GSStringLength(Temp));
-                GSStringCopy(Temp, Key, StringLength);
+        if(Length < 0) return(false);
+        Self->Type = Type;
+        Self->LiteralLength = Length;
+        return(true);
+}
 
-                int NumSpaces;
-                char Indent[MaxStringLength];
-                PrintIndent(Indent, 1);
+void /* Key is only used to report errors. */
+TypedValueParse(typed_value *Self, config *Config, char *Key, unsigned int KeyLength, char *Value, unsigned int ValueLength)
+{
+        Self->Type = VALUE_TYPE_STRING;
+        Self->Text = Value;
+        Self->TextLength = ValueLength;
+        Self->LiteralLength = 0;
+        if(!Config->IsTyped) return;
 
-                if(Value == NULL)
+        value_type_e Tagged = VALUE_TYPE_COUNT;
+        if(ValueLength > 2 && Value[0] == '!' && Value[1] == '!')
+        {
+                unsigned int TagLength = 0;
+                while(TagLength < ValueLength && !GSCharIsWhitespace(Value[TagLength])) TagLength++;
+                for(int Type = 0; Type < VALUE_TYPE_COUNT; Type++)
                 {
-                        /* Get the indentation level for this nested struct. */
-                        GSBufferSaveCursor(Buffer);
-                        GSBufferNextLine(Buffer);
-                        for(NumSpaces = 0; GSCharIsWhitespace(Buffer->Cursor[NumSpaces]); NumSpaces++);
-                        GSBufferRestoreCursor(Buffer);
-
-                        /* Nested struct definition */
-                        PrintIndent(IndentString, ConfigStack.Count);
-                        ConfigStackAdd(&ConfigStack, Key, NumSpaces);
-                        fprintf(StructDefine, "%s%sstruct\n", IndentString, Indent);
-                        fprintf(StructDefine, "%s%s{\n", IndentString, Indent);
-
-                        /* Advanced and continue with the parsing. */
-                        GSBufferNextLine(Buffer);
-                        continue;
+                        char *Tag = ValueTypeTags[Type];
+                        if(TagLength == GSStringLength(Tag) && GSStringIsEqual(Tag, Value, TagLength)) Tagged = Type;
                 }
+                if(Tagged == VALUE_TYPE_COUNT)
+                        GSAbortWithMessage("Unknown type %.*s for key %.*s\n", TagLength, Value, KeyLength, Key);
 
-                for(NumSpaces = 0; GSCharIsWhitespace(Buffer->Cursor[NumSpaces]); NumSpaces++);
+                while(TagLength < ValueLength && GSCharIsWhitespace(Value[TagLength])) TagLength++;
+                Self->Text = Value + TagLength;
+                Self->TextLength = ValueLength - TagLength;
+        }
+        if(Tagged == VALUE_TYPE_STRING) return;
 
-                if(ConfigStack.Count > 0)
+        /* Anything that could be a number or a boolean fits. */
+        char Text[64];
+        gs_bool Parsed = false;
+        if(Self->TextLength < sizeof(Text))
+        {
+                memcpy(Text, Self->Text, Self->TextLength);
+                Text[Self->TextLength] = '\0';
+                if(Tagged != VALUE_TYPE_COUNT)
                 {
-                        UnwindNestedStructs(&ConfigStack, NumSpaces, StructDefine);
+                        Parsed = TypedValueParseAs(Self, Text, Tagged);
                 }
-
-                PrintIndent(IndentString, ConfigStack.Count);
-                fprintf(StructDefine, "%s%schar *%s;\n", IndentString, Indent, Key);
-                memset(Temp, 0, MaxStringLength);
-                StringLength = GSMin(GSStringLength(Value), MaxStringLength);
-                GSStringCopy(Value, Temp, StringLength);
-                GSStringTrimWhitespace(Temp, GSStringLength(Temp));
-                GSStringCopy(Temp, Value, StringLength);
-
-                char CompoundName[MaxStringLength];
-                char *CompoundNamePtr = CompoundName;
-                if(ConfigStack.Count > 0)
+                else
                 {
-                        for(int i=0; i<ConfigStack.Count; i++)
+                        gs_bool HasFraction;
+                        Parsed = TypedValueParseAs(Self, Text, VALUE_TYPE_BOOL) || TypedValueParseAs(Self, Text, VALUE_TYPE_INT);
+                        /* Only a fraction or an exponent makes a float, so an out of range integer stays a string. */
+                        if(!Parsed && ValueIsDecimal(Text, &HasFraction) && HasFraction)
                         {
-                                char *CurrentName = ConfigStackNameAt(&ConfigStack, i);
-                                int StringLength = GSStringLength(CurrentName);
-                                sprintf(CompoundNamePtr, "%s.", CurrentName);
-                                CompoundNamePtr = CompoundNamePtr + StringLength + 1;
+                                Parsed = TypedValueParseAs(Self, Text, VALUE_TYPE_FLOAT);
                         }
                 }
-                GSStringCopy(Key, CompoundNamePtr, GSStringLength(Key));
-                PrintFunctionSource(StructInit, StructQuery, StructGet, CompoundName, Value);
-                GSBufferNextLine(Buffer);
         }
 
-        PrintFunctionOutros(StructDefine, StructInit, StructQuery, StructGet);
+        if(!Parsed && Tagged != VALUE_TYPE_COUNT)
+        {
+                GSAbortWithMessage("%.*s isn't a valid %s for key %.*s\n",
+                                   Self->TextLength, Self->Text, ValueTypeTags[Tagged] + 2, KeyLength, Key);
+        }
+}
+
+/******************************************************************************
+ * Output Sections
+ *-----------------------------------------------------------------------------
+ * Growable in-memory buffers, one per part of the generated source file.
+ * Buffer.Cursor always points at Buffer.Start + Buffer.Length.
+ *
+ * A section is a list of chunks in the arena. When Buffer's chunk is full it
+ * joins the list and a new one is started, so growing never copies text or
+ * leaves a dead buffer behind. Chunks double up to SectionChunkLimit.
+ *
+ * Everything is emitted through the Emit* functions below, which append
+ * strings, spans and integers directly without parsing a format string.
+ * Indentation for every depth is served from one precomputed run of spaces.
+ ******************************************************************************/
+
+#define EmitLiteral(Section, String) EmitSpan((Section), (String), sizeof(String) - 1)
+#define SectionChunkLimit (1024 * 1024)
+
+void
+IndentationInit(indentation *Self, gs_arena *Arena, unsigned int Width)
+{
+        Self->Arena = Arena;
+        Self->Width = Width;
+        Self->Levels = 16;
+        Self->Spaces = (char *)ArenaPush(Arena, Width * Self->Levels);
+        memset(Self->Spaces, ' ', Width * Self->Levels);
+}
+
+void /* Capacity is the first chunk's, up to SectionChunkLimit. */
+SectionInit(section *Self, gs_arena *Arena, indentation *Indentation, size_t Capacity)
+{
+        Capacity = GSMin(Capacity, SectionChunkLimit);
+        Self->Arena = Arena;
+        Self->Indentation = Indentation;
+        Self->First = NULL;
+        Self->Last = NULL;
+        Self->FullLength = 0;
+        GSBufferInit(&Self->Buffer, (char *)ArenaPush(Arena, Capacity), Capacity);
+}
+
+size_t
+SectionLength(section *Self)
+{
+        return(Self->FullLength + Self->Buffer.Length);
+}
+
+void /* Ensures at least Wanted contiguous bytes are free after Cursor, starting a new chunk if need be. */
+SectionReserve(section *Self, size_t Wanted)
+{
+        gs_buffer *Buffer = &Self->Buffer;
+        if(Buffer->Length + Wanted <= Buffer->Capacity) return;
+
+        if(Buffer->Length > 0)
+        {
+                section_chunk *Chunk = (section_chunk *)ArenaPush(Self->Arena, sizeof(section_chunk));
+                Chunk->Start = Buffer->Start;
+                Chunk->Length = Buffer->Length;
+                Chunk->Next = NULL;
+                if(Self->Last != NULL) Self->Last->Next = Chunk;
+                else                   Self->First = Chunk;
+                Self->Last = Chunk;
+                Self->FullLength += Buffer->Length;
+        }
+
+        size_t Capacity = GSMax(Wanted, GSMin(Buffer->Capacity * 2, SectionChunkLimit));
+        GSBufferInit(Buffer, (char *)ArenaPush(Self->Arena, Capacity), Capacity);
+}
+
+void
+EmitSpan(section *Self, char *Bytes, size_t Length)
+{
+        SectionReserve(Self, Length);
+        memcpy(Self->Buffer.Cursor, Bytes, Length);
+        Self->Buffer.Cursor += Length;
+        Self->Buffer.Length += Length;
+}
+
+void
+EmitString(section *Self, char *String)
+{
+        EmitSpan(Self, String, GSStringLength(String));
+}
+
+void
+EmitUnsigned(section *Self, unsigned long Value)
+{
+        char Digits[24];
+        char *Cursor = Digits + sizeof(Digits);
+        do
+        {
+                *--Cursor = '0' + (Value % 10);
+                Value /= 10;
+        }
+        while(Value != 0);
+
+        EmitSpan(Self, Cursor, (Digits + sizeof(Digits)) - Cursor);
+}
+
+void
+EmitIndent(section *Self, unsigned int Level)
+{
+        indentation *Indentation = Self->Indentation;
+        if(Level > Indentation->Levels)
+        {
+                unsigned int Levels = Indentation->Levels;
+                while(Levels < Level) Levels *= 2;
+                Indentation->Spaces = (char *)ArenaResize(Indentation->Arena, Indentation->Spaces,
+                                                          Indentation->Width * Indentation->Levels,
+                                                          Indentation->Width * Levels);
+                memset(Indentation->Spaces, ' ', Indentation->Width * Levels);
+                Indentation->Levels = Levels;
+        }
+
+        EmitSpan(Self, Indentation->Spaces, Level * Indentation->Width);
+}
+
+unsigned int /* Resultant ConfigStack depth. Nothing is emitted if StructDefine is NULL. */
+UnwindNestedStructs(config_stack *ConfigStack, unsigned int NumSpaces, section *StructDefine)
+{
+        int StructIndex = -1;
+        for(unsigned int I = 0; I < ConfigStack->Count; I++)
+        {
+                int Indentation = ConfigStackIndentationAt(ConfigStack, I);
+                if(-1 == Indentation) GSAbortWithMessage("This is unexpected!\n");
+
+                if(NumSpaces == (unsigned int)Indentation)
+                {
+                        StructIndex = (int)I;
+                        break;
+                }
+        }
+
+        if(-1 == StructIndex && NumSpaces != 0) GSAbortWithMessage("This is unexpected!\n");
+
+        for(int I = ConfigStack->Count - 1; I > StructIndex; I--)
+        {
+                if(StructDefine == NULL)
+                {
+                        ConfigStackDrop(ConfigStack);
+                        continue;
+                }
+
+                unsigned int NameLength = 0;
+                char *StructName = ConfigStackNameAt(ConfigStack, I, &NameLength);
+                EmitIndent(StructDefine, ConfigStack->Count);
+                EmitLiteral(StructDefine, "} ");
+                EmitSpan(StructDefine, StructName, NameLength);
+                EmitLiteral(StructDefine, ";\n");
+                ConfigStackDrop(ConfigStack);
+        }
+
+        return(ConfigStack->Count);
+}
+
+gs_bool /* Whether LOOKUP_CHAIN is emitted key by key with the init; a profile's order needs every key first. */
+ConfigStreamsChain(config *Self)
+{
+        return(Self->Lookup == LOOKUP_CHAIN && Self->ProfileFile == NULL);
+}
+
+gs_bool /* Whether generated identifiers are capitalized, eg.: Self rather than self. */
+ConfigIsCapitalized(config *Self)
+{
+        return(Self->SourceStyle == SOURCE_STYLE_CASEY ||
+               Self->SourceStyle == SOURCE_STYLE_CAMELCASE);
+}
+
+/* Emits whichever of two spellings of the same code matches the configured style. */
+#define EmitCased(Section, Config, Capitalized, Lowercase) \
+        (ConfigIsCapitalized(Config) ? EmitLiteral((Section), Capitalized) : EmitLiteral((Section), Lowercase))
+
+void /* Emits a generated function or table name, prefixed for the configured style. */
+PrintFunctionName(config *Config, section *Section, char *CamelName, char *SnakeName, char *CName)
+{
+        switch(Config->SourceStyle)
+        {
+                case(SOURCE_STYLE_CAMELCASE):
+                case(SOURCE_STYLE_CASEY):
+                {
+                        EmitString(Section, Config->FunctionPrefix);
+                        EmitString(Section, CamelName);
+                } break;
+                case(SOURCE_STYLE_SNAKECASE):
+                {
+                        EmitString(Section, Config->StructName);
+                        EmitString(Section, SnakeName);
+                } break;
+                default:
+                {
+                        EmitString(Section, Config->StructName);
+                        EmitString(Section, CName);
+                } break;
+        }
+}
+
+void /* Emits "Name(const StructName *Self, Parameters)" for the configured style. Parameters may be NULL. */
+PrintFunctionSignature(config *Config, section *Section, char *CamelName, char *SnakeName, char *CName,
+                       char *CapitalizedParameters, char *LowercaseParameters)
+{
+        PrintFunctionName(Config, Section, CamelName, SnakeName, CName);
+
+        EmitLiteral(Section, "(const ");
+        EmitString(Section, Config->StructName);
+        EmitCased(Section, Config, " *Self", " *self");
+        if(CapitalizedParameters != NULL)
+        {
+                EmitLiteral(Section, ", ");
+                EmitString(Section, ConfigIsCapitalized(Config) ? CapitalizedParameters : LowercaseParameters);
+        }
+        EmitLiteral(Section, ")\n");
+}
+
+void /* Emits the storage class of a generated function. Helpers are static, and with --header so is everything else. */
+PrintLinkage(config *Config, section *Section, gs_bool IsHelper)
+{
+        if(Config->IsHeader) EmitLiteral(Section, "static inline ");
+        else if(IsHelper)    EmitLiteral(Section, "static ");
+}
+
+size_t /* Returns where a signature for PrintImplementationIntro begins, with room to keep it in Section's current chunk. */
+PrintImplementationBegin(config *Config, section *Section)
+{
+        SectionReserve(Section, 256 + 4 * GSStringLength(Config->StructName));
+        return(Section->Buffer.Length);
+}
+
+void /* With --header, declares the function whose signature Section holds from Begin, then guards its definition. */
+PrintImplementationIntro(config *Config, section *Section, size_t Begin)
+{
+        if(!Config->IsHeader) return;
+
+        /* "Type\nName(Parameters)\n" is declared as "Type Name(Parameters);\n", then repeated to open the definition. */
+        gs_buffer *Buffer = &Section->Buffer;
+        size_t Length = Buffer->Length - Begin;
+        char *Signature = (char *)ArenaPush(Section->Arena, Length);
+        memcpy(Signature, Buffer->Start + Begin, Length);
+        Buffer->Cursor = Buffer->Start + Begin;
+        Buffer->Length = Begin;
+
+        size_t TypeLength = (char *)memchr(Signature, '\n', Length) - Signature;
+        EmitSpan(Section, Signature, TypeLength);
+        EmitLiteral(Section, " ");
+        EmitSpan(Section, Signature + TypeLength + 1, Length - TypeLength - 2);
+        EmitLiteral(Section, ";\n");
+        EmitLiteral(Section, "#if defined(GSCFG_IMPLEMENTATION)\n");
+        EmitSpan(Section, Signature, Length);
+}
+
+void /* Closes PrintImplementationIntro's guard. */
+PrintImplementationOutro(config *Config, section *Section)
+{
+        if(Config->IsHeader) EmitLiteral(Section, "#endif\n");
+}
+
+void /* Emits Name as a key constant, eg.: "profile.icon" becomes SETTINGS_PROFILE_ICON. */
+PrintKeyConstant(config *Config, section *Section, char *Name, unsigned int NameLength)
+{
+        unsigned int StructNameLength = GSStringLength(Config->StructName);
+        SectionReserve(Section, StructNameLength + 1 + NameLength);
+
+        char *Cursor = Section->Buffer.Cursor;
+        for(unsigned int I = 0; I < StructNameLength; I++) *Cursor++ = GSCharUpcase(Config->StructName[I]);
+        *Cursor++ = '_';
+        for(unsigned int I = 0; I < NameLength; I++)
+        {
+                *Cursor++ = (Name[I] == '.') ? '_' : GSCharUpcase(Name[I]);
+        }
+
+        Section->Buffer.Length += Cursor - Section->Buffer.Cursor;
+        Section->Buffer.Cursor = Cursor;
+}
+
+/*
+  Emits a constant that isn't a key's, eg.: "key_count" becomes settings_key_count.
+  Key constants are all upper case, so a name with a lower case letter can't clash with one.
+*/
+void
+PrintReservedConstant(config *Config, section *Section, char *Name)
+{
+        EmitString(Section, Config->StructName);
+        EmitLiteral(Section, "_");
+        EmitString(Section, Name);
+}
+
+void /* Emits one LOOKUP_CHAIN check, returning Name's key constant if String[0, Length) is Name. */
+PrintChainCompare(config *Config, section *Section, char *Name, unsigned int NameLength)
+{
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "if(Length == ", "if(length == ");
+        EmitUnsigned(Section, NameLength);
+        EmitCased(Section, Config, " && memcmp(String, \"", " && memcmp(string, \"");
+        EmitSpan(Section, Name, NameLength);
+        EmitLiteral(Section, "\", ");
+        EmitUnsigned(Section, NameLength);
+        EmitLiteral(Section, ") == 0)\n");
+        EmitIndent(Section, 1);
+        EmitLiteral(Section, "{\n");
+        EmitIndent(Section, 2);
+        EmitLiteral(Section, "return(");
+        PrintKeyConstant(Config, Section, Name, NameLength);
+        EmitLiteral(Section, ");\n");
+        EmitIndent(Section, 1);
+        EmitLiteral(Section, "}\n");
+}
+
+void /* Emits the head of _key_id_n, which returns the key constant for String[0, Length) or -1. */
+PrintKeyIdIntro(config *Config, section *Section)
+{
+        PrintLinkage(Config, Section, false);
+        EmitLiteral(Section, "int\n");
+        PrintFunctionName(Config, Section, "KeyIdN", "_key_id_n", "keyidn");
+        EmitCased(Section, Config, "(const char *String, size_t Length)\n{\n", "(const char *string, size_t length)\n{\n");
+
+        /* A hash miss is already one probe, but every other lookup does the most work on a miss. */
+        if(Config->Lookup == LOOKUP_HASH) return;
+        EmitIndent(Section, 1);
+        EmitLiteral(Section, "if(!");
+        PrintFunctionName(Config, Section, "MayHaveKey", "_may_have_key", "mayhavekey");
+        EmitCased(Section, Config, "(String, Length))\n", "(string, length))\n");
+        EmitIndent(Section, 1);
+        EmitLiteral(Section, "{\n");
+        EmitIndent(Section, 2);
+        EmitLiteral(Section, "return(-1);\n");
+        EmitIndent(Section, 1);
+        EmitLiteral(Section, "}\n");
+}
+
+void /* Emits "return(Name(Self, String, strlen(String)Rest));", calling the _n variant of a lookup. */
+PrintLengthWrapperBody(config *Config, section *Section, char *CamelName, char *SnakeName, char *CName,
+                       gs_bool HasSelf, char *CapitalizedRest, char *LowercaseRest)
+{
+        EmitIndent(Section, 1);
+        EmitLiteral(Section, "return(");
+        PrintFunctionName(Config, Section, CamelName, SnakeName, CName);
+        EmitLiteral(Section, "(");
+        if(HasSelf) EmitCased(Section, Config, "Self, ", "self, ");
+        EmitCased(Section, Config, "String, strlen(String)", "string, strlen(string)");
+        EmitString(Section, ConfigIsCapitalized(Config) ? CapitalizedRest : LowercaseRest);
+        EmitLiteral(Section, "));\n");
+        EmitLiteral(Section, "}\n");
+}
+
+void /* With --instrument, emits the counting of a lookup whose result is in Id. */
+PrintCountLookup(config *Config, section *Section, unsigned int Level)
+{
+        if(!Config->IsInstrumented) return;
+
+        EmitIndent(Section, Level);
+        EmitCased(Section, Config, "if(Id < 0) ", "if(id < 0) ");
+        PrintFunctionName(Config, Section, "Count", "_count", "count");
+        EmitLiteral(Section, "(");
+        PrintFunctionName(Config, Section, "Misses", "_misses", "misses");
+        EmitLiteral(Section, ");\n");
+        EmitIndent(Section, Level);
+        EmitLiteral(Section, "else ");
+        PrintFunctionName(Config, Section, "Count", "_count", "count");
+        EmitLiteral(Section, "(");
+        PrintFunctionName(Config, Section, "Hits", "_hits", "hits");
+        EmitCased(Section, Config, "[Id]);\n", "[id]);\n");
+}
+
+void /* Emits a getter that stores a Type value and returns whether String named a key of that Type. */
+PrintTypedGetter(config *Config, section *Section, value_type_e Type, char *CamelName, char *SnakeName, char *CName)
+{
+        char *Field = ValueTypeFields[Type];
+
+        PrintLinkage(Config, Section, false);
+        EmitLiteral(Section, "unsigned int\n");
+        PrintFunctionName(Config, Section, CamelName, SnakeName, CName);
+        EmitLiteral(Section, "(const ");
+        EmitString(Section, Config->StructName);
+        EmitCased(Section, Config, " *Self, char *String, ", " *self, char *string, ");
+        EmitString(Section, Field);
+        EmitCased(Section, Config, "*Value)\n{\n", "*value)\n{\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "int Id = ", "int id = ");
+        PrintFunctionName(Config, Section, "KeyId", "_key_id", "keyid");
+        EmitCased(Section, Config, "(String);\n", "(string);\n");
+        PrintCountLookup(Config, Section, 1);
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "if(Id < 0 || ", "if(id < 0 || ");
+        PrintFunctionName(Config, Section, "Types", "_types", "types");
+        EmitCased(Section, Config, "[Id] != ", "[id] != ");
+        PrintReservedConstant(Config, Section, ValueTypeConstants[Type]);
+        EmitLiteral(Section, ")\n");
+        EmitIndent(Section, 1);
+        EmitLiteral(Section, "{\n");
+        EmitIndent(Section, 2);
+        EmitLiteral(Section, "return(0);\n");
+        EmitIndent(Section, 1);
+        EmitLiteral(Section, "}\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "*Value = *(const ", "*value = *(const ");
+        EmitString(Section, Field);
+        EmitCased(Section, Config, "*)((const char *)Self + ", "*)((const char *)self + ");
+        PrintFunctionName(Config, Section, "Offsets", "_offsets", "offsets");
+        EmitCased(Section, Config, "[Id]);\n", "[id]);\n");
+        EmitIndent(Section, 1);
+        EmitLiteral(Section, "return(!0);\n");
+        EmitLiteral(Section, "}\n");
+}
+
+void /* Emits _key_id, _get_by_id, _find, _has_key, _get and _visit, all in terms of _key_id_n and the tables. */
+PrintLookupAccessors(config *Config, section *Section)
+{
+        /* Key Id */
+        PrintLinkage(Config, Section, false);
+        EmitLiteral(Section, "int\n");
+        PrintFunctionName(Config, Section, "KeyId", "_key_id", "keyid");
+        EmitCased(Section, Config, "(char *String)\n{\n", "(char *string)\n{\n");
+        PrintLengthWrapperBody(Config, Section, "KeyIdN", "_key_id_n", "keyidn", false, "", "");
+
+        /* Get By Id */
+        PrintLinkage(Config, Section, false);
+        EmitLiteral(Section, "char *\n");
+        PrintFunctionSignature(Config, Section, "GetById", "_get_by_id", "getbyid", "int Id", "int id");
+        EmitLiteral(Section, "{\n");
+        if(Config->IsTyped)
+        {
+                /* Only string values can be returned as one. */
+                EmitIndent(Section, 1);
+                EmitLiteral(Section, "if(");
+                PrintFunctionName(Config, Section, "Types", "_types", "types");
+                EmitCased(Section, Config, "[Id] != ", "[id] != ");
+                PrintReservedConstant(Config, Section, "type_string");
+                EmitLiteral(Section, ")\n");
+                EmitIndent(Section, 1);
+                EmitLiteral(Section, "{\n");
+                EmitIndent(Section, 2);
+                EmitLiteral(Section, "return(NULL);\n");
+                EmitIndent(Section, 1);
+                EmitLiteral(Section, "}\n");
+        }
+        EmitIndent(Section, 1);
+        if(Config->Layout == LAYOUT_COMPACT)
+        {
+                EmitLiteral(Section, "return((char *)");
+                PrintFunctionName(Config, Section, "Blob", "_blob", "blob");
+                EmitCased(Section, Config, " + *(const uint32_t *)((const char *)Self + ",
+                          " + *(const uint32_t *)((const char *)self + ");
+        }
+        else
+        {
+                EmitCased(Section, Config, "return(*(char * const *)((const char *)Self + ",
+                          "return(*(char * const *)((const char *)self + ");
+        }
+        PrintFunctionName(Config, Section, "Offsets", "_offsets", "offsets");
+        EmitCased(Section, Config, "[Id]));\n", "[id]));\n");
+        EmitLiteral(Section, "}\n");
+
+        /* Find */
+        PrintLinkage(Config, Section, false);
+        EmitLiteral(Section, "unsigned int\n");
+        PrintFunctionSignature(Config, Section, "FindN", "_find_n", "findn",
+                               "const char *String, size_t Length, char **Value",
+                               "const char *string, size_t length, char **value");
+        EmitLiteral(Section, "{\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "int Id = ", "int id = ");
+        PrintFunctionName(Config, Section, "KeyIdN", "_key_id_n", "keyidn");
+        EmitCased(Section, Config, "(String, Length);\n", "(string, length);\n");
+        PrintCountLookup(Config, Section, 1);
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "if(Id < 0)\n", "if(id < 0)\n");
+        EmitIndent(Section, 1);
+        EmitLiteral(Section, "{\n");
+        EmitIndent(Section, 2);
+        EmitLiteral(Section, "return(0);\n");
+        EmitIndent(Section, 1);
+        EmitLiteral(Section, "}\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "*Value = ", "*value = ");
+        PrintFunctionName(Config, Section, "GetById", "_get_by_id", "getbyid");
+        EmitCased(Section, Config, "(Self, Id);\n", "(self, id);\n");
+        EmitIndent(Section, 1);
+        if(Config->IsTyped) EmitCased(Section, Config, "return(*Value != NULL);\n", "return(*value != NULL);\n");
+        else                EmitLiteral(Section, "return(!0);\n");
+        EmitLiteral(Section, "}\n");
+
+        PrintLinkage(Config, Section, false);
+        EmitLiteral(Section, "unsigned int\n");
+        PrintFunctionSignature(Config, Section, "Find", "_find", "find",
+                               "char *String, char **Value", "char *string, char **value");
+        EmitLiteral(Section, "{\n");
+        PrintLengthWrapperBody(Config, Section, "FindN", "_find_n", "findn", true, ", Value", ", value");
+
+        /* Has Key */
+        PrintLinkage(Config, Section, false);
+        EmitLiteral(Section, "unsigned int\n");
+        PrintFunctionSignature(Config, Section, "HasKeyN", "_has_key_n", "haskeyn",
+                               "const char *String, size_t Length", "const char *string, size_t length");
+        EmitLiteral(Section, "{\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "(void)Self;\n", "(void)self;\n");
+        if(Config->IsInstrumented)
+        {
+                EmitIndent(Section, 1);
+                EmitCased(Section, Config, "int Id = ", "int id = ");
+                PrintFunctionName(Config, Section, "KeyIdN", "_key_id_n", "keyidn");
+                EmitCased(Section, Config, "(String, Length);\n", "(string, length);\n");
+                PrintCountLookup(Config, Section, 1);
+                EmitIndent(Section, 1);
+                EmitCased(Section, Config, "return(Id >= 0);\n", "return(id >= 0);\n");
+        }
+        else
+        {
+                EmitIndent(Section, 1);
+                EmitLiteral(Section, "return(");
+                PrintFunctionName(Config, Section, "KeyIdN", "_key_id_n", "keyidn");
+                EmitCased(Section, Config, "(String, Length) >= 0);\n", "(string, length) >= 0);\n");
+        }
+        EmitLiteral(Section, "}\n");
+
+        PrintLinkage(Config, Section, false);
+        EmitLiteral(Section, "unsigned int\n");
+        PrintFunctionSignature(Config, Section, "HasKey", "_has_key", "haskey", "char *String", "char *string");
+        EmitLiteral(Section, "{\n");
+        PrintLengthWrapperBody(Config, Section, "HasKeyN", "_has_key_n", "haskeyn", true, "", "");
+
+        /* Get */
+        PrintLinkage(Config, Section, false);
+        EmitLiteral(Section, "char *\n");
+        PrintFunctionSignature(Config, Section, "GetN", "_get_n", "getn",
+                               "const char *String, size_t Length", "const char *string, size_t length");
+        EmitLiteral(Section, "{\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "char *Value = NULL;\n", "char *value = NULL;\n");
+        EmitIndent(Section, 1);
+        PrintFunctionName(Config, Section, "FindN", "_find_n", "findn");
+        EmitCased(Section, Config, "(Self, String, Length, &Value);\n", "(self, string, length, &value);\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "return(Value);\n", "return(value);\n");
+        EmitLiteral(Section, "}\n");
+
+        PrintLinkage(Config, Section, false);
+        EmitLiteral(Section, "char *\n");
+        PrintFunctionSignature(Config, Section, "Get", "_get", "get", "char *String", "char *string");
+        EmitLiteral(Section, "{\n");
+        PrintLengthWrapperBody(Config, Section, "GetN", "_get_n", "getn", true, "", "");
+
+        /* Visit */
+        size_t Begin = PrintImplementationBegin(Config, Section);
+        EmitLiteral(Section, "int\n");
+        PrintFunctionName(Config, Section, "Visit", "_visit", "visit");
+        EmitLiteral(Section, "(const ");
+        EmitString(Section, Config->StructName);
+        EmitCased(Section, Config, " *Self, ", " *self, ");
+        EmitString(Section, Config->StructName);
+        EmitCased(Section, Config, "_visitor Visit, void *Context)\n", "_visitor visit, void *context)\n");
+        PrintImplementationIntro(Config, Section, Begin);
+        EmitLiteral(Section, "{\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "for(int I = 0; I < ", "for(int i = 0; i < ");
+        PrintReservedConstant(Config, Section, "key_count");
+        EmitCased(Section, Config, "; I++)\n", "; i++)\n");
+        EmitIndent(Section, 1);
+        EmitLiteral(Section, "{\n");
+        EmitIndent(Section, 2);
+        EmitLiteral(Section, "const ");
+        EmitString(Section, Config->StructName);
+        EmitCased(Section, Config, "_descriptor *Descriptor = &", "_descriptor *descriptor = &");
+        PrintFunctionName(Config, Section, "Descriptors", "_descriptors", "descriptors");
+        EmitCased(Section, Config, "[I];\n", "[i];\n");
+        EmitIndent(Section, 2);
+        EmitCased(Section, Config,
+                  "int Result = Visit(Descriptor, (const char *)Self + Descriptor->Offset, Context);\n",
+                  "int result = visit(descriptor, (const char *)self + descriptor->offset, context);\n");
+        EmitIndent(Section, 2);
+        EmitCased(Section, Config, "if(Result != 0)\n", "if(result != 0)\n");
+        EmitIndent(Section, 2);
+        EmitLiteral(Section, "{\n");
+        EmitIndent(Section, 3);
+        EmitCased(Section, Config, "return(Result);\n", "return(result);\n");
+        EmitIndent(Section, 2);
+        EmitLiteral(Section, "}\n");
+        EmitIndent(Section, 1);
+        EmitLiteral(Section, "}\n");
+        EmitIndent(Section, 1);
+        EmitLiteral(Section, "return(0);\n");
+        EmitLiteral(Section, "}\n");
+        PrintImplementationOutro(Config, Section);
+
+        if(Config->IsTyped)
+        {
+                PrintTypedGetter(Config, Section, VALUE_TYPE_INT, "GetInt", "_get_int", "getint");
+                PrintTypedGetter(Config, Section, VALUE_TYPE_FLOAT, "GetFloat", "_get_float", "getfloat");
+                PrintTypedGetter(Config, Section, VALUE_TYPE_BOOL, "GetBool", "_get_bool", "getbool");
+        }
+}
+
+void /* Emits _subtree, which finds the descriptors under a name, and _child, which finds a key under one. */
+PrintSubtreeAccessors(config *Config, section *Section)
+{
+        /* Lower Bound */
+        PrintLinkage(Config, Section, true);
+        EmitLiteral(Section, "uint32_t /* First of descriptors [Begin, End) not sorting before String then Next, past Skip bytes of each name. No Next if negative. */\n");
+        PrintFunctionName(Config, Section, "LowerBound", "_lower_bound", "lowerbound");
+        EmitCased(Section, Config,
+                  "(uint32_t Begin, uint32_t End, uint32_t Skip, const char *String, size_t Length, int Next)\n{\n",
+                  "(uint32_t begin, uint32_t end, uint32_t skip, const char *string, size_t length, int next)\n{\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "while(Begin < End)\n", "while(begin < end)\n");
+        EmitIndent(Section, 1);
+        EmitLiteral(Section, "{\n");
+        EmitIndent(Section, 2);
+        EmitCased(Section, Config, "uint32_t Middle = Begin + (End - Begin) / 2;\n", "uint32_t middle = begin + (end - begin) / 2;\n");
+        EmitIndent(Section, 2);
+        EmitLiteral(Section, "const ");
+        EmitString(Section, Config->StructName);
+        EmitCased(Section, Config, "_descriptor *Descriptor = &", "_descriptor *descriptor = &");
+        PrintFunctionName(Config, Section, "Descriptors", "_descriptors", "descriptors");
+        EmitCased(Section, Config, "[Middle];\n", "[middle];\n");
+        EmitIndent(Section, 2);
+        EmitCased(Section, Config, "const char *Name = ", "const char *name = ");
+        PrintFunctionName(Config, Section, "Names", "_names", "names");
+        EmitCased(Section, Config, " + Descriptor->Name + Skip;\n", " + descriptor->name + skip;\n");
+        EmitIndent(Section, 2);
+        EmitCased(Section, Config, "size_t Rest = Descriptor->Length - Skip;\n", "size_t rest = descriptor->length - skip;\n");
+        EmitIndent(Section, 2);
+        EmitCased(Section, Config,
+                  "int Order = memcmp(Name, String, (Rest < Length) ? Rest : Length);\n",
+                  "int order = memcmp(name, string, (rest < length) ? rest : length);\n");
+        EmitIndent(Section, 2);
+        EmitCased(Section, Config,
+                  "if(Order == 0 && Rest > Length && Next >= 0) Order = (unsigned char)Name[Length] - Next;\n",
+                  "if(order == 0 && rest > length && next >= 0) order = (unsigned char)name[length] - next;\n");
+        EmitIndent(Section, 2);
+        EmitCased(Section, Config,
+                  "else if(Order == 0 && (Rest < Length || (Rest == Length && Next >= 0))) Order = -1;\n",
+                  "else if(order == 0 && (rest < length || (rest == length && next >= 0))) order = -1;\n");
+        EmitIndent(Section, 2);
+        EmitCased(Section, Config, "if(Order < 0) Begin = Middle + 1;\n", "if(order < 0) begin = middle + 1;\n");
+        EmitIndent(Section, 2);
+        EmitCased(Section, Config, "else End = Middle;\n", "else end = middle;\n");
+        EmitIndent(Section, 1);
+        EmitLiteral(Section, "}\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "return(Begin);\n", "return(begin);\n");
+        EmitLiteral(Section, "}\n");
+
+        /* Subtree; every name under String starts with String and '.', so they're all between that and String and '/'. */
+        PrintLinkage(Config, Section, false);
+        EmitString(Section, Config->StructName);
+        EmitLiteral(Section, "_node\n");
+        PrintFunctionName(Config, Section, "SubtreeN", "_subtree_n", "subtreen");
+        EmitCased(Section, Config, "(const char *String, size_t Length)\n{\n", "(const char *string, size_t length)\n{\n");
+        EmitIndent(Section, 1);
+        EmitString(Section, Config->StructName);
+        EmitCased(Section, Config, "_node Node = { 0, ", "_node node = { 0, ");
+        PrintReservedConstant(Config, Section, "key_count");
+        EmitLiteral(Section, ", 0 };\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "if(Length == 0)\n", "if(length == 0)\n");
+        EmitIndent(Section, 1);
+        EmitLiteral(Section, "{\n");
+        EmitIndent(Section, 2);
+        EmitCased(Section, Config, "return(Node);\n", "return(node);\n");
+        EmitIndent(Section, 1);
+        EmitLiteral(Section, "}\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "Node.Begin = ", "node.begin = ");
+        PrintFunctionName(Config, Section, "LowerBound", "_lower_bound", "lowerbound");
+        EmitCased(Section, Config, "(0, Node.End, 0, String, Length, '.');\n", "(0, node.end, 0, string, length, '.');\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "Node.End = ", "node.end = ");
+        PrintFunctionName(Config, Section, "LowerBound", "_lower_bound", "lowerbound");
+        EmitCased(Section, Config, "(Node.Begin, Node.End, 0, String, Length, '/');\n",
+                  "(node.begin, node.end, 0, string, length, '/');\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "Node.Length = (uint32_t)Length + 1;\n", "node.length = (uint32_t)length + 1;\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "return(Node);\n", "return(node);\n");
+        EmitLiteral(Section, "}\n");
+
+        PrintLinkage(Config, Section, false);
+        EmitString(Section, Config->StructName);
+        EmitLiteral(Section, "_node\n");
+        PrintFunctionName(Config, Section, "Subtree", "_subtree", "subtree");
+        EmitCased(Section, Config, "(char *String)\n{\n", "(char *string)\n{\n");
+        PrintLengthWrapperBody(Config, Section, "SubtreeN", "_subtree_n", "subtreen", false, "", "");
+
+        /* Child; only names under Parent are searched, and only past Parent's own name. */
+        PrintLinkage(Config, Section, false);
+        EmitLiteral(Section, "int\n");
+        PrintFunctionName(Config, Section, "ChildN", "_child_n", "childn");
+        EmitLiteral(Section, "(");
+        EmitString(Section, Config->StructName);
+        EmitCased(Section, Config, "_node Parent, const char *String, size_t Length)\n{\n",
+                  "_node parent, const char *string, size_t length)\n{\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "uint32_t Index = ", "uint32_t index = ");
+        PrintFunctionName(Config, Section, "LowerBound", "_lower_bound", "lowerbound");
+        EmitCased(Section, Config, "(Parent.Begin, Parent.End, Parent.Length, String, Length, -1);\n",
+                  "(parent.begin, parent.end, parent.length, string, length, -1);\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "if(Index < Parent.End)\n", "if(index < parent.end)\n");
+        EmitIndent(Section, 1);
+        EmitLiteral(Section, "{\n");
+        EmitIndent(Section, 2);
+        EmitLiteral(Section, "const ");
+        EmitString(Section, Config->StructName);
+        EmitCased(Section, Config, "_descriptor *Descriptor = &", "_descriptor *descriptor = &");
+        PrintFunctionName(Config, Section, "Descriptors", "_descriptors", "descriptors");
+        EmitCased(Section, Config, "[Index];\n", "[index];\n");
+        EmitIndent(Section, 2);
+        EmitCased(Section, Config, "if(Descriptor->Length == Parent.Length + Length &&\n",
+                  "if(descriptor->length == parent.length + length &&\n");
+        EmitIndent(Section, 2);
+        EmitCased(Section, Config, "   memcmp(", "   memcmp(");
+        PrintFunctionName(Config, Section, "Names", "_names", "names");
+        EmitCased(Section, Config, " + Descriptor->Name + Parent.Length, String, Length) == 0)\n",
+                  " + descriptor->name + parent.length, string, length) == 0)\n");
+        EmitIndent(Section, 2);
+        EmitLiteral(Section, "{\n");
+        EmitIndent(Section, 3);
+        EmitCased(Section, Config, "return(Descriptor->Id);\n", "return(descriptor->id);\n");
+        EmitIndent(Section, 2);
+        EmitLiteral(Section, "}\n");
+        EmitIndent(Section, 1);
+        EmitLiteral(Section, "}\n");
+        EmitIndent(Section, 1);
+        EmitLiteral(Section, "return(-1);\n");
+        EmitLiteral(Section, "}\n");
+
+        PrintLinkage(Config, Section, false);
+        EmitLiteral(Section, "int\n");
+        PrintFunctionName(Config, Section, "Child", "_child", "child");
+        EmitLiteral(Section, "(");
+        EmitString(Section, Config->StructName);
+        EmitCased(Section, Config, "_node Parent, char *String)\n{\n", "_node parent, char *string)\n{\n");
+        EmitIndent(Section, 1);
+        EmitLiteral(Section, "return(");
+        PrintFunctionName(Config, Section, "ChildN", "_child_n", "childn");
+        EmitCased(Section, Config, "(Parent, String, strlen(String)));\n", "(parent, string, strlen(string)));\n");
+        EmitLiteral(Section, "}\n");
+}
+
+void /* Emits the body of _get_many's loop over Strings[I], storing the value of key Id, or NULL, in Values[I]. */
+PrintBatchStore(config *Config, section *Section, unsigned int Level)
+{
+        PrintCountLookup(Config, Section, Level);
+        EmitIndent(Section, Level);
+        EmitCased(Section, Config, "Values[I] = (Id < 0) ? NULL : ", "values[i] = (id < 0) ? NULL : ");
+        PrintFunctionName(Config, Section, "GetById", "_get_by_id", "getbyid");
+        EmitCased(Section, Config, "(Self, Id);\n", "(self, id);\n");
+        EmitIndent(Section, Level);
+        EmitCased(Section, Config, "if(Values[I] != NULL) Found++;\n", "if(values[i] != NULL) found++;\n");
+}
+
+void /* Emits _get_many, which looks up a batch of keys and returns how many had string values. */
+PrintBatchAccessors(config *Config, section *Section)
+{
+        size_t Begin = PrintImplementationBegin(Config, Section);
+        EmitLiteral(Section, "size_t\n");
+        PrintFunctionSignature(Config, Section, "GetMany", "_get_many", "getmany",
+                               "const char **Strings, size_t Count, char **Values",
+                               "const char **strings, size_t count, char **values");
+        PrintImplementationIntro(Config, Section, Begin);
+        EmitLiteral(Section, "{\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "size_t Found = 0;\n", "size_t found = 0;\n");
+        /* Keys are taken in chunks of 64, small enough for their scratch to live on the stack. */
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "for(size_t Begin = 0; Begin < Count; Begin += 64)\n",
+                  "for(size_t begin = 0; begin < count; begin += 64)\n");
+        EmitIndent(Section, 1);
+        EmitLiteral(Section, "{\n");
+        EmitIndent(Section, 2);
+        EmitCased(Section, Config, "size_t End = (Count - Begin < 64) ? Count : Begin + 64;\n",
+                  "size_t end = (count - begin < 64) ? count : begin + 64;\n");
+        EmitIndent(Section, 2);
+        EmitCased(Section, Config, "size_t Lengths[64];\n", "size_t lengths[64];\n");
+        if(Config->Lookup == LOOKUP_HASH)
+        {
+                /* Every key in a chunk is hashed before any is probed, so the probes' loads can overlap. */
+                EmitIndent(Section, 2);
+                EmitCased(Section, Config, "uint32_t Slots[64];\n", "uint32_t slots[64];\n");
+                EmitIndent(Section, 2);
+                EmitCased(Section, Config, "for(size_t I = Begin; I < End; I++)\n", "for(size_t i = begin; i < end; i++)\n");
+                EmitIndent(Section, 2);
+                EmitLiteral(Section, "{\n");
+                EmitIndent(Section, 3);
+                EmitCased(Section, Config, "Lengths[I - Begin] = strlen(Strings[I]);\n",
+                          "lengths[i - begin] = strlen(strings[i]);\n");
+                EmitIndent(Section, 3);
+                EmitCased(Section, Config, "Slots[I - Begin] = ", "slots[i - begin] = ");
+                PrintFunctionName(Config, Section, "Slot", "_slot", "slot");
+                EmitCased(Section, Config, "(Strings[I], Lengths[I - Begin]);\n", "(strings[i], lengths[i - begin]);\n");
+                EmitIndent(Section, 2);
+                EmitLiteral(Section, "}\n");
+                EmitIndent(Section, 2);
+                EmitCased(Section, Config, "for(size_t I = Begin; I < End; I++)\n", "for(size_t i = begin; i < end; i++)\n");
+                EmitIndent(Section, 2);
+                EmitLiteral(Section, "{\n");
+                EmitIndent(Section, 3);
+                EmitCased(Section, Config, "int Id = ", "int id = ");
+                PrintFunctionName(Config, Section, "Probe", "_probe", "probe");
+                EmitCased(Section, Config, "(Slots[I - Begin], Strings[I], Lengths[I - Begin]);\n",
+                          "(slots[i - begin], strings[i], lengths[i - begin]);\n");
+                PrintBatchStore(Config, Section, 3);
+                EmitIndent(Section, 2);
+                EmitLiteral(Section, "}\n");
+        }
+        else
+        {
+                /*
+                  Keys the miss filter rejects are done with at once. The rest are sorted like the
+                  descriptors, mostly by their first 8 bytes packed into one integer, then merged with
+                  them: each key's search gallops forward from where the last one's ended.
+                */
+                EmitIndent(Section, 2);
+                EmitCased(Section, Config, "uint64_t Prefixes[64];\n", "uint64_t prefixes[64];\n");
+                EmitIndent(Section, 2);
+                EmitCased(Section, Config, "size_t Sorted[64];\n", "size_t sorted[64];\n");
+                EmitIndent(Section, 2);
+                EmitCased(Section, Config, "size_t SortedCount = 0;\n", "size_t sortedcount = 0;\n");
+                EmitIndent(Section, 2);
+                EmitCased(Section, Config, "for(size_t I = Begin; I < End; I++)\n", "for(size_t i = begin; i < end; i++)\n");
+                EmitIndent(Section, 2);
+                EmitLiteral(Section, "{\n");
+                EmitIndent(Section, 3);
+                EmitCased(Section, Config, "size_t Length = Lengths[I - Begin] = strlen(Strings[I]);\n",
+                          "size_t length = lengths[i - begin] = strlen(strings[i]);\n");
+                EmitIndent(Section, 3);
+                EmitLiteral(Section, "if(!");
+                PrintFunctionName(Config, Section, "MayHaveKey", "_may_have_key", "mayhavekey");
+                EmitCased(Section, Config, "(Strings[I], Length))\n", "(strings[i], length))\n");
+                EmitIndent(Section, 3);
+                EmitLiteral(Section, "{\n");
+                if(Config->IsInstrumented)
+                {
+                        EmitIndent(Section, 4);
+                        PrintFunctionName(Config, Section, "Count", "_count", "count");
+                        EmitLiteral(Section, "(");
+                        PrintFunctionName(Config, Section, "Misses", "_misses", "misses");
+                        EmitLiteral(Section, ");\n");
+                }
+                EmitIndent(Section, 4);
+                EmitCased(Section, Config, "Values[I] = NULL;\n", "values[i] = NULL;\n");
+                EmitIndent(Section, 4);
+                EmitLiteral(Section, "continue;\n");
+                EmitIndent(Section, 3);
+                EmitLiteral(Section, "}\n");
+                EmitIndent(Section, 3);
+                EmitCased(Section, Config, "uint64_t Prefix = 0;\n", "uint64_t prefix = 0;\n");
+                EmitIndent(Section, 3);
+                EmitCased(Section, Config,
+                          "for(size_t K = 0; K < 8; K++) Prefix = (Prefix << 8) | ((K < Length) ? (unsigned char)Strings[I][K] : 0);\n",
+                          "for(size_t k = 0; k < 8; k++) prefix = (prefix << 8) | ((k < length) ? (unsigned char)strings[i][k] : 0);\n");
+                EmitIndent(Section, 3);
+                EmitCased(Section, Config, "Prefixes[I - Begin] = Prefix;\n", "prefixes[i - begin] = prefix;\n");
+                EmitIndent(Section, 3);
+                EmitCased(Section, Config, "size_t J = SortedCount++;\n", "size_t j = sortedcount++;\n");
+                EmitIndent(Section, 3);
+                EmitCased(Section, Config, "for(; J > 0; J--)\n", "for(; j > 0; j--)\n");
+                EmitIndent(Section, 3);
+                EmitLiteral(Section, "{\n");
+                EmitIndent(Section, 4);
+                EmitCased(Section, Config, "size_t Other = Sorted[J - 1];\n", "size_t other = sorted[j - 1];\n");
+                EmitIndent(Section, 4);
+                EmitCased(Section, Config, "if(Prefixes[Other - Begin] < Prefix) break;\n",
+                          "if(prefixes[other - begin] < prefix) break;\n");
+                EmitIndent(Section, 4);
+                EmitCased(Section, Config, "if(Prefixes[Other - Begin] == Prefix)\n", "if(prefixes[other - begin] == prefix)\n");
+                EmitIndent(Section, 4);
+                EmitLiteral(Section, "{\n");
+                EmitIndent(Section, 5);
+                EmitCased(Section, Config, "size_t OtherLength = Lengths[Other - Begin];\n",
+                          "size_t otherlength = lengths[other - begin];\n");
+                EmitIndent(Section, 5);
+                EmitCased(Section, Config, "size_t Shorter = (OtherLength < Length) ? OtherLength : Length;\n",
+                          "size_t shorter = (otherlength < length) ? otherlength : length;\n");
+                EmitIndent(Section, 5);
+                EmitCased(Section, Config,
+                          "int Order = (Shorter > 8) ? memcmp(Strings[Other] + 8, Strings[I] + 8, Shorter - 8) : 0;\n",
+                          "int order = (shorter > 8) ? memcmp(strings[other] + 8, strings[i] + 8, shorter - 8) : 0;\n");
+                EmitIndent(Section, 5);
+                EmitCased(Section, Config, "if(Order < 0 || (Order == 0 && OtherLength <= Length)) break;\n",
+                          "if(order < 0 || (order == 0 && otherlength <= length)) break;\n");
+                EmitIndent(Section, 4);
+                EmitLiteral(Section, "}\n");
+                EmitIndent(Section, 4);
+                EmitCased(Section, Config, "Sorted[J] = Other;\n", "sorted[j] = other;\n");
+                EmitIndent(Section, 3);
+                EmitLiteral(Section, "}\n");
+                EmitIndent(Section, 3);
+                EmitCased(Section, Config, "Sorted[J] = I;\n", "sorted[j] = i;\n");
+                EmitIndent(Section, 2);
+                EmitLiteral(Section, "}\n");
+                EmitIndent(Section, 2);
+                EmitCased(Section, Config, "uint32_t Cursor = 0;\n", "uint32_t cursor = 0;\n");
+                EmitIndent(Section, 2);
+                EmitCased(Section, Config, "for(size_t J = 0; J < SortedCount; J++)\n", "for(size_t j = 0; j < sortedcount; j++)\n");
+                EmitIndent(Section, 2);
+                EmitLiteral(Section, "{\n");
+                EmitIndent(Section, 3);
+                EmitCased(Section, Config, "size_t I = Sorted[J];\n", "size_t i = sorted[j];\n");
+                EmitIndent(Section, 3);
+                EmitCased(Section, Config, "size_t Length = Lengths[I - Begin];\n", "size_t length = lengths[i - begin];\n");
+                EmitIndent(Section, 3);
+                EmitCased(Section, Config, "uint32_t Limit = Cursor;\n", "uint32_t limit = cursor;\n");
+                EmitIndent(Section, 3);
+                EmitCased(Section, Config, "uint32_t Step = 1;\n", "uint32_t step = 1;\n");
+                EmitIndent(Section, 3);
+                EmitCased(Section, Config, "while(Limit < ", "while(limit < ");
+                PrintReservedConstant(Config, Section, "key_count");
+                EmitLiteral(Section, " && ");
+                PrintFunctionName(Config, Section, "LowerBound", "_lower_bound", "lowerbound");
+                EmitCased(Section, Config, "(Limit, Limit + 1, 0, Strings[I], Length, -1) > Limit)\n",
+                          "(limit, limit + 1, 0, strings[i], length, -1) > limit)\n");
+                EmitIndent(Section, 3);
+                EmitLiteral(Section, "{\n");
+                EmitIndent(Section, 4);
+                EmitCased(Section, Config, "Cursor = Limit + 1;\n", "cursor = limit + 1;\n");
+                EmitIndent(Section, 4);
+                EmitCased(Section, Config, "Limit = Cursor + Step - 1;\n", "limit = cursor + step - 1;\n");
+                EmitIndent(Section, 4);
+                EmitCased(Section, Config, "Step *= 2;\n", "step *= 2;\n");
+                EmitIndent(Section, 3);
+                EmitLiteral(Section, "}\n");
+                EmitIndent(Section, 3);
+                EmitCased(Section, Config, "if(Limit > ", "if(limit > ");
+                PrintReservedConstant(Config, Section, "key_count");
+                EmitCased(Section, Config, ") Limit = ", ") limit = ");
+                PrintReservedConstant(Config, Section, "key_count");
+                EmitLiteral(Section, ";\n");
+                EmitIndent(Section, 3);
+                EmitCased(Section, Config, "Cursor = ", "cursor = ");
+                PrintFunctionName(Config, Section, "LowerBound", "_lower_bound", "lowerbound");
+                EmitCased(Section, Config, "(Cursor, Limit, 0, Strings[I], Length, -1);\n",
+                          "(cursor, limit, 0, strings[i], length, -1);\n");
+                EmitIndent(Section, 3);
+                EmitCased(Section, Config, "int Id = -1;\n", "int id = -1;\n");
+                EmitIndent(Section, 3);
+                EmitCased(Section, Config, "if(Cursor < ", "if(cursor < ");
+                PrintReservedConstant(Config, Section, "key_count");
+                EmitLiteral(Section, ")\n");
+                EmitIndent(Section, 3);
+                EmitLiteral(Section, "{\n");
+                EmitIndent(Section, 4);
+                EmitLiteral(Section, "const ");
+                EmitString(Section, Config->StructName);
+                EmitCased(Section, Config, "_descriptor *Descriptor = &", "_descriptor *descriptor = &");
+                PrintFunctionName(Config, Section, "Descriptors", "_descriptors", "descriptors");
+                EmitCased(Section, Config, "[Cursor];\n", "[cursor];\n");
+                EmitIndent(Section, 4);
+                EmitCased(Section, Config, "if(Descriptor->Length == Length && memcmp(",
+                          "if(descriptor->length == length && memcmp(");
+                PrintFunctionName(Config, Section, "Names", "_names", "names");
+                EmitCased(Section, Config, " + Descriptor->Name, Strings[I], Length) == 0) Id = Descriptor->Id;\n",
+                          " + descriptor->name, strings[i], length) == 0) id = descriptor->id;\n");
+                EmitIndent(Section, 3);
+                EmitLiteral(Section, "}\n");
+                PrintBatchStore(Config, Section, 3);
+                EmitIndent(Section, 2);
+                EmitLiteral(Section, "}\n");
+        }
+        EmitIndent(Section, 1);
+        EmitLiteral(Section, "}\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "return(Found);\n", "return(found);\n");
+        EmitLiteral(Section, "}\n");
+        PrintImplementationOutro(Config, Section);
+}
+
+void /* Emits _dump_stats, which writes the misses, then every key and its hits in key order, to a profile file. */
+PrintDumpStats(config *Config, section *Section)
+{
+        size_t Begin = PrintImplementationBegin(Config, Section);
+        EmitLiteral(Section, "unsigned int\n");
+        PrintFunctionName(Config, Section, "DumpStats", "_dump_stats", "dumpstats");
+        EmitCased(Section, Config, "(const char *Path)\n", "(const char *path)\n");
+        PrintImplementationIntro(Config, Section, Begin);
+        EmitLiteral(Section, "{\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "FILE *File = fopen(Path, \"w\");\n", "FILE *file = fopen(path, \"w\");\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "if(File == NULL)\n", "if(file == NULL)\n");
+        EmitIndent(Section, 1);
+        EmitLiteral(Section, "{\n");
+        EmitIndent(Section, 2);
+        EmitLiteral(Section, "return(0);\n");
+        EmitIndent(Section, 1);
+        EmitLiteral(Section, "}\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "fprintf(File, \"# misses %llu\\n\", (unsigned long long)",
+                  "fprintf(file, \"# misses %llu\\n\", (unsigned long long)");
+        PrintFunctionName(Config, Section, "Counted", "_counted", "counted");
+        EmitLiteral(Section, "(");
+        PrintFunctionName(Config, Section, "Misses", "_misses", "misses");
+        EmitLiteral(Section, "));\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "for(int I = 0; I < ", "for(int i = 0; i < ");
+        PrintReservedConstant(Config, Section, "key_count");
+        EmitCased(Section, Config, "; I++)\n", "; i++)\n");
+        EmitIndent(Section, 1);
+        EmitLiteral(Section, "{\n");
+        EmitIndent(Section, 2);
+        EmitLiteral(Section, "const ");
+        EmitString(Section, Config->StructName);
+        EmitCased(Section, Config, "_descriptor *Descriptor = &", "_descriptor *descriptor = &");
+        PrintFunctionName(Config, Section, "Descriptors", "_descriptors", "descriptors");
+        EmitCased(Section, Config, "[I];\n", "[i];\n");
+        EmitIndent(Section, 2);
+        EmitCased(Section, Config, "fprintf(File, \"%s %llu\\n\", ", "fprintf(file, \"%s %llu\\n\", ");
+        PrintFunctionName(Config, Section, "Name", "_name", "name");
+        EmitCased(Section, Config, "(Descriptor), (unsigned long long)", "(descriptor), (unsigned long long)");
+        PrintFunctionName(Config, Section, "Counted", "_counted", "counted");
+        EmitLiteral(Section, "(");
+        PrintFunctionName(Config, Section, "Hits", "_hits", "hits");
+        EmitCased(Section, Config, "[Descriptor->Id]));\n", "[descriptor->id]));\n");
+        EmitIndent(Section, 1);
+        EmitLiteral(Section, "}\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "return(fclose(File) == 0);\n", "return(fclose(file) == 0);\n");
+        EmitLiteral(Section, "}\n");
+        PrintImplementationOutro(Config, Section);
+}
+
+void /* Emits the --instrument counters, each preceded by Storage, eg.: "static uint64_t ". */
+PrintCounters(config *Config, section *Section, char *Storage)
+{
+        EmitString(Section, Storage);
+        PrintFunctionName(Config, Section, "Hits", "_hits", "hits");
+        EmitLiteral(Section, "[");
+        PrintReservedConstant(Config, Section, "key_count");
+        EmitLiteral(Section, "];\n");
+        EmitString(Section, Storage);
+        PrintFunctionName(Config, Section, "Misses", "_misses", "misses");
+        EmitLiteral(Section, ";\n");
+}
+
+void
+PrintFunctionIntros(config *Config, section Sections[SECTION_COUNT])
+{
+        section *Define = &Sections[SECTION_DEFINE];
+        section *Keys = &Sections[SECTION_KEYS];
+        section *Offsets = &Sections[SECTION_OFFSETS];
+        section *Blob = &Sections[SECTION_BLOB];
+        section *Lengths = &Sections[SECTION_LENGTHS];
+        section *Types = &Sections[SECTION_TYPES];
+        section *Init = &Sections[SECTION_INIT];
+        section *Query = &Sections[SECTION_QUERY];
+        section *Get = &Sections[SECTION_GET];
+
+        /* Define */
+        if(Config->IsHeader)
+        {
+                EmitLiteral(Define, "#ifndef ");
+                PrintReservedConstant(Config, Define, "h");
+                EmitLiteral(Define, "\n#define ");
+                PrintReservedConstant(Config, Define, "h");
+                EmitLiteral(Define, "\n");
+        }
+        EmitLiteral(Define, "#include <string.h> /* memcmp, strlen */\n");
+        EmitLiteral(Define, "#include <stddef.h> /* offsetof, size_t */\n");
+        EmitLiteral(Define, "#include <stdint.h> /* uint32_t, uint64_t, int64_t */\n");
+        if(Config->IsTyped)
+        {
+                EmitLiteral(Define, "#include <stdbool.h>\n");
+        }
+        if(Config->IsInstrumented)
+        {
+                EmitLiteral(Define, "#include <stdio.h> /* fopen, fprintf */\n");
+        }
+        EmitLiteral(Define, "typedef struct ");
+        EmitString(Define, Config->StructName);
+        EmitLiteral(Define, "\n{\n");
+
+        /* Keys */
+        EmitLiteral(Keys, "typedef enum ");
+        EmitString(Keys, Config->StructName);
+        EmitLiteral(Keys, "_key\n{\n");
+
+        /* Offsets */
+        EmitLiteral(Offsets, "static const size_t ");
+        PrintFunctionName(Config, Offsets, "Offsets", "_offsets", "offsets");
+        EmitLiteral(Offsets, "[");
+        PrintReservedConstant(Config, Offsets, "key_count");
+        EmitLiteral(Offsets, "] =\n{\n");
+
+        if(Config->Layout == LAYOUT_COMPACT)
+        {
+                /* Blob; every value line starts with its own newline, so the last one takes the semicolon. */
+                EmitLiteral(Blob, "static const char ");
+                PrintFunctionName(Config, Blob, "Blob", "_blob", "blob");
+                EmitLiteral(Blob, "[] =");
+
+                /* Lengths */
+                EmitLiteral(Lengths, "static const uint32_t ");
+                PrintFunctionName(Config, Lengths, "Lengths", "_lengths", "lengths");
+                EmitLiteral(Lengths, "[");
+                PrintReservedConstant(Config, Lengths, "key_count");
+                EmitLiteral(Lengths, "] =\n{\n");
+        }
+
+        /* Types; every descriptor has one, but only --typed needs them indexed by key. */
+        EmitLiteral(Types, "typedef enum ");
+        EmitString(Types, Config->StructName);
+        EmitLiteral(Types, "_type\n{\n");
+        for(int Type = 0; Type < VALUE_TYPE_COUNT; Type++)
+        {
+                EmitIndent(Types, 1);
+                PrintReservedConstant(Config, Types, ValueTypeConstants[Type]);
+                if(Type + 1 < VALUE_TYPE_COUNT) EmitLiteral(Types, ",");
+                EmitLiteral(Types, "\n");
+        }
+        EmitLiteral(Types, "} ");
+        EmitString(Types, Config->StructName);
+        EmitLiteral(Types, "_type;\n");
+        if(Config->IsTyped)
+        {
+                EmitLiteral(Types, "static const unsigned char ");
+                PrintFunctionName(Config, Types, "Types", "_types", "types");
+                EmitLiteral(Types, "[");
+                PrintReservedConstant(Config, Types, "key_count");
+                EmitLiteral(Types, "] =\n{\n");
+        }
+
+        if(Config->IsStatic)
+        {
+                /* Print Static Instance Intro; with --header it's declared, then defined once like the functions. */
+                if(Config->IsHeader)
+                {
+                        EmitLiteral(Init, "extern const ");
+                        EmitString(Init, Config->StructName);
+                        EmitLiteral(Init, " ");
+                        PrintFunctionName(Config, Init, "Instance", "_instance", "instance");
+                        EmitLiteral(Init, ";\n#if defined(GSCFG_IMPLEMENTATION)\n");
+                }
+                else
+                {
+                        EmitLiteral(Init, "static ");
+                }
+                EmitLiteral(Init, "const ");
+                EmitString(Init, Config->StructName);
+                EmitLiteral(Init, " ");
+                PrintFunctionName(Config, Init, "Instance", "_instance", "instance");
+                EmitLiteral(Init, " =\n{\n");
+        }
+        else
+        {
+                /* Print Init Function Intro */
+                size_t Begin = PrintImplementationBegin(Config, Init);
+                EmitLiteral(Init, "void\n");
+                PrintFunctionName(Config, Init, "Init", "_init", "init");
+                EmitLiteral(Init, "(");
+                EmitString(Init, Config->StructName);
+                EmitCased(Init, Config, " *Self)\n", " *self)\n");
+                PrintImplementationIntro(Config, Init, Begin);
+                EmitLiteral(Init, "{\n");
+        }
+
+        if(Config->IsInstrumented)
+        {
+                /* Counters; relaxed atomics where the compiler has them, since lookups may come from any thread. */
+                EmitLiteral(Get, "#if defined(__GNUC__)\n");
+                EmitLiteral(Get, "#define ");
+                PrintFunctionName(Config, Get, "Count", "_count", "count");
+                EmitCased(Get, Config, "(Counter) __atomic_fetch_add(&(Counter), 1, __ATOMIC_RELAXED)\n",
+                          "(counter) __atomic_fetch_add(&(counter), 1, __ATOMIC_RELAXED)\n");
+                EmitLiteral(Get, "#define ");
+                PrintFunctionName(Config, Get, "Counted", "_counted", "counted");
+                EmitCased(Get, Config, "(Counter) __atomic_load_n(&(Counter), __ATOMIC_RELAXED)\n",
+                          "(counter) __atomic_load_n(&(counter), __ATOMIC_RELAXED)\n");
+                EmitLiteral(Get, "#else\n");
+                EmitLiteral(Get, "#define ");
+                PrintFunctionName(Config, Get, "Count", "_count", "count");
+                EmitCased(Get, Config, "(Counter) ((Counter)++)\n", "(counter) ((counter)++)\n");
+                EmitLiteral(Get, "#define ");
+                PrintFunctionName(Config, Get, "Counted", "_counted", "counted");
+                EmitCased(Get, Config, "(Counter) (Counter)\n", "(counter) (counter)\n");
+                EmitLiteral(Get, "#endif\n");
+                if(Config->IsHeader)
+                {
+                        /* Every file including the header shares the one set of counters. */
+                        PrintCounters(Config, Get, "extern uint64_t ");
+                        EmitLiteral(Get, "#if defined(GSCFG_IMPLEMENTATION)\n");
+                        PrintCounters(Config, Get, "uint64_t ");
+                        EmitLiteral(Get, "#endif\n");
+                }
+                else
+                {
+                        PrintCounters(Config, Get, "static uint64_t ");
+                }
+        }
+
+        /* Otherwise PrintLookupTables emits _key_id_n whole. */
+        if(!ConfigStreamsChain(Config)) return;
+
+        /* Print Key Id Function Intro */
+        PrintKeyIdIntro(Config, Query);
+}
+
+void
+PrintFunctionSource(config *Config, section Sections[SECTION_COUNT],
+                    char *Attribute, unsigned int AttributeLength, typed_value *Value,
+                    size_t BlobOffset, size_t BlobLength)
+{
+        section *Keys = &Sections[SECTION_KEYS];
+        section *Offsets = &Sections[SECTION_OFFSETS];
+        section *Blob = &Sections[SECTION_BLOB];
+        section *Lengths = &Sections[SECTION_LENGTHS];
+        section *Types = &Sections[SECTION_TYPES];
+        section *Init = &Sections[SECTION_INIT];
+        section *Query = &Sections[SECTION_QUERY];
+        gs_bool IsCapitalized = ConfigIsCapitalized(Config);
+
+        /* Keys */
+        EmitIndent(Keys, 1);
+        PrintKeyConstant(Config, Keys, Attribute, AttributeLength);
+        EmitLiteral(Keys, ",\n");
+
+        /* Offsets */
+        EmitIndent(Offsets, 1);
+        EmitLiteral(Offsets, "offsetof(");
+        EmitString(Offsets, Config->StructName);
+        EmitLiteral(Offsets, ", ");
+        EmitSpan(Offsets, Attribute, AttributeLength);
+        EmitLiteral(Offsets, "),\n");
+
+        gs_bool IsString = (Value->Type == VALUE_TYPE_STRING);
+        if(Config->Layout == LAYOUT_COMPACT)
+        {
+                /* Blob; a separate "\0" literal can't extend an escape at the end of Value. */
+                if(IsString)
+                {
+                        EmitLiteral(Blob, "\n");
+                        EmitIndent(Blob, 1);
+                        EmitLiteral(Blob, "\"");
+                        EmitSpan(Blob, Value->Text, Value->TextLength);
+                        EmitLiteral(Blob, "\" \"\\0\"");
+                }
+
+                /* Lengths */
+                EmitIndent(Lengths, 1);
+                EmitUnsigned(Lengths, BlobLength);
+                EmitLiteral(Lengths, ",\n");
+        }
+
+        if(Config->IsTyped)
+        {
+                /* Types */
+                EmitIndent(Types, 1);
+                PrintReservedConstant(Config, Types, ValueTypeConstants[Value->Type]);
+                EmitLiteral(Types, ",\n");
+        }
+
+        /* Init */
+        EmitIndent(Init, 1);
+        if(Config->IsStatic)   EmitLiteral(Init, ".");
+        else if(IsCapitalized) EmitLiteral(Init, "Self->");
+        else                   EmitLiteral(Init, "self->");
+        EmitSpan(Init, Attribute, AttributeLength);
+        if(!IsString)
+        {
+                EmitLiteral(Init, " = ");
+                EmitSpan(Init, Value->Literal, Value->LiteralLength);
+        }
+        else if(Config->Layout == LAYOUT_COMPACT)
+        {
+                EmitLiteral(Init, " = ");
+                EmitUnsigned(Init, BlobOffset);
+        }
+        else
+        {
+                EmitLiteral(Init, " = \"");
+                EmitSpan(Init, Value->Text, Value->TextLength);
+                EmitLiteral(Init, "\"");
+        }
+        if(Config->IsStatic) EmitLiteral(Init, ",\n");
+        else                 EmitLiteral(Init, ";\n");
+
+        if(!ConfigStreamsChain(Config)) return;
+
+        /* Key Id */
+        PrintChainCompare(Config, Query, Attribute, AttributeLength);
+}
+
+void
+PrintFunctionOutros(config *Config, section Sections[SECTION_COUNT])
+{
+        section *Define = &Sections[SECTION_DEFINE];
+        section *Keys = &Sections[SECTION_KEYS];
+        section *Offsets = &Sections[SECTION_OFFSETS];
+        section *Lengths = &Sections[SECTION_LENGTHS];
+        section *Types = &Sections[SECTION_TYPES];
+        section *Init = &Sections[SECTION_INIT];
+        section *Query = &Sections[SECTION_QUERY];
+        section *Get = &Sections[SECTION_GET];
+
+        /* Define */
+        EmitLiteral(Define, "} ");
+        EmitString(Define, Config->StructName);
+        EmitLiteral(Define, ";\n");
+        /* Keys */
+        EmitIndent(Keys, 1);
+        PrintReservedConstant(Config, Keys, "key_count");
+        EmitLiteral(Keys, "\n} ");
+        EmitString(Keys, Config->StructName);
+        EmitLiteral(Keys, "_key;\n");
+        /* Offsets */
+        EmitLiteral(Offsets, "};\n");
+        if(Config->Layout == LAYOUT_COMPACT)
+        {
+                /* Lengths, and the macros that read a field through the blob. */
+                EmitLiteral(Lengths, "};\n");
+                EmitLiteral(Lengths, "#define ");
+                PrintFunctionName(Config, Lengths, "Value", "_value", "value");
+                EmitCased(Lengths, Config, "(Self, Field) (", "(self, field) (");
+                PrintFunctionName(Config, Lengths, "Blob", "_blob", "blob");
+                EmitCased(Lengths, Config, " + (Self)->Field)\n", " + (self)->field)\n");
+                EmitLiteral(Lengths, "#define ");
+                PrintFunctionName(Config, Lengths, "Length", "_length", "length");
+                EmitCased(Lengths, Config, "(Key) (", "(key) (");
+                PrintFunctionName(Config, Lengths, "Lengths", "_lengths", "lengths");
+                EmitCased(Lengths, Config, "[Key])\n", "[key])\n");
+        }
+        /* Types */
+        if(Config->IsTyped) EmitLiteral(Types, "};\n");
+        /* Init */
+        EmitString(Init, Config->IsStatic ? "};\n" : "}\n");
+        PrintImplementationOutro(Config, Init);
+        /* Key Id */
+        if(ConfigStreamsChain(Config))
+        {
+                EmitIndent(Query, 1);
+                EmitLiteral(Query, "return(-1);\n");
+                EmitLiteral(Query, "}\n");
+        }
+        /* Accessors */
+        PrintLookupAccessors(Config, Get);
+        PrintSubtreeAccessors(Config, Get);
+        PrintBatchAccessors(Config, Get);
+        if(Config->IsInstrumented) PrintDumpStats(Config, Get);
+        if(Config->IsHeader) EmitLiteral(Get, "#endif\n");
+}
+
+/******************************************************************************
+ * Perfect Hash Lookup
+ *-----------------------------------------------------------------------------
+ * With LOOKUP_HASH, every compound name gets its own slot in a table with
+ * exactly one slot per key, built by hash and displace: a name hashes to a
+ * bucket, the bucket's displacement picks the slot, and a single length and
+ * memcmp check confirms the match.
+ *
+ * The generated code repeats LookupHash, LookupBucket and LookupSlot exactly,
+ * using these same constants.
+ ******************************************************************************/
+
+#define LookupStringify(X) #X
+#define LookupLiteral(X) LookupStringify(X)
+#define LookupHashBasis 14695981039346656037ULL
+#define LookupHashPrime 1099511628211ULL
+#define LookupMixMultiplier 0xff51afd7ed558ccdULL
+#define LookupDisplaceMultiplier 0x9e3779b97f4a7c15ULL
+#define LookupEmptySlot 0xFFFFFFFFu
+
+uint64_t /* 64-bit FNV-1a. */
+LookupHash(char *String, unsigned int Length)
+{
+        uint64_t Result = LookupHashBasis;
+        for(unsigned int I = 0; I < Length; I++)
+        {
+                Result = (Result ^ (unsigned char)String[I]) * LookupHashPrime;
+        }
+        return(Result);
+}
+
+uint64_t
+LookupMix(uint64_t X)
+{
+        X ^= X >> 33;
+        X *= LookupMixMultiplier;
+        X ^= X >> 33;
+        return(X);
+}
+
+unsigned int
+LookupBucket(uint64_t Hash, unsigned int BucketCount)
+{
+        return((unsigned int)(LookupMix(Hash) % BucketCount));
+}
+
+unsigned int
+LookupSlot(uint64_t Hash, uint32_t Displacement, unsigned int SlotCount)
+{
+        return((unsigned int)(LookupMix(Hash ^ (Displacement * LookupDisplaceMultiplier)) % SlotCount));
+}
+
+int
+LookupKeyCompare(const void *Left, const void *Right)
+{
+        lookup_key *A = (lookup_key *)Left;
+        lookup_key *B = (lookup_key *)Right;
+        if(A->Hash != B->Hash) return((A->Hash < B->Hash) ? -1 : 1);
+        return((A->Entry > B->Entry) - (A->Entry < B->Entry));
+}
+
+int /* Largest buckets first; they're the hardest to place. */
+LookupBucketCompare(const void *Left, const void *Right)
+{
+        lookup_bucket *A = (lookup_bucket *)Left;
+        lookup_bucket *B = (lookup_bucket *)Right;
+        if(A->Count != B->Count) return((A->Count > B->Count) ? -1 : 1);
+        return((A->Bucket > B->Bucket) - (A->Bucket < B->Bucket));
+}
+
+void /* A name given more than once keeps its first entry. */
+PerfectHashBuild(perfect_hash *Self, config_entries *Entries, gs_arena *Arena)
+{
+        unsigned int Count = Entries->Count;
+        Self->Slots = (unsigned int *)ArenaPush(Arena, sizeof(unsigned int) * GSMax(1, Count));
+        Self->Displacements = (unsigned int *)ArenaPush(Arena, sizeof(unsigned int) * (Count / 4 + 1));
+
+        gs_arena_mark Mark = GSArenaMark(Arena);
+        lookup_key *Keys = (lookup_key *)ArenaPush(Arena, sizeof(lookup_key) * GSMax(1, Count));
+        for(unsigned int I = 0; I < Count; I++)
+        {
+                Keys[I].Hash = LookupHash(Entries->Entries[I].Name, Entries->Entries[I].NameLength);
+                Keys[I].Entry = I;
+        }
+        qsort(Keys, Count, sizeof(lookup_key), LookupKeyCompare);
+
+        /* Equal names hash equally and are now adjacent, first entry first. */
+        unsigned int Unique = 0;
+        for(unsigned int I = 0; I < Count; I++)
+        {
+                gs_bool IsDuplicate = false;
+                config_entry *Entry = &Entries->Entries[Keys[I].Entry];
+                for(unsigned int J = Unique; J > 0 && Keys[J - 1].Hash == Keys[I].Hash; J--)
+                {
+                        config_entry *Other = &Entries->Entries[Keys[J - 1].Entry];
+                        if(Other->NameLength == Entry->NameLength &&
+                           memcmp(Other->Name, Entry->Name, Entry->NameLength) == 0)
+                        {
+                                IsDuplicate = true;
+                                break;
+                        }
+                        GSAbortWithMessage("Keys %.*s and %.*s have the same hash; use --lookup chain\n",
+                                           Other->NameLength, Other->Name, Entry->NameLength, Entry->Name);
+                }
+                if(!IsDuplicate) Keys[Unique++] = Keys[I];
+        }
+
+        Self->SlotCount = Unique;
+        Self->BucketCount = Unique / 4 + 1;
+        for(unsigned int I = 0; I < Self->SlotCount; I++) Self->Slots[I] = LookupEmptySlot;
+        for(unsigned int I = 0; I < Self->BucketCount; I++) Self->Displacements[I] = 0;
+
+        /* Group keys by bucket. */
+        lookup_bucket *Buckets = (lookup_bucket *)ArenaPush(Arena, sizeof(lookup_bucket) * Self->BucketCount);
+        unsigned int *BucketOf = (unsigned int *)ArenaPush(Arena, sizeof(unsigned int) * GSMax(1, Unique));
+        for(unsigned int I = 0; I < Self->BucketCount; I++)
+        {
+                Buckets[I].Bucket = I;
+                Buckets[I].Count = 0;
+        }
+        for(unsigned int I = 0; I < Unique; I++)
+        {
+                BucketOf[I] = LookupBucket(Keys[I].Hash, Self->BucketCount);
+                Buckets[BucketOf[I]].Count++;
+        }
+        unsigned int Start = 0, MaxCount = 0;
+        for(unsigned int I = 0; I < Self->BucketCount; I++)
+        {
+                Buckets[I].Start = Start;
+                Start += Buckets[I].Count;
+                MaxCount = GSMax(MaxCount, Buckets[I].Count);
+                Buckets[I].Count = 0;
+        }
+        lookup_key *Grouped = (lookup_key *)ArenaPush(Arena, sizeof(lookup_key) * GSMax(1, Unique));
+        for(unsigned int I = 0; I < Unique; I++)
+        {
+                lookup_bucket *Bucket = &Buckets[BucketOf[I]];
+                Grouped[Bucket->Start + Bucket->Count++] = Keys[I];
+        }
+        qsort(Buckets, Self->BucketCount, sizeof(lookup_bucket), LookupBucketCompare);
+
+        /* Find each bucket the first displacement that lands all its keys in free, distinct slots. */
+        unsigned int *Placed = (unsigned int *)ArenaPush(Arena, sizeof(unsigned int) * GSMax(1, MaxCount));
+        for(unsigned int I = 0; I < Self->BucketCount && Buckets[I].Count > 0; I++)
+        {
+                lookup_bucket *Bucket = &Buckets[I];
+                for(uint64_t Displacement = 0; ; Displacement++)
+                {
+                        if(Displacement > 0xFFFFFFFFu) GSAbortWithMessage("Couldn't build a perfect hash; use --lookup chain\n");
+
+                        gs_bool Fits = true;
+                        for(unsigned int J = 0; Fits && J < Bucket->Count; J++)
+                        {
+                                unsigned int Slot = LookupSlot(Grouped[Bucket->Start + J].Hash, (uint32_t)Displacement,
+                                                               Self->SlotCount);
+                                if(Self->Slots[Slot] != LookupEmptySlot) Fits = false;
+                                for(unsigned int K = 0; Fits && K < J; K++)
+                                {
+                                        if(Placed[K] == Slot) Fits = false;
+                                }
+                                Placed[J] = Slot;
+                        }
+                        if(!Fits) continue;
+
+                        for(unsigned int J = 0; J < Bucket->Count; J++)
+                        {
+                                Self->Slots[Placed[J]] = Grouped[Bucket->Start + J].Entry;
+                        }
+                        Self->Displacements[Bucket->Bucket] = (unsigned int)Displacement;
+                        break;
+                }
+        }
+
+        GSArenaPop(Arena, Mark);
+}
+
+void /* Emits the hash tables and the complete _key_id function for LOOKUP_HASH. */
+PrintHashLookup(config *Config, config_entries *Entries, section *Query, gs_arena *Arena)
+{
+        perfect_hash Hash;
+        PerfectHashBuild(&Hash, Entries, Arena);
+
+        if(Hash.SlotCount > 0)
+        {
+                EmitLiteral(Query, "static const uint32_t ");
+                PrintFunctionName(Config, Query, "Displacements", "_displacements", "displacements");
+                EmitLiteral(Query, "[");
+                EmitUnsigned(Query, Hash.BucketCount);
+                EmitLiteral(Query, "] =\n{\n");
+                for(unsigned int I = 0; I < Hash.BucketCount; I++)
+                {
+                        if(I % 16 == 0) EmitIndent(Query, 1);
+                        EmitUnsigned(Query, Hash.Displacements[I]);
+                        if(I + 1 == Hash.BucketCount || I % 16 == 15) EmitLiteral(Query, ",\n");
+                        else                                          EmitLiteral(Query, ", ");
+                }
+                EmitLiteral(Query, "};\n");
+
+                /* As in the descriptors, names are offsets into _names so the table needs no relocations. */
+                EmitCased(Query, Config,
+                          "static const struct { uint32_t Name; uint32_t Length; int Id; } ",
+                          "static const struct { uint32_t name; uint32_t length; int id; } ");
+                PrintFunctionName(Config, Query, "Slots", "_slots", "slots");
+                EmitLiteral(Query, "[");
+                EmitUnsigned(Query, Hash.SlotCount);
+                EmitLiteral(Query, "] =\n{\n");
+                for(unsigned int I = 0; I < Hash.SlotCount; I++)
+                {
+                        config_entry *Entry = &Entries->Entries[Hash.Slots[I]];
+                        EmitIndent(Query, 1);
+                        EmitLiteral(Query, "{ ");
+                        EmitUnsigned(Query, Entry->NameOffset);
+                        EmitLiteral(Query, ", ");
+                        EmitUnsigned(Query, Entry->NameLength);
+                        EmitLiteral(Query, ", ");
+                        PrintKeyConstant(Config, Query, Entry->Name, Entry->NameLength);
+                        EmitLiteral(Query, " },\n");
+                }
+                EmitLiteral(Query, "};\n");
+        }
+
+        /* Slot; split from the probe so _get_many can hash a whole batch before touching the table. */
+        PrintLinkage(Config, Query, true);
+        EmitLiteral(Query, "uint32_t\n");
+        PrintFunctionName(Config, Query, "Slot", "_slot", "slot");
+        EmitCased(Query, Config, "(const char *String, size_t Length)\n{\n", "(const char *string, size_t length)\n{\n");
+        if(Hash.SlotCount == 0)
+        {
+                EmitIndent(Query, 1);
+                EmitCased(Query, Config, "(void)String;\n", "(void)string;\n");
+                EmitIndent(Query, 1);
+                EmitCased(Query, Config, "(void)Length;\n", "(void)length;\n");
+                EmitIndent(Query, 1);
+                EmitLiteral(Query, "return(0);\n");
+        }
+        else
+        {
+                EmitIndent(Query, 1);
+                EmitCased(Query, Config,
+                          "uint64_t Hash = " LookupLiteral(LookupHashBasis) ";\n",
+                          "uint64_t hash = " LookupLiteral(LookupHashBasis) ";\n");
+                EmitIndent(Query, 1);
+                EmitCased(Query, Config,
+                          "for(size_t I = 0; I < Length; I++) Hash = (Hash ^ (unsigned char)String[I]) * "
+                          LookupLiteral(LookupHashPrime) ";\n",
+                          "for(size_t i = 0; i < length; i++) hash = (hash ^ (unsigned char)string[i]) * "
+                          LookupLiteral(LookupHashPrime) ";\n");
+                EmitIndent(Query, 1);
+                EmitCased(Query, Config, "uint64_t Mix = Hash ^ (Hash >> 33);\n", "uint64_t mix = hash ^ (hash >> 33);\n");
+                EmitIndent(Query, 1);
+                EmitCased(Query, Config,
+                          "Mix *= " LookupLiteral(LookupMixMultiplier) ";\n",
+                          "mix *= " LookupLiteral(LookupMixMultiplier) ";\n");
+                EmitIndent(Query, 1);
+                EmitCased(Query, Config, "Mix ^= Mix >> 33;\n", "mix ^= mix >> 33;\n");
+                EmitIndent(Query, 1);
+                EmitCased(Query, Config, "Mix = Hash ^ (", "mix = hash ^ (");
+                PrintFunctionName(Config, Query, "Displacements", "_displacements", "displacements");
+                EmitCased(Query, Config, "[Mix % ", "[mix % ");
+                EmitUnsigned(Query, Hash.BucketCount);
+                EmitLiteral(Query, "] * " LookupLiteral(LookupDisplaceMultiplier) ");\n");
+                EmitIndent(Query, 1);
+                EmitCased(Query, Config, "Mix ^= Mix >> 33;\n", "mix ^= mix >> 33;\n");
+                EmitIndent(Query, 1);
+                EmitCased(Query, Config,
+                          "Mix *= " LookupLiteral(LookupMixMultiplier) ";\n",
+                          "mix *= " LookupLiteral(LookupMixMultiplier) ";\n");
+                EmitIndent(Query, 1);
+                EmitCased(Query, Config, "Mix ^= Mix >> 33;\n", "mix ^= mix >> 33;\n");
+                EmitIndent(Query, 1);
+                EmitCased(Query, Config, "return((uint32_t)(Mix % ", "return((uint32_t)(mix % ");
+                EmitUnsigned(Query, Hash.SlotCount);
+                EmitLiteral(Query, "));\n");
+        }
+        EmitLiteral(Query, "}\n");
+
+        /* Probe */
+        PrintLinkage(Config, Query, true);
+        EmitLiteral(Query, "int\n");
+        PrintFunctionName(Config, Query, "Probe", "_probe", "probe");
+        EmitCased(Query, Config, "(uint32_t Slot, const char *String, size_t Length)\n{\n",
+                  "(uint32_t slot, const char *string, size_t length)\n{\n");
+        if(Hash.SlotCount == 0)
+        {
+                EmitIndent(Query, 1);
+                EmitCased(Query, Config, "(void)Slot;\n", "(void)slot;\n");
+                EmitIndent(Query, 1);
+                EmitCased(Query, Config, "(void)String;\n", "(void)string;\n");
+                EmitIndent(Query, 1);
+                EmitCased(Query, Config, "(void)Length;\n", "(void)length;\n");
+        }
+        else
+        {
+                EmitIndent(Query, 1);
+                EmitLiteral(Query, "if(");
+                PrintFunctionName(Config, Query, "Slots", "_slots", "slots");
+                EmitCased(Query, Config, "[Slot].Length == Length &&\n", "[slot].length == length &&\n");
+                EmitIndent(Query, 1);
+                EmitLiteral(Query, "   memcmp(");
+                PrintFunctionName(Config, Query, "Names", "_names", "names");
+                EmitLiteral(Query, " + ");
+                PrintFunctionName(Config, Query, "Slots", "_slots", "slots");
+                EmitCased(Query, Config, "[Slot].Name, String, Length) == 0)\n", "[slot].name, string, length) == 0)\n");
+                EmitIndent(Query, 1);
+                EmitLiteral(Query, "{\n");
+                EmitIndent(Query, 2);
+                EmitLiteral(Query, "return(");
+                PrintFunctionName(Config, Query, "Slots", "_slots", "slots");
+                EmitCased(Query, Config, "[Slot].Id);\n", "[slot].id);\n");
+                EmitIndent(Query, 1);
+                EmitLiteral(Query, "}\n");
+        }
+        EmitIndent(Query, 1);
+        EmitLiteral(Query, "return(-1);\n");
+        EmitLiteral(Query, "}\n");
+
+        PrintKeyIdIntro(Config, Query);
+        EmitIndent(Query, 1);
+        EmitLiteral(Query, "return(");
+        PrintFunctionName(Config, Query, "Probe", "_probe", "probe");
+        EmitLiteral(Query, "(");
+        PrintFunctionName(Config, Query, "Slot", "_slot", "slot");
+        EmitCased(Query, Config, "(String, Length), String, Length));\n", "(string, length), string, length));\n");
+        EmitLiteral(Query, "}\n");
+}
+
+/******************************************************************************
+ * Profiles
+ *-----------------------------------------------------------------------------
+ * A profile is the file an --instrument build's _dump_stats writes: "#"
+ * comment lines, then a compound name and its hit count per line. With
+ * LOOKUP_CHAIN, a profile reorders _key_id_n from most hits to fewest, and
+ * keys it never saw move into a separate cold function, so the hot chain
+ * stays short and its code stays together.
+ ******************************************************************************/
+
+typedef struct profile_entry
+{
+        char *Name;
+        unsigned int NameLength;
+        uint64_t Hits;
+} profile_entry;
+
+typedef struct profile
+{
+        input_file Input;
+        profile_entry *Entries; /* Sorted by name. */
+        unsigned int Count;
+} profile;
+
+typedef struct profiled_key
+{
+        unsigned int Index; /* Into config_entries. */
+        uint64_t Hits;
+} profiled_key;
+
+int
+ProfileEntryCompare(const void *Left, const void *Right)
+{
+        profile_entry *A = (profile_entry *)Left;
+        profile_entry *B = (profile_entry *)Right;
+        int Order = memcmp(A->Name, B->Name, GSMin(A->NameLength, B->NameLength));
+        if(Order == 0) Order = (A->NameLength > B->NameLength) - (A->NameLength < B->NameLength);
+        return(Order);
+}
+
+int /* Most hits first, then file order. */
+ProfiledKeyCompare(const void *Left, const void *Right)
+{
+        profiled_key *A = (profiled_key *)Left;
+        profiled_key *B = (profiled_key *)Right;
+        if(A->Hits != B->Hits) return((A->Hits < B->Hits) - (A->Hits > B->Hits));
+        return((A->Index > B->Index) - (A->Index < B->Index));
+}
+
+void /* Aborts if FileName can't be read. Names point into the file, which stays open until ProfileClose. */
+ProfileOpen(profile *Self, char *FileName, gs_arena *Arena)
+{
+        if(!InputFileOpen(&Self->Input, FileName, Arena))
+                GSAbortWithMessage("Couldn't read profile %s\n", FileName);
+
+        char *Cursor = Self->Input.Buffer.Start;
+        char *End = Cursor + Self->Input.Buffer.Length;
+        unsigned int Lines = 1;
+        for(char *Byte = Cursor; Byte < End; Byte++) Lines += (*Byte == '\n');
+        Self->Entries = (profile_entry *)ArenaPush(Arena, sizeof(profile_entry) * Lines);
+        Self->Count = 0;
+
+        while(Cursor < End)
+        {
+                char *LineEnd = memchr(Cursor, '\n', End - Cursor);
+                if(LineEnd == NULL) LineEnd = End;
+
+                char *Name = Cursor;
+                while(Cursor < LineEnd && *Cursor != ' ') Cursor++;
+                unsigned int NameLength = Cursor - Name;
+                while(Cursor < LineEnd && *Cursor == ' ') Cursor++;
+                uint64_t Hits = 0;
+                while(Cursor < LineEnd && *Cursor >= '0' && *Cursor <= '9') Hits = Hits * 10 + (*Cursor++ - '0');
+
+                if(NameLength > 0 && Name[0] != '#')
+                {
+                        profile_entry *Entry = &Self->Entries[Self->Count++];
+                        Entry->Name = Name;
+                        Entry->NameLength = NameLength;
+                        Entry->Hits = Hits;
+                }
+                Cursor = LineEnd + 1;
+        }
+
+        qsort(Self->Entries, Self->Count, sizeof(profile_entry), ProfileEntryCompare);
+}
+
+uint64_t /* Zero for names the profile doesn't have. */
+ProfileHits(profile *Self, char *Name, unsigned int NameLength)
+{
+        profile_entry Wanted = { Name, NameLength, 0 };
+        profile_entry *Found = (profile_entry *)bsearch(&Wanted, Self->Entries, Self->Count,
+                                                        sizeof(profile_entry), ProfileEntryCompare);
+        return((Found == NULL) ? 0 : Found->Hits);
+}
+
+void
+ProfileClose(profile *Self)
+{
+        InputFileClose(&Self->Input);
+}
+
+void /* Emits _key_id_n as a chain in profile order, handing keys with no hits to a cold function. */
+PrintProfiledChain(config *Config, config_entries *Entries, section *Query, gs_arena *Arena)
+{
+        profile Profile;
+        ProfileOpen(&Profile, Config->ProfileFile, Arena);
+
+        profiled_key *Keys = (profiled_key *)ArenaPush(Arena, sizeof(profiled_key) * GSMax(1, Entries->Count));
+        unsigned int HotCount = 0;
+        for(unsigned int I = 0; I < Entries->Count; I++)
+        {
+                Keys[I].Index = I;
+                Keys[I].Hits = ProfileHits(&Profile, Entries->Entries[I].Name, Entries->Entries[I].NameLength);
+                if(Keys[I].Hits > 0) HotCount++;
+        }
+        qsort(Keys, Entries->Count, sizeof(profiled_key), ProfiledKeyCompare);
+        ProfileClose(&Profile);
+
+        if(HotCount < Entries->Count)
+        {
+                EmitLiteral(Query, "#if defined(__GNUC__)\n");
+                EmitLiteral(Query, "__attribute__((cold, noinline))\n");
+                EmitLiteral(Query, "#endif\n");
+                EmitLiteral(Query, "static int\n"); /* Not inline even with --header, being noinline. */
+                PrintFunctionName(Config, Query, "KeyIdCold", "_key_id_cold", "keyidcold");
+                EmitCased(Query, Config, "(const char *String, size_t Length)\n{\n", "(const char *string, size_t length)\n{\n");
+                for(unsigned int I = HotCount; I < Entries->Count; I++)
+                {
+                        config_entry *Entry = &Entries->Entries[Keys[I].Index];
+                        PrintChainCompare(Config, Query, Entry->Name, Entry->NameLength);
+                }
+                EmitIndent(Query, 1);
+                EmitLiteral(Query, "return(-1);\n");
+                EmitLiteral(Query, "}\n");
+        }
+
+        PrintKeyIdIntro(Config, Query);
+        for(unsigned int I = 0; I < HotCount; I++)
+        {
+                config_entry *Entry = &Entries->Entries[Keys[I].Index];
+                PrintChainCompare(Config, Query, Entry->Name, Entry->NameLength);
+        }
+        EmitIndent(Query, 1);
+        if(HotCount < Entries->Count)
+        {
+                EmitLiteral(Query, "return(");
+                PrintFunctionName(Config, Query, "KeyIdCold", "_key_id_cold", "keyidcold");
+                EmitCased(Query, Config, "(String, Length));\n", "(string, length));\n");
+        }
+        else
+        {
+                EmitLiteral(Query, "return(-1);\n");
+        }
+        EmitLiteral(Query, "}\n");
+}
+
+/******************************************************************************
+ * Miss Filter
+ *-----------------------------------------------------------------------------
+ * Outside LOOKUP_HASH, _key_id_n first tests two bits of a small bloom filter
+ * over every compound name, so most names that aren't keys are rejected
+ * before any comparison. Each name's bits come from a single multiply of its
+ * length and its first, middle and last bytes, so the test costs the same
+ * whatever the name's length. Misspellings nearly always change one of those.
+ *
+ * The filter has at least MissFilterBitsPerKey bits per key, for under a 1.5%
+ * false positive rate among names with distinct features. The generated code
+ * repeats MissFilterHash exactly.
+ ******************************************************************************/
+
+#define MissFilterBitsPerKey 16
+#define MissFilterMultiplier 0x9e3779b97f4a7c15ULL
+
+uint64_t
+MissFilterHash(char *Name, unsigned int NameLength)
+{
+        uint64_t Features = ((uint64_t)(NameLength & 0xff) << 24) |
+                            ((uint64_t)(unsigned char)Name[0] << 16) |
+                            ((uint64_t)(unsigned char)Name[NameLength / 2] << 8) |
+                            (uint64_t)(unsigned char)Name[NameLength - 1];
+        return(Features * MissFilterMultiplier);
+}
+
+void /* Emits the filter and _may_have_key, which returns whether String[0, Length) might be a key. */
+PrintMissFilter(config *Config, config_entries *Entries, section *Section, gs_arena *Arena)
+{
+        unsigned int Bits = 6;
+        while(Bits < 32 && ((uint64_t)1 << Bits) < (uint64_t)Entries->Count * MissFilterBitsPerKey) Bits++;
+        size_t WordCount = ((size_t)1 << Bits) / 64;
+
+        uint64_t *Words = (uint64_t *)ArenaPush(Arena, sizeof(uint64_t) * WordCount);
+        memset(Words, 0, sizeof(uint64_t) * WordCount);
+        for(unsigned int I = 0; I < Entries->Count; I++)
+        {
+                uint64_t Hash = MissFilterHash(Entries->Entries[I].Name, Entries->Entries[I].NameLength);
+                uint64_t First = Hash >> (64 - Bits);
+                uint64_t Second = (Hash >> (64 - 2 * Bits)) & (((uint64_t)1 << Bits) - 1);
+                Words[First / 64] |= (uint64_t)1 << (First % 64);
+                Words[Second / 64] |= (uint64_t)1 << (Second % 64);
+        }
+
+        EmitLiteral(Section, "static const uint64_t ");
+        PrintFunctionName(Config, Section, "Filter", "_filter", "filter");
+        EmitLiteral(Section, "[");
+        EmitUnsigned(Section, WordCount);
+        EmitLiteral(Section, "] =\n{\n");
+        for(size_t I = 0; I < WordCount; I++)
+        {
+                char Word[32];
+                snprintf(Word, sizeof(Word), "0x%016llxULL", (unsigned long long)Words[I]);
+                if(I % 4 == 0) EmitIndent(Section, 1);
+                EmitString(Section, Word);
+                if(I + 1 == WordCount || I % 4 == 3) EmitLiteral(Section, ",\n");
+                else                                 EmitLiteral(Section, ", ");
+        }
+        EmitLiteral(Section, "};\n");
+
+        char Shift[64];
+        PrintLinkage(Config, Section, true);
+        EmitLiteral(Section, "int\n");
+        PrintFunctionName(Config, Section, "MayHaveKey", "_may_have_key", "mayhavekey");
+        EmitCased(Section, Config, "(const char *String, size_t Length)\n{\n", "(const char *string, size_t length)\n{\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "if(Length == 0)\n", "if(length == 0)\n");
+        EmitIndent(Section, 1);
+        EmitLiteral(Section, "{\n");
+        EmitIndent(Section, 2);
+        EmitLiteral(Section, "return(0);\n");
+        EmitIndent(Section, 1);
+        EmitLiteral(Section, "}\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config,
+                  "uint64_t Hash = (((uint64_t)(Length & 0xff) << 24) |\n",
+                  "uint64_t hash = (((uint64_t)(length & 0xff) << 24) |\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config,
+                  "                 ((uint64_t)(unsigned char)String[0] << 16) |\n",
+                  "                 ((uint64_t)(unsigned char)string[0] << 16) |\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config,
+                  "                 ((uint64_t)(unsigned char)String[Length / 2] << 8) |\n",
+                  "                 ((uint64_t)(unsigned char)string[length / 2] << 8) |\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config,
+                  "                 (uint64_t)(unsigned char)String[Length - 1]) * " LookupLiteral(MissFilterMultiplier) ";\n",
+                  "                 (uint64_t)(unsigned char)string[length - 1]) * " LookupLiteral(MissFilterMultiplier) ";\n");
+        EmitIndent(Section, 1);
+        snprintf(Shift, sizeof(Shift), " >> %u;\n", 64 - Bits);
+        EmitCased(Section, Config, "uint64_t First = Hash", "uint64_t first = hash");
+        EmitString(Section, Shift);
+        EmitIndent(Section, 1);
+        snprintf(Shift, sizeof(Shift), " >> %u) & 0x%llxULL;\n", 64 - 2 * Bits, (unsigned long long)(((uint64_t)1 << Bits) - 1));
+        EmitCased(Section, Config, "uint64_t Second = (Hash", "uint64_t second = (hash");
+        EmitString(Section, Shift);
+        EmitIndent(Section, 1);
+        EmitLiteral(Section, "return((");
+        PrintFunctionName(Config, Section, "Filter", "_filter", "filter");
+        EmitCased(Section, Config, "[First / 64] >> (First % 64) & 1) &&\n", "[first / 64] >> (first % 64) & 1) &&\n");
+        EmitIndent(Section, 1);
+        EmitLiteral(Section, "       (");
+        PrintFunctionName(Config, Section, "Filter", "_filter", "filter");
+        EmitCased(Section, Config, "[Second / 64] >> (Second % 64) & 1));\n", "[second / 64] >> (second % 64) & 1));\n");
+        EmitLiteral(Section, "}\n");
+}
+
+/******************************************************************************
+ * Descriptors
+ *-----------------------------------------------------------------------------
+ * Every key also gets a descriptor in one table sorted by compound name: the
+ * name's offset into a string of every name and its length, the key's offset
+ * into the struct, its key constant and its value type. Holding offsets
+ * rather than pointers keeps the table free of relocations. The generated
+ * _visit walks the table in order, and with LOOKUP_SORTED the generated
+ * _key_id_n binary searches it.
+ *
+ * Names are ordered by memcmp, with a name before any longer name it
+ * prefixes, exactly as the generated search compares them.
+ ******************************************************************************/
+
+int
+DescriptorCompare(const void *Left, const void *Right)
+{
+        config_entry *A = *(config_entry **)Left;
+        config_entry *B = *(config_entry **)Right;
+        int Order = memcmp(A->Name, B->Name, GSMin(A->NameLength, B->NameLength));
+        if(Order == 0) Order = (A->NameLength > B->NameLength) - (A->NameLength < B->NameLength);
+        if(Order == 0) Order = (A > B) - (A < B);
+        return(Order);
+}
+
+int /* Orders entries by the key constant PrintKeyConstant makes of each. */
+KeyConstantCompare(const void *Left, const void *Right)
+{
+        config_entry *A = *(config_entry **)Left;
+        config_entry *B = *(config_entry **)Right;
+        unsigned int Length = GSMin(A->NameLength, B->NameLength);
+        for(unsigned int I = 0; I < Length; I++)
+        {
+                unsigned char CharA = (A->Name[I] == '.') ? '_' : GSCharUpcase(A->Name[I]);
+                unsigned char CharB = (B->Name[I] == '.') ? '_' : GSCharUpcase(B->Name[I]);
+                if(CharA != CharB) return(CharA - CharB);
+        }
+        return((A->NameLength > B->NameLength) - (A->NameLength < B->NameLength));
+}
+
+void /* Aborts if two keys would get the same key constant, eg.: Color and color, or a_b and a.b. */
+CheckKeyConstants(config_entries *Entries, gs_arena *Arena)
+{
+        gs_arena_mark Mark = GSArenaMark(Arena);
+        config_entry **Sorted = (config_entry **)ArenaPush(Arena, sizeof(config_entry *) * GSMax(1, Entries->Count));
+        for(unsigned int I = 0; I < Entries->Count; I++) Sorted[I] = &Entries->Entries[I];
+        qsort(Sorted, Entries->Count, sizeof(config_entry *), KeyConstantCompare);
+
+        for(unsigned int I = 1; I < Entries->Count; I++)
+        {
+                if(KeyConstantCompare(&Sorted[I - 1], &Sorted[I]) != 0) continue;
+
+                config_entry *A = Sorted[I - 1];
+                config_entry *B = Sorted[I];
+                if(memcmp(A->Name, B->Name, A->NameLength) == 0)
+                        GSAbortWithMessage("Key %.*s is defined twice\n", (int)A->NameLength, A->Name);
+                GSAbortWithMessage("Keys %.*s and %.*s would get the same key constant\n",
+                                   (int)A->NameLength, A->Name, (int)B->NameLength, B->Name);
+        }
+
+        GSArenaPop(Arena, Mark);
+}
+
+void /* Emits the descriptor and visitor types, then the sorted descriptor table. */
+PrintDescriptors(config *Config, config_entries *Entries, section *Section, gs_arena *Arena)
+{
+        EmitLiteral(Section, "typedef struct ");
+        EmitString(Section, Config->StructName);
+        EmitLiteral(Section, "_descriptor\n{\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "uint32_t Name; /* Into ", "uint32_t name; /* Into ");
+        PrintFunctionName(Config, Section, "Names", "_names", "names");
+        EmitLiteral(Section, ". */\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "uint32_t Length;\n", "uint32_t length;\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "uint32_t Offset; /* Of the field in ", "uint32_t offset; /* Of the field in ");
+        EmitString(Section, Config->StructName);
+        EmitLiteral(Section, ". */\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "int Id;\n", "int id;\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "unsigned char Type; /* ", "unsigned char type; /* ");
+        EmitString(Section, Config->StructName);
+        EmitLiteral(Section, "_type */\n");
+        EmitLiteral(Section, "} ");
+        EmitString(Section, Config->StructName);
+        EmitLiteral(Section, "_descriptor;\n");
+
+        /* Visitor */
+        EmitLiteral(Section, "typedef int (*");
+        EmitString(Section, Config->StructName);
+        EmitLiteral(Section, "_visitor)(const ");
+        EmitString(Section, Config->StructName);
+        EmitCased(Section, Config, "_descriptor *Descriptor, const void *Field, void *Context);\n",
+                  "_descriptor *descriptor, const void *field, void *context);\n");
+
+        /* Node */
+        EmitLiteral(Section, "typedef struct ");
+        EmitString(Section, Config->StructName);
+        EmitLiteral(Section, "_node\n{\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "uint32_t Begin; /* Descriptors [Begin, End) are under the node. */\n",
+                  "uint32_t begin; /* Descriptors [begin, end) are under the node. */\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "uint32_t End;\n", "uint32_t end;\n");
+        EmitIndent(Section, 1);
+        EmitCased(Section, Config, "uint32_t Length; /* Of the node's name and the '.' after it. */\n",
+                  "uint32_t length; /* Of the node's name and the '.' after it. */\n");
+        EmitLiteral(Section, "} ");
+        EmitString(Section, Config->StructName);
+        EmitLiteral(Section, "_node;\n");
+
+        config_entry **Sorted = (config_entry **)ArenaPush(Arena, sizeof(config_entry *) * GSMax(1, Entries->Count));
+        for(unsigned int I = 0; I < Entries->Count; I++) Sorted[I] = &Entries->Entries[I];
+        qsort(Sorted, Entries->Count, sizeof(config_entry *), DescriptorCompare);
+
+        /* Names; compound names never need escaping, so each takes exactly NameLength + 1 bytes. */
+        EmitLiteral(Section, "static const char ");
+        PrintFunctionName(Config, Section, "Names", "_names", "names");
+        EmitLiteral(Section, "[] =");
+        for(unsigned int I = 0; I < Entries->Count; I++)
+        {
+                EmitLiteral(Section, "\n");
+                EmitIndent(Section, 1);
+                EmitLiteral(Section, "\"");
+                EmitSpan(Section, Sorted[I]->Name, Sorted[I]->NameLength);
+                EmitLiteral(Section, "\\0\"");
+        }
+        if(Entries->Count == 0) EmitLiteral(Section, " \"\"");
+        EmitLiteral(Section, ";\n");
+        EmitLiteral(Section, "#define ");
+        PrintFunctionName(Config, Section, "Name", "_name", "name");
+        EmitCased(Section, Config, "(Descriptor) (", "(descriptor) (");
+        PrintFunctionName(Config, Section, "Names", "_names", "names");
+        EmitCased(Section, Config, " + (Descriptor)->Name)\n", " + (descriptor)->name)\n");
+
+        EmitLiteral(Section, "static const ");
+        EmitString(Section, Config->StructName);
+        EmitLiteral(Section, "_descriptor ");
+        PrintFunctionName(Config, Section, "Descriptors", "_descriptors", "descriptors");
+        if(Entries->Count == 0)
+        {
+                /* C has no zero-length arrays, so there's one row no lookup ever reaches. */
+                EmitLiteral(Section, "[1] =\n{\n");
+                EmitIndent(Section, 1);
+                EmitLiteral(Section, "{ 0, 0, 0, -1, ");
+                PrintReservedConstant(Config, Section, "type_string");
+                EmitLiteral(Section, " },\n");
+        }
+        else
+        {
+                EmitLiteral(Section, "[");
+                PrintReservedConstant(Config, Section, "key_count");
+                EmitLiteral(Section, "] =\n{\n");
+        }
+        size_t NameOffset = 0;
+        for(unsigned int I = 0; I < Entries->Count; I++)
+        {
+                config_entry *Entry = Sorted[I];
+                EmitIndent(Section, 1);
+                EmitLiteral(Section, "{ ");
+                Entry->NameOffset = (uint32_t)NameOffset;
+                EmitUnsigned(Section, NameOffset);
+                EmitLiteral(Section, ", ");
+                EmitUnsigned(Section, Entry->NameLength);
+                NameOffset += Entry->NameLength + 1;
+                EmitLiteral(Section, ", offsetof(");
+                EmitString(Section, Config->StructName);
+                EmitLiteral(Section, ", ");
+                EmitSpan(Section, Entry->Name, Entry->NameLength);
+                EmitLiteral(Section, "), ");
+                PrintKeyConstant(Config, Section, Entry->Name, Entry->NameLength);
+                EmitLiteral(Section, ", ");
+                PrintReservedConstant(Config, Section, ValueTypeConstants[Entry->Type]);
+                EmitLiteral(Section, " },\n");
+        }
+        EmitLiteral(Section, "};\n");
+}
+
+void /* Emits _key_id_n as a binary search over the descriptors. */
+PrintSortedLookup(config *Config, section *Query)
+{
+        PrintKeyIdIntro(Config, Query);
+        EmitIndent(Query, 1);
+        EmitCased(Query, Config, "int Low = 0;\n", "int low = 0;\n");
+        EmitIndent(Query, 1);
+        EmitCased(Query, Config, "int High = ", "int high = ");
+        PrintReservedConstant(Config, Query, "key_count");
+        EmitLiteral(Query, ";\n");
+        EmitIndent(Query, 1);
+        EmitCased(Query, Config, "while(Low < High)\n", "while(low < high)\n");
+        EmitIndent(Query, 1);
+        EmitLiteral(Query, "{\n");
+        EmitIndent(Query, 2);
+        EmitCased(Query, Config, "int Middle = Low + (High - Low) / 2;\n", "int middle = low + (high - low) / 2;\n");
+        EmitIndent(Query, 2);
+        EmitLiteral(Query, "const ");
+        EmitString(Query, Config->StructName);
+        EmitCased(Query, Config, "_descriptor *Descriptor = &", "_descriptor *descriptor = &");
+        PrintFunctionName(Config, Query, "Descriptors", "_descriptors", "descriptors");
+        EmitCased(Query, Config, "[Middle];\n", "[middle];\n");
+        EmitIndent(Query, 2);
+        EmitCased(Query, Config,
+                  "int Order = memcmp(",
+                  "int order = memcmp(");
+        PrintFunctionName(Config, Query, "Names", "_names", "names");
+        EmitCased(Query, Config,
+                  " + Descriptor->Name, String, (Descriptor->Length < Length) ? Descriptor->Length : Length);\n",
+                  " + descriptor->name, string, (descriptor->length < length) ? descriptor->length : length);\n");
+        EmitIndent(Query, 2);
+        EmitCased(Query, Config,
+                  "if(Order == 0) Order = (Descriptor->Length > Length) - (Descriptor->Length < Length);\n",
+                  "if(order == 0) order = (descriptor->length > length) - (descriptor->length < length);\n");
+        EmitIndent(Query, 2);
+        EmitCased(Query, Config, "if(Order == 0)\n", "if(order == 0)\n");
+        EmitIndent(Query, 2);
+        EmitLiteral(Query, "{\n");
+        EmitIndent(Query, 3);
+        EmitCased(Query, Config, "return(Descriptor->Id);\n", "return(descriptor->id);\n");
+        EmitIndent(Query, 2);
+        EmitLiteral(Query, "}\n");
+        EmitIndent(Query, 2);
+        EmitCased(Query, Config, "if(Order < 0) Low = Middle + 1;\n", "if(order < 0) low = middle + 1;\n");
+        EmitIndent(Query, 2);
+        EmitCased(Query, Config, "else High = Middle;\n", "else high = middle;\n");
+        EmitIndent(Query, 1);
+        EmitLiteral(Query, "}\n");
+        EmitIndent(Query, 1);
+        EmitLiteral(Query, "return(-1);\n");
+        EmitLiteral(Query, "}\n");
+}
+
+void /* Emits everything that needs every key at once, from Entries in key order. */
+PrintLookupTables(config *Config, config_entries *Entries, section Sections[SECTION_COUNT], gs_arena *Arena)
+{
+        CheckKeyConstants(Entries, Arena);
+        if(Config->Layout == LAYOUT_COMPACT)
+        {
+                /* Blob; it has no value lines at all when no value is a string. */
+                section *Blob = &Sections[SECTION_BLOB];
+                gs_bool HasStrings = false;
+                for(unsigned int I = 0; I < Entries->Count; I++)
+                {
+                        if(Entries->Entries[I].Type == VALUE_TYPE_STRING) HasStrings = true;
+                }
+                if(!HasStrings) EmitLiteral(Blob, " \"\"");
+                EmitLiteral(Blob, ";\n");
+        }
+        PrintDescriptors(Config, Entries, &Sections[SECTION_DESCRIPTORS], Arena);
+        if(Config->Lookup != LOOKUP_HASH) PrintMissFilter(Config, Entries, &Sections[SECTION_DESCRIPTORS], Arena);
+        if(Config->Lookup == LOOKUP_CHAIN && Config->ProfileFile != NULL)
+                PrintProfiledChain(Config, Entries, &Sections[SECTION_QUERY], Arena);
+        if(Config->Lookup == LOOKUP_HASH)   PrintHashLookup(Config, Entries, &Sections[SECTION_QUERY], Arena);
+        if(Config->Lookup == LOOKUP_SORTED) PrintSortedLookup(Config, &Sections[SECTION_QUERY]);
+}
+
+size_t /* Bytes Value occupies once compiled as the contents of a C string literal, without the terminator. */
+ValueLiteralLength(char *Value, unsigned int ValueLength)
+{
+        size_t Result = 0;
+        char *Cursor = Value;
+        char *End = Value + ValueLength;
+        while(Cursor < End)
+        {
+                char *Escape = (char *)memchr(Cursor, '\\', End - Cursor);
+                if(Escape == NULL || Escape + 1 == End)
+                {
+                        Result += End - Cursor;
+                        break;
+                }
+                Result += Escape - Cursor;
+                Cursor = Escape + 2;
+
+                char Kind = Escape[1];
+                if(Kind == 'x')
+                {
+                        while(Cursor < End && GSCharIsHexadecimal(*Cursor)) Cursor++;
+                        Result += 1;
+                }
+                else if(Kind == 'u' || Kind == 'U')
+                {
+                        /* Universal character names are written out as UTF-8. */
+                        unsigned long CodePoint = 0;
+                        for(int Digits = (Kind == 'u') ? 4 : 8; Digits > 0 && Cursor < End; Digits--, Cursor++)
+                        {
+                                char C = GSCharDowncase(*Cursor);
+                                CodePoint = CodePoint * 16 + (GSCharIsDecimal(C) ? C - '0' : C - 'a' + 10);
+                        }
+                        Result += (CodePoint < 0x80) ? 1 : (CodePoint < 0x800) ? 2 : (CodePoint < 0x10000) ? 3 : 4;
+                }
+                else if(GSCharIsOctal(Kind))
+                {
+                        for(int Digits = 1; Digits < 3 && Cursor < End && GSCharIsOctal(*Cursor); Digits++) Cursor++;
+                        Result += 1;
+                }
+                else
+                {
+                        Result += 1;
+                }
+        }
+
+        return(Result);
+}
+
+void /* Emits Lines[Begin, End) into Sections. Begin must start at the top level. Entries may be NULL. */
+EmitLines(config *Config, config_lines *Lines, unsigned int Begin, unsigned int End, size_t BlobOffset,
+          section Sections[SECTION_COUNT], config_entries *Entries, gs_arena *Arena, generator_stats *Stats)
+{
+        config_stack ConfigStack;
+        ConfigStackInit(&ConfigStack, Arena);
+
+        section *StructDefine = &Sections[SECTION_DEFINE];
+
+        for(unsigned int LineIndex = Begin; LineIndex < End; LineIndex++)
+        {
+                config_line *Line = &Lines->Lines[LineIndex];
+                unsigned int NumSpaces;
+
+                if(Line->Value == NULL)
+                {
+                        /* Get the indentation level for this nested struct. */
+                        NumSpaces = 0;
+                        if(LineIndex + 1 < Lines->Count) NumSpaces = Lines->Lines[LineIndex + 1].Indentation;
+
+                        /* Nested struct definition */
+                        EmitIndent(StructDefine, ConfigStack.Count + 1);
+                        EmitLiteral(StructDefine, "struct\n");
+                        EmitIndent(StructDefine, ConfigStack.Count + 1);
+                        EmitLiteral(StructDefine, "{\n");
+                        ConfigStackAdd(&ConfigStack, Line->Key, Line->KeyLength, NumSpaces);
+                        continue;
+                }
+
+                NumSpaces = Line->Indentation;
+
+                if(ConfigStack.Count > 0)
+                {
+                        UnwindNestedStructs(&ConfigStack, NumSpaces, StructDefine);
+                }
+
+                typed_value Value;
+                TypedValueParse(&Value, Config, Line->Key, Line->KeyLength, Line->Value, Line->ValueLength);
+                gs_bool IsString = (Value.Type == VALUE_TYPE_STRING);
+
+                EmitIndent(StructDefine, ConfigStack.Count + 1);
+                if(IsString && Config->Layout == LAYOUT_COMPACT) EmitLiteral(StructDefine, "uint32_t ");
+                else                                             EmitString(StructDefine, ValueTypeFields[Value.Type]);
+                EmitSpan(StructDefine, Line->Key, Line->KeyLength);
+                EmitLiteral(StructDefine, ";\n");
+
+                size_t BlobLength = 0;
+                if(IsString && Config->Layout == LAYOUT_COMPACT)
+                {
+                        BlobLength = ValueLiteralLength(Value.Text, Value.TextLength);
+                        if(BlobOffset + BlobLength >= UINT32_MAX)
+                                GSAbortWithMessage("Values don't fit in a 32-bit addressed blob\n");
+                }
+
+                unsigned int CompoundNameLength;
+                char *CompoundName = ConfigStackCompoundName(&ConfigStack, Line->Key, Line->KeyLength, &CompoundNameLength);
+                PrintFunctionSource(Config, Sections, CompoundName, CompoundNameLength, &Value, BlobOffset, BlobLength);
+                if(IsString) BlobOffset += BlobLength + 1;
+                if(Entries != NULL)
+                {
+                        ConfigEntriesPush(Entries, CompoundName, CompoundNameLength, Value.Type);
+                }
+                Stats->Keys++;
+        }
+
+        if(ConfigStack.Count > 0)
+        {
+                UnwindNestedStructs(&ConfigStack, 0, StructDefine);
+        }
+
+        size_t ConfigStackPeakBytes = ConfigStack.PeakNamesLength + 1 +
+                ConfigStack.PeakCount * sizeof(config_stack_level);
+        Stats->MaxDepth = GSMax(Stats->MaxDepth, ConfigStack.PeakCount);
+        Stats->ConfigStackPeakBytes = GSMax(Stats->ConfigStackPeakBytes, ConfigStackPeakBytes);
+}
+
+void /* Initializes every section, its first chunk sized for InputLength bytes of config. */
+SectionsInit(config *Config, section Sections[SECTION_COUNT], gs_arena *Arena, indentation *Indentation, size_t InputLength)
+{
+        size_t SectionSize = GSMax(1024, InputLength);
+        size_t CompactSize = (Config->Layout == LAYOUT_COMPACT) ? SectionSize : 64;
+        SectionInit(&Sections[SECTION_DEFINE], Arena, Indentation, SectionSize);
+        SectionInit(&Sections[SECTION_KEYS], Arena, Indentation, SectionSize);
+        SectionInit(&Sections[SECTION_OFFSETS], Arena, Indentation, SectionSize * 2);
+        SectionInit(&Sections[SECTION_BLOB], Arena, Indentation, CompactSize);
+        SectionInit(&Sections[SECTION_LENGTHS], Arena, Indentation, CompactSize);
+        SectionInit(&Sections[SECTION_TYPES], Arena, Indentation, Config->IsTyped ? SectionSize : 256);
+        SectionInit(&Sections[SECTION_DESCRIPTORS], Arena, Indentation, 1024); /* Only written once every key is known. */
+        SectionInit(&Sections[SECTION_INIT], Arena, Indentation, SectionSize * 2);
+        SectionInit(&Sections[SECTION_QUERY], Arena, Indentation, SectionSize * 3);
+        SectionInit(&Sections[SECTION_GET], Arena, Indentation, 4096); /* Only the fixed accessors. */
+}
+
+void
+SourceInit(source *Self, gs_arena *Arena, unsigned int Capacity)
+{
+        Self->Sections = (section **)ArenaPush(Arena, sizeof(section *) * Capacity);
+        Self->Count = 0;
+        Self->Length = 0;
+        Self->Workers = NULL;
+        Self->WorkerCount = 0;
+}
+
+void
+SourceAdd(source *Self, section *Section)
+{
+        Self->Sections[Self->Count++] = Section;
+        Self->Length += SectionLength(Section);
+}
+
+void /* Emits the complete source for Lines into Result. */
+GenerateSource(config *Config, config_lines *Lines, size_t InputLength, gs_arena *Arena, source *Result, generator_stats *Stats)
+{
+        indentation *Indentation = (indentation *)ArenaPush(Arena, sizeof(indentation));
+        IndentationInit(Indentation, Arena, Config->Indent);
+
+        section *Sections = (section *)ArenaPush(Arena, sizeof(section) * SECTION_COUNT);
+        SectionsInit(Config, Sections, Arena, Indentation, InputLength);
+
+        config_entries Entries;
+        ConfigEntriesInit(&Entries, Arena, Lines->Count);
+
+        PrintFunctionIntros(Config, Sections);
+        EmitLines(Config, Lines, 0, Lines->Count, 0, Sections, &Entries, Arena, Stats);
+        PrintFunctionOutros(Config, Sections);
+        PrintLookupTables(Config, &Entries, Sections, Arena);
+
+        Stats->Lines = Lines->LineCount;
+        SourceInit(Result, Arena, SECTION_COUNT);
+        for(int I = 0; I < SECTION_COUNT; I++)
+        {
+                Stats->SectionBytes[I] = SectionLength(&Sections[I]);
+                SourceAdd(Result, &Sections[I]);
+        }
+}
+
+/******************************************************************************
+ * Split Generation
+ *-----------------------------------------------------------------------------
+ * A single large config can be generated on several threads. Lines are cut
+ * into fragments wherever the config stack is fully unwound, so every
+ * fragment starts at the top level and emits exactly what the serial path
+ * would for those lines. Each thread emits whole fragments into its own
+ * arena, and the fragments are written out in source order.
+ ******************************************************************************/
+
+unsigned int /* Returns the number of fragments. Fragments must hold Lines->Count / TargetLines + 1 entries. */
+FragmentsFind(config *Config, config_lines *Lines, unsigned int TargetLines, fragment *Fragments, gs_arena *Arena)
+{
+        /* Replay only the config stack's shape; nothing is emitted. */
+        gs_arena_mark Mark = GSArenaMark(Arena);
+        config_stack ConfigStack;
+        ConfigStackInit(&ConfigStack, Arena);
+
+        unsigned int Count = 0;
+        unsigned int Begin = 0;
+        size_t BlobOffset = 0, BlobBegin = 0;
+        for(unsigned int LineIndex = 0; LineIndex < Lines->Count; LineIndex++)
+        {
+                config_line *Line = &Lines->Lines[LineIndex];
+                if(Line->Value == NULL)
+                {
+                        unsigned int NumSpaces = 0;
+                        if(LineIndex + 1 < Lines->Count) NumSpaces = Lines->Lines[LineIndex + 1].Indentation;
+                        ConfigStackAdd(&ConfigStack, Line->Key, 0, NumSpaces);
+                }
+                else
+                {
+                        if(ConfigStack.Count > 0) UnwindNestedStructs(&ConfigStack, Line->Indentation, NULL);
+                        if(Config->Layout == LAYOUT_COMPACT)
+                        {
+                                typed_value Value;
+                                TypedValueParse(&Value, Config, Line->Key, Line->KeyLength, Line->Value, Line->ValueLength);
+                                if(Value.Type == VALUE_TYPE_STRING) BlobOffset += ValueLiteralLength(Value.Text, Value.TextLength) + 1;
+                        }
+                }
+
+                gs_bool IsLast = (LineIndex + 1 == Lines->Count);
+                if(IsLast || (ConfigStack.Count == 0 && LineIndex + 1 - Begin >= TargetLines))
+                {
+                        Fragments[Count].Begin = Begin;
+                        Fragments[Count].End = LineIndex + 1;
+                        Fragments[Count].BlobOffset = BlobBegin;
+                        Count++;
+                        Begin = LineIndex + 1;
+                        BlobBegin = BlobOffset;
+                }
+        }
+
+        GSArenaPop(Arena, Mark);
+        return(Count);
+}
+
+int /* Returns -1 once every fragment has been taken. */
+FragmentPoolTake(fragment_pool *Self)
+{
+        int Result = -1;
+
+        pthread_mutex_lock(&Self->Lock);
+        if(Self->Next < Self->Count) Result = (int)Self->Next++;
+        pthread_mutex_unlock(&Self->Lock);
+
+        return(Result);
+}
+
+double
+ThreadCpuSeconds(void)
+{
+        struct timespec Time;
+        clock_gettime(CLOCK_THREAD_CPUTIME_ID, &Time);
+        return(Time.tv_sec + Time.tv_nsec * 1e-9);
+}
+
+void *
+FragmentWorkerRun(void *Data)
+{
+        fragment_worker *Self = (fragment_worker *)Data;
+        fragment_pool *Pool = Self->Pool;
+        Self->CpuSeconds = ThreadCpuSeconds();
+
+        int Index;
+        while((Index = FragmentPoolTake(Pool)) >= 0)
+        {
+                fragment *Fragment = &Pool->Fragments[Index];
+                config_line *First = &Pool->Lines->Lines[Fragment->Begin];
+                config_line *Last = &Pool->Lines->Lines[Fragment->End - 1];
+                char *LastEnd = (Last->Value != NULL) ? Last->Value + Last->ValueLength : Last->Key + Last->KeyLength;
+                size_t Length = LastEnd - First->Key;
+
+                indentation *Indentation = (indentation *)ArenaPush(&Self->Arena, sizeof(indentation));
+                IndentationInit(Indentation, &Self->Arena, Pool->Config->Indent);
+                SectionsInit(Pool->Config, Fragment->Sections, &Self->Arena, Indentation, Length);
+
+                ConfigEntriesInit(&Fragment->Entries, &Self->Arena, Fragment->End - Fragment->Begin);
+
+                memset(&Fragment->Stats, 0, sizeof(generator_stats));
+                EmitLines(Pool->Config, Pool->Lines, Fragment->Begin, Fragment->End, Fragment->BlobOffset,
+                          Fragment->Sections, &Fragment->Entries, &Self->Arena, &Fragment->Stats);
+        }
+
+        Self->CpuSeconds = ThreadCpuSeconds() - Self->CpuSeconds;
+        return(NULL);
+}
 
-        fclose(StructDefine);
-        fclose(StructInit);
-        fclose(StructQuery);
-        fclose(StructGet);
+void /* As GenerateSource, but split across up to ThreadCount threads. */
+GenerateSourceSplit(config *Config, config_lines *Lines, size_t InputLength, unsigned int ThreadCount,
+                    gs_arena *Arena, source *Result, generator_stats *Stats)
+{
+        /* A few fragments per thread keeps threads busy when fragment sizes vary. */
+        unsigned int TargetLines = GSMax(1, Lines->Count / (ThreadCount * 8));
+        unsigned int MaxFragments = Lines->Count / TargetLines + 1;
+        fragment *Fragments = (fragment *)ArenaPush(Arena, sizeof(fragment) * MaxFragments);
+        unsigned int FragmentCount = FragmentsFind(Config, Lines, TargetLines, Fragments, Arena);
+        if(FragmentCount <= 1 || ThreadCount <= 1)
+        {
+                GenerateSource(Config, Lines, InputLength, Arena, Result, Stats);
+                return;
+        }
+        ThreadCount = GSMin(ThreadCount, FragmentCount);
+
+        fragment_pool Pool;
+        Pool.Config = Config;
+        Pool.Lines = Lines;
+        Pool.Fragments = Fragments;
+        Pool.Count = FragmentCount;
+        Pool.Next = 0;
+        pthread_mutex_init(&Pool.Lock, NULL);
+
+        fragment_worker *Workers = (fragment_worker *)ArenaPush(Arena, sizeof(fragment_worker) * ThreadCount);
+
+        /* The job's memory limit covers every arena: the workers share what the caller's hasn't taken. */
+        size_t MemoryLimit = Arena->MaxSize;
+        size_t WorkerLimit = 0;
+        if(MemoryLimit != 0)
+        {
+                WorkerLimit = (MemoryLimit - Arena->TotalCapacity) / ThreadCount;
+                if(WorkerLimit <= sizeof(gs_arena_block))
+                        GSAbortWithMessage("Memory limit of %lu bytes exceeded\n", MemoryLimit);
+        }
+        for(unsigned int I = 0; I < ThreadCount; I++)
+        {
+                fragment_worker *Worker = &Workers[I];
+                size_t ArenaSize = 1024 * 1024 + 16 * (InputLength / ThreadCount);
+                if(WorkerLimit != 0) ArenaSize = GSMin(ArenaSize, WorkerLimit);
+                Worker->Pool = &Pool;
+                Worker->ArenaMemory = malloc(ArenaSize);
+                if(Worker->ArenaMemory == NULL) GSAbortWithMessage("Couldn't allocate %lu bytes\n", ArenaSize);
+                GSArenaInit(&Worker->Arena, Worker->ArenaMemory, ArenaSize);
+                GSArenaAllowGrowth(&Worker->Arena, malloc, free, WorkerLimit);
+        }
+
+        /* The calling thread is worker 0. */
+        for(unsigned int I = 1; I < ThreadCount; I++)
+        {
+                if(pthread_create(&Workers[I].Thread, NULL, FragmentWorkerRun, &Workers[I]) != 0)
+                        GSAbortWithMessage("Couldn't start worker thread\n");
+        }
+        FragmentWorkerRun(&Workers[0]);
+        for(unsigned int I = 1; I < ThreadCount; I++)
+        {
+                pthread_join(Workers[I].Thread, NULL);
+                Stats->SplitCpuSeconds += Workers[I].CpuSeconds;
+        }
+        pthread_mutex_destroy(&Pool.Lock);
+        if(MemoryLimit != 0)
+        {
+                /* The lookup tables are built while the fragments are still held, so they get whatever the workers left. */
+                Arena->MaxSize = MemoryLimit;
+                for(unsigned int I = 0; I < ThreadCount; I++)
+                {
+                        Arena->MaxSize -= Workers[I].Arena.TotalCapacity;
+                }
+        }
+
+        /* Intros and outros wrap the fragments in each section. */
+        indentation *Indentation = (indentation *)ArenaPush(Arena, sizeof(indentation));
+        IndentationInit(Indentation, Arena, Config->Indent);
+        section *Intros = (section *)ArenaPush(Arena, sizeof(section) * SECTION_COUNT);
+        section *Outros = (section *)ArenaPush(Arena, sizeof(section) * SECTION_COUNT);
+        SectionsInit(Config, Intros, Arena, Indentation, 0);
+        SectionsInit(Config, Outros, Arena, Indentation, 0);
+        PrintFunctionIntros(Config, Intros);
+        PrintFunctionOutros(Config, Outros);
+
+        /* The lookup tables cover every key, so they're built here from all fragments' entries, on this thread alone. */
+        config_entries Entries;
+        ConfigEntriesInit(&Entries, Arena, Lines->Count);
+        for(unsigned int F = 0; F < FragmentCount; F++)
+        {
+                for(unsigned int I = 0; I < Fragments[F].Entries.Count; I++)
+                {
+                        config_entry *Entry = &Fragments[F].Entries.Entries[I];
+                        Entries.Entries[Entries.Count++] = *Entry;
+                }
+        }
+        PrintLookupTables(Config, &Entries, Outros, Arena);
+
+        Stats->Lines = Lines->LineCount;
+        SourceInit(Result, Arena, SECTION_COUNT * (FragmentCount + 2));
+        for(int I = 0; I < SECTION_COUNT; I++)
+        {
+                size_t Before = Result->Length;
+                SourceAdd(Result, &Intros[I]);
+                for(unsigned int F = 0; F < FragmentCount; F++)
+                {
+                        SourceAdd(Result, &Fragments[F].Sections[I]);
+                }
+                SourceAdd(Result, &Outros[I]);
+                Stats->SectionBytes[I] = Result->Length - Before;
+        }
+        for(unsigned int F = 0; F < FragmentCount; F++)
+        {
+                Stats->Keys += Fragments[F].Stats.Keys;
+                Stats->MaxDepth = GSMax(Stats->MaxDepth, Fragments[F].Stats.MaxDepth);
+                Stats->ConfigStackPeakBytes = GSMax(Stats->ConfigStackPeakBytes, Fragments[F].Stats.ConfigStackPeakBytes);
+        }
+
+        Result->Workers = Workers;
+        Result->WorkerCount = ThreadCount;
+}
+
+void /* Frees --split's worker arenas once Self is written, and gives their share of the memory limit back to Arena. */
+SourceFree(source *Self, gs_arena *Arena, generator_stats *Stats)
+{
+        for(unsigned int I = 0; I < Self->WorkerCount; I++)
+        {
+                fragment_worker *Worker = &Self->Workers[I];
+                Stats->ArenaPeakBytes += Worker->Arena.PeakCapacity;
+                if(Arena->MaxSize != 0) Arena->MaxSize += Worker->Arena.TotalCapacity;
+                GSArenaReset(&Worker->Arena);
+                free(Worker->ArenaMemory);
+        }
+}
+
+gs_bool /* Writes each section's chunks in turn. On failure, says why and removes whatever was written. */
+WriteSourceFile(source *Source, char *OutputFileName)
+{
+        FILE *Out = fopen(OutputFileName, "w");
+        if(Out == NULL)
+        {
+                fprintf(stderr, "Couldn't open %s for writing: %s\n", OutputFileName, strerror(errno));
+                return(false);
+        }
+
+        int Error = 0;
+        for(unsigned int I = 0; Error == 0 && I < Source->Count; I++)
+        {
+                section *Section = Source->Sections[I];
+                for(section_chunk *Chunk = Section->First; Error == 0 && Chunk != NULL; Chunk = Chunk->Next)
+                {
+                        if(fwrite(Chunk->Start, 1, Chunk->Length, Out) != Chunk->Length) Error = errno;
+                }
+                if(Error == 0 && fwrite(Section->Buffer.Start, 1, Section->Buffer.Length, Out) != Section->Buffer.Length)
+                        Error = errno;
+        }
+        /* Buffered writes can fail only when they're flushed. */
+        if(fclose(Out) != 0 && Error == 0) Error = errno;
+
+        if(Error != 0)
+        {
+                fprintf(stderr, "Couldn't write %s: %s\n", OutputFileName, strerror(Error));
+                remove(OutputFileName);
+        }
+
+        return(Error == 0);
+}
+
+/******************************************************************************
+ * Stats
+ ******************************************************************************/
+
+char *SectionNames[SECTION_COUNT] = { "define", "keys", "offsets", "blob", "lengths", "types", "descriptors", "init", "query", "get" };
+char *PhaseNames[PHASE_COUNT] = { "read", "tokenize", "emit", "write" };
+
+void /* Records the current wall and CPU time against Phase. */
+StatsStart(generator_stats *Self, phase_e Phase)
+{
+        struct timespec Time;
+        clock_gettime(CLOCK_MONOTONIC, &Time);
+        Self->WallSeconds[Phase] = Time.tv_sec + Time.tv_nsec * 1e-9;
+        Self->CpuSeconds[Phase] = ThreadCpuSeconds();
+}
+
+void /* Replaces Phase's start times with the elapsed time since StatsStart. */
+StatsStop(generator_stats *Self, phase_e Phase)
+{
+        struct timespec Time;
+        clock_gettime(CLOCK_MONOTONIC, &Time);
+        Self->WallSeconds[Phase] = (Time.tv_sec + Time.tv_nsec * 1e-9) - Self->WallSeconds[Phase];
+        Self->CpuSeconds[Phase] = ThreadCpuSeconds() - Self->CpuSeconds[Phase];
+}
+
+void
+StatsPrint(generator_stats *Self, char *FileName, stats_format_e Format, FILE *Out)
+{
+        if(Format == STATS_FORMAT_JSON)
+        {
+                /* One object per line. FileName is written as given; paths with quotes aren't escaped. */
+                fprintf(Out, "{\"file\": \"%s\", \"input_bytes\": %lu, \"lines\": %u, \"keys\": %u, "
+                        "\"max_depth\": %u, \"config_stack_peak_bytes\": %lu, \"arena_peak_bytes\": %lu, "
+                        "\"output_bytes\": %lu, \"sections\": {",
+                        FileName, (unsigned long)Self->InputBytes, Self->Lines, Self->Keys,
+                        Self->MaxDepth, (unsigned long)Self->ConfigStackPeakBytes, (unsigned long)Self->ArenaPeakBytes,
+                        (unsigned long)Self->OutputBytes);
+                for(int I = 0; I < SECTION_COUNT; I++)
+                {
+                        fprintf(Out, "%s\"%s\": %lu", (I ? ", " : ""), SectionNames[I], (unsigned long)Self->SectionBytes[I]);
+                }
+                fprintf(Out, "}, \"phases\": {");
+                for(int I = 0; I < PHASE_COUNT; I++)
+                {
+                        fprintf(Out, "%s\"%s\": {\"wall\": %.9f, \"cpu\": %.9f}",
+                                (I ? ", " : ""), PhaseNames[I], Self->WallSeconds[I], Self->CpuSeconds[I]);
+                }
+                fprintf(Out, "}}\n");
+                return;
+        }
+
+        fprintf(Out, "%s\n", FileName);
+        fprintf(Out, "  input:        %lu bytes, %u lines, %u keys, max depth %u\n",
+                (unsigned long)Self->InputBytes, Self->Lines, Self->Keys, Self->MaxDepth);
+        fprintf(Out, "  memory:       %lu bytes peak arena, %lu bytes peak config stack\n",
+                (unsigned long)Self->ArenaPeakBytes, (unsigned long)Self->ConfigStackPeakBytes);
+        fprintf(Out, "  output:       %lu bytes\n", (unsigned long)Self->OutputBytes);
+        for(int I = 0; I < SECTION_COUNT; I++)
+        {
+                fprintf(Out, "    %-10s  %lu bytes\n", SectionNames[I], (unsigned long)Self->SectionBytes[I]);
+        }
+        fprintf(Out, "  phase         wall (s)     cpu (s)\n");
+        for(int I = 0; I < PHASE_COUNT; I++)
+        {
+                fprintf(Out, "    %-10s  %.6f     %.6f\n", PhaseNames[I], Self->WallSeconds[I], Self->CpuSeconds[I]);
+        }
+}
+
+void
+GenerateSourceFile(job *Job, gs_arena *Arena)
+{
+        generator_stats *Stats = &Job->Stats;
+        memset(Stats, 0, sizeof(generator_stats));
+
+        StatsStart(Stats, PHASE_READ);
+        input_file Input;
+        if(!InputFileOpen(&Input, Job->InputFileName, Arena))
+                GSAbortWithMessage("Couldn't read %s\n", Job->InputFileName);
+        StatsStop(Stats, PHASE_READ);
+        Stats->InputBytes = Input.Buffer.Length;
+
+        /* Tokenize first so the line array can grow in place at the top of the arena. */
+        StatsStart(Stats, PHASE_TOKENIZE);
+        config_lines Lines;
+        ConfigLinesInit(&Lines, Arena, 256);
+        Tokenize(&Input.Buffer, &Lines);
+        StatsStop(Stats, PHASE_TOKENIZE);
+
+        StatsStart(Stats, PHASE_EMIT);
+        source Source;
+        if(Job->SplitCount > 1)
+                GenerateSourceSplit(&Job->Config, &Lines, Input.Buffer.Length, Job->SplitCount, Arena, &Source, Stats);
+        else
+                GenerateSource(&Job->Config, &Lines, Input.Buffer.Length, Arena, &Source, Stats);
+        StatsStop(Stats, PHASE_EMIT);
+        Stats->CpuSeconds[PHASE_EMIT] += Stats->SplitCpuSeconds;
+        Stats->OutputBytes = Source.Length;
+
+        StatsStart(Stats, PHASE_WRITE);
+        Job->IsWritten = WriteSourceFile(&Source, Job->OutputFileName);
+        StatsStop(Stats, PHASE_WRITE);
+        SourceFree(&Source, Arena, Stats);
+
+        InputFileClose(&Input);
+        Stats->ArenaPeakBytes += Arena->PeakCapacity; /* Split workers' arenas are already counted. */
+}
+
+/******************************************************************************
+ * Job Pool
+ *
+ * Each worker owns a contiguous run of jobs and takes them from the head of
+ * its queue. A worker whose queue runs dry steals from the tail of another's,
+ * so a few large inputs don't leave the other workers idle. Every worker has
+ * its own arena, reset between jobs.
+ ******************************************************************************/
+
+size_t /* Sized so a typical job never grows the arena. */
+JobArenaSize(job *Job, size_t MemoryLimit)
+{
+        struct stat Info;
+        size_t Result = 1024 * 1024;
+        if(stat(Job->InputFileName, &Info) == 0) Result += 16 * (size_t)Info.st_size;
+        if(MemoryLimit != 0) Result = GSMin(Result, MemoryLimit);
+
+        return(Result);
+}
+
+void
+JobPoolInit(job_pool *Self, job *Jobs, unsigned int JobCount, unsigned int WorkerCount,
+            size_t MemoryLimit, gs_arena *Arena)
+{
+        Self->Jobs = Jobs;
+        Self->JobCount = JobCount;
+        Self->WorkerCount = GSMax(1, GSMin(WorkerCount, JobCount));
+        Self->MemoryLimit = MemoryLimit;
+        Self->Queues = (job_queue *)ArenaPush(Arena, sizeof(job_queue) * Self->WorkerCount);
+
+        for(unsigned int I = 0; I < Self->WorkerCount; I++)
+        {
+                job_queue *Queue = &Self->Queues[I];
+                pthread_mutex_init(&Queue->Lock, NULL);
+                Queue->Head = (unsigned int)(((unsigned long)JobCount * I) / Self->WorkerCount);
+                Queue->Tail = (unsigned int)(((unsigned long)JobCount * (I + 1)) / Self->WorkerCount);
+        }
+}
+
+int /* Returns -1 if Queue is empty. */
+JobQueueTake(job_queue *Queue, gs_bool IsOwner)
+{
+        int Result = -1;
+
+        pthread_mutex_lock(&Queue->Lock);
+        if(Queue->Head < Queue->Tail)
+        {
+                if(IsOwner) Result = (int)Queue->Head++;
+                else        Result = (int)--Queue->Tail;
+        }
+        pthread_mutex_unlock(&Queue->Lock);
+
+        return(Result);
+}
 
-        int AllocSize = GSFileSize(StructDefineFilename) +
-                GSFileSize(StructInitFilename) +
-                GSFileSize(StructQueryFilename) +
-                GSFileSize(StructGetFilename);
-        gs_buffer OutputBuffer;
-        GSBufferInit(&OutputBuffer, (char *)alloca(AllocSize), AllocSize);
+int /* Returns -1 once every queue is empty. */
+JobPoolTake(job_pool *Self, unsigned int WorkerIndex)
+{
+        int Result = JobQueueTake(&Self->Queues[WorkerIndex], true);
+
+        for(unsigned int I = 1; Result < 0 && I < Self->WorkerCount; I++)
+        {
+                Result = JobQueueTake(&Self->Queues[(WorkerIndex + I) % Self->WorkerCount], false);
+        }
+
+        return(Result);
+}
+
+void *
+WorkerRun(void *Data)
+{
+        worker *Self = (worker *)Data;
+        job_pool *Pool = Self->Pool;
+
+        /* Size the arena for the largest job this worker owns; stolen jobs may grow it. */
+        job_queue *Queue = &Pool->Queues[Self->Index];
+        pthread_mutex_lock(&Queue->Lock);
+        unsigned int Head = Queue->Head, Tail = Queue->Tail;
+        pthread_mutex_unlock(&Queue->Lock);
+        size_t ArenaSize = 0;
+        for(unsigned int I = Head; I < Tail; I++)
+        {
+                ArenaSize = GSMax(ArenaSize, JobArenaSize(&Pool->Jobs[I], Pool->MemoryLimit));
+        }
 
-        if(!GSFileCopyToBuffer(StructDefineFilename, &OutputBuffer))
-                GSAbortWithMessage("Couldn't copy %s into memory\n", StructDefineFilename);
+        int JobIndex = JobPoolTake(Pool, Self->Index);
+        if(JobIndex < 0) return(NULL);
+        if(ArenaSize == 0) ArenaSize = JobArenaSize(&Pool->Jobs[JobIndex], Pool->MemoryLimit);
+
+        void *ArenaMemory = malloc(ArenaSize);
+        if(ArenaMemory == NULL) GSAbortWithMessage("Couldn't allocate %lu bytes\n", ArenaSize);
+        gs_arena Arena;
+        GSArenaInit(&Arena, ArenaMemory, ArenaSize);
+        GSArenaAllowGrowth(&Arena, malloc, free, Pool->MemoryLimit);
+
+        for(; JobIndex >= 0; JobIndex = JobPoolTake(Pool, Self->Index))
+        {
+                GSArenaReset(&Arena);
+                GenerateSourceFile(&Pool->Jobs[JobIndex], &Arena);
+        }
 
-        if(!GSFileCopyToBuffer(StructInitFilename, &OutputBuffer))
-                GSAbortWithMessage("Couldn't copy %s into memory\n", StructInitFilename);
+        GSArenaReset(&Arena);
+        free(ArenaMemory);
 
-        if(!GSFileCopyToBuffer(StructQueryFilename, &OutputBuffer))
-                GSAbortWithMessage("Couldn't copy %s into memory\n", StructQueryFilename);
+        return(NULL);
+}
 
-        if(!GSFileCopyToBuffer(StructGetFilename, &OutputBuffer))
-                GSAbortWithMessage("Couldn't copy %s into memory\n", StructGetFilename);
+void /* Returns once every job has been generated. */
+JobPoolRun(job_pool *Self, gs_arena *Arena)
+{
+        worker *Workers = (worker *)ArenaPush(Arena, sizeof(worker) * Self->WorkerCount);
+        for(unsigned int I = 0; I < Self->WorkerCount; I++)
+        {
+                Workers[I].Pool = Self;
+                Workers[I].Index = I;
+        }
 
-        memset(Temp, 0, MaxStringLength);
-        sprintf(Temp, "%s.c", ConfigFileBaseName);
-        FILE *Out = fopen(Temp, "w");
-        fwrite(OutputBuffer.Start, 1, OutputBuffer.Length, Out);
-        fclose(Out);
+        /* The calling thread is worker 0. */
+        for(unsigned int I = 1; I < Self->WorkerCount; I++)
+        {
+                if(pthread_create(&Workers[I].Thread, NULL, WorkerRun, &Workers[I]) != 0)
+                        GSAbortWithMessage("Couldn't start worker thread\n");
+        }
+        WorkerRun(&Workers[0]);
+        for(unsigned int I = 1; I < Self->WorkerCount; I++)
+        {
+                pthread_join(Workers[I].Thread, NULL);
+        }
 
-        remove(StructDefineFilename);
-        remove(StructInitFilename);
-        remove(StructQueryFilename);
-        remove(StructGetFilename);
-        ConfigStackDestroy(&ConfigStack);
+        for(unsigned int I = 0; I < Self->WorkerCount; I++)
+        {
+                pthread_mutex_destroy(&Self->Queues[I].Lock);
+        }
 }
 
 /******************************************************************************
  * Main
  ******************************************************************************/
 
+size_t /* Accepts an optional K, M or G suffix. Returns 0 if String is invalid. */
+ParseByteSize(char *String)
+{
+        char *End;
+        unsigned long long Result = strtoull(String, &End, 10);
+        switch(*End)
+        {
+                case('k'): case('K'): Result *= 1024ULL; break;
+                case('m'): case('M'): Result *= 1024ULL * 1024; break;
+                case('g'): case('G'): Result *= 1024ULL * 1024 * 1024; break;
+                case(NULL_CHAR): break;
+                default: return(0);
+        }
+        return((size_t)Result);
+}
+
+gs_bool /* Whether the option at Index consumes the argument after it. */
+OptionTakesValue(gs_args *Args, int Index)
+{
+        char *Option = GSArgsAtIndex(Args, Index);
+        if(GSStringIsEqual("--stats", Option, GSStringLength("--stats") + 1))
+        {
+                /* The format is optional; anything else after --stats is a config file. */
+                char *Format = GSArgsAtIndex(Args, Index + 1);
+                if(Format == NULL) return(false);
+                return(GSStringIsEqual("json", Format, GSStringLength("json") + 1) ||
+                       GSStringIsEqual("human", Format, GSStringLength("human") + 1));
+        }
+
+        static char *Options[] = { "--struct-name", "--style", "--lookup", "--layout", "--indent", "--memory-limit", "--jobs",
+                                   "--profile" };
+        for(size_t I = 0; I < sizeof(Options) / sizeof(Options[0]); I++)
+        {
+                if(GSStringIsEqual(Options[I], Option, GSStringLength(Options[I]) + 1)) return(true);
+        }
+        return(false);
+}
+
+void /* Fills in the options shared by every job. StructName is left NULL unless given. */
+ConfigFromArgs(config *Self, gs_args *Args)
+{
+        Self->StructName = NULL;
+        if(GSArgsIsPresent(Args, "--struct-name"))
+        {
+                Self->StructName = GSArgsAfter(Args, "--struct-name");
+        }
+
+        Self->SourceStyle = SOURCE_STYLE_C;
+        if(GSArgsIsPresent(Args, "--style"))
+        {
+                char *StyleString = GSArgsAfter(Args, "--style");
+                if(GSStringIsEqual("CamelCase", StyleString, GSStringLength("CamelCase")))
+                {
+                        Self->SourceStyle = SOURCE_STYLE_CAMELCASE;
+                }
+                else if(GSStringIsEqual("snake_case", StyleString, GSStringLength("snake_case")))
+                {
+                        Self->SourceStyle = SOURCE_STYLE_SNAKECASE;
+                }
+                else if(GSStringIsEqual("Casey", StyleString, GSStringLength("Casey")))
+                {
+                        Self->SourceStyle = SOURCE_STYLE_CASEY;
+                }
+        }
+
+        Self->IsStatic = GSArgsIsPresent(Args, "--static");
+        Self->IsTyped = GSArgsIsPresent(Args, "--typed");
+        Self->IsInstrumented = GSArgsIsPresent(Args, "--instrument");
+        Self->IsHeader = GSArgsIsPresent(Args, "--header");
+        Self->ProfileFile = GSArgsAfter(Args, "--profile");
+
+        Self->Layout = LAYOUT_POINTER;
+        if(GSArgsIsPresent(Args, "--layout"))
+        {
+                char *LayoutString = GSArgsAfter(Args, "--layout");
+                if(LayoutString != NULL && GSStringIsEqual("compact", LayoutString, GSStringLength("compact")))
+                {
+                        Self->Layout = LAYOUT_COMPACT;
+                }
+        }
+
+        Self->Lookup = LOOKUP_CHAIN;
+        if(GSArgsIsPresent(Args, "--lookup"))
+        {
+                char *LookupString = GSArgsAfter(Args, "--lookup");
+                if(LookupString != NULL && GSStringIsEqual("hash", LookupString, GSStringLength("hash")))
+                {
+                        Self->Lookup = LOOKUP_HASH;
+                }
+                else if(LookupString != NULL && GSStringIsEqual("sorted", LookupString, GSStringLength("sorted")))
+                {
+                        Self->Lookup = LOOKUP_SORTED;
+                }
+        }
+
+        if(GSArgsIsPresent(Args, "--indent"))
+        {
+                char *Indent = GSArgsAfter(Args, "--indent");
+                Self->Indent = strtol(Indent, NULL, 10);
+        }
+        else
+        {
+                Self->Indent = 8;
+        }
+}
+
+gs_bool
+IsIdentifier(char *String)
+{
+        if(!GSCharIsAlphabetical(String[0]) && String[0] != '_') return(false);
+        for(char *Cursor = String + 1; *Cursor != NULL_CHAR; Cursor++)
+        {
+                if(!GSCharIsAlphanumeric(*Cursor) && *Cursor != '_') return(false);
+        }
+        return(true);
+}
+
+void /* Names come from ConfigFile's basename, up to its last '.'. */
+JobInit(job *Self, char *ConfigFile, config *Options, gs_arena *Arena)
+{
+        char *BaseName = strrchr(ConfigFile, '/');
+        BaseName = (BaseName != NULL) ? BaseName + 1 : ConfigFile;
+        int DirectoryLength = BaseName - ConfigFile;
+        int NameLength = GSStringLength(BaseName);
+        char *ExtensionStart = strrchr(BaseName, '.');
+        if(ExtensionStart != NULL && ExtensionStart != BaseName)
+        {
+                NameLength = ExtensionStart - BaseName;
+        }
+        if(NameLength == 0) GSAbortWithMessage("Can't name the output of %s\n", ConfigFile);
+
+        Self->InputFileName = ConfigFile;
+        Self->IsWritten = false;
+        Self->OutputFileName = (char *)ArenaPush(Arena, DirectoryLength + NameLength + 3);
+        sprintf(Self->OutputFileName, "%.*s.%c", DirectoryLength + NameLength, ConfigFile, Options->IsHeader ? 'h' : 'c');
+        Self->OutputBaseName = Self->OutputFileName + DirectoryLength;
+        if(GSStringIsEqual(Self->OutputFileName, ConfigFile, GSStringLength(ConfigFile) + 1))
+                GSAbortWithMessage("%s would be overwritten by its own output\n", ConfigFile);
+
+        Self->Config = *Options;
+        if(Self->Config.StructName == NULL)
+        {
+                Self->Config.StructName = (char *)ArenaPush(Arena, NameLength + 1);
+                sprintf(Self->Config.StructName, "%.*s", NameLength, BaseName);
+        }
+        if(!IsIdentifier(Self->Config.StructName))
+                GSAbortWithMessage("%s isn't a valid C identifier; name the struct with --struct-name\n",
+                                   Self->Config.StructName);
+
+        Self->Config.FunctionPrefix = Self->Config.StructName;
+        if(Self->Config.SourceStyle == SOURCE_STYLE_CASEY)
+        {
+                int NameLength = GSStringLength(Self->Config.StructName);
+                Self->Config.FunctionPrefix = (char *)ArenaPush(Arena, NameLength + 1);
+                GSStringCopy(Self->Config.StructName, Self->Config.FunctionPrefix, NameLength);
+                GSStringSnakeCaseToCamelCase(Self->Config.FunctionPrefix, NameLength);
+        }
+}
+
+int
+JobOutputCompare(const void *Left, const void *Right)
+{
+        job_output *A = (job_output *)Left;
+        job_output *B = (job_output *)Right;
+        if(A->Device != B->Device) return((A->Device > B->Device) - (A->Device < B->Device));
+        if(A->Inode != B->Inode) return((A->Inode > B->Inode) - (A->Inode < B->Inode));
+        return(strcmp(A->Job->OutputBaseName, B->Job->OutputBaseName));
+}
+
+void /* Aborts if two jobs would write the same file, however their paths are spelled. */
+JobsCheckOutputs(job *Jobs, unsigned int JobCount, gs_arena *Arena)
+{
+        gs_arena_mark Mark = GSArenaMark(Arena);
+        job_output *Outputs = (job_output *)ArenaPush(Arena, sizeof(job_output) * JobCount);
+        for(unsigned int I = 0; I < JobCount; I++)
+        {
+                job *Job = &Jobs[I];
+                size_t DirectoryLength = Job->OutputBaseName - Job->OutputFileName;
+                char *Directory = (char *)ArenaPush(Arena, DirectoryLength + 2);
+                sprintf(Directory, "%.*s", (int)DirectoryLength, Job->OutputFileName);
+                if(DirectoryLength == 0) Directory = ".";
+
+                struct stat Info;
+                if(stat(Directory, &Info) != 0) GSAbortWithMessage("Couldn't read %s\n", Job->InputFileName);
+                Outputs[I].Device = Info.st_dev;
+                Outputs[I].Inode = Info.st_ino;
+                Outputs[I].Job = Job;
+        }
+        qsort(Outputs, JobCount, sizeof(job_output), JobOutputCompare);
+
+        for(unsigned int I = 1; I < JobCount; I++)
+        {
+                if(JobOutputCompare(&Outputs[I - 1], &Outputs[I]) == 0)
+                        GSAbortWithMessage("%s and %s would both be written to %s\n", Outputs[I - 1].Job->InputFileName,
+                                           Outputs[I].Job->InputFileName, Outputs[I].Job->OutputFileName);
+        }
+
+        GSArenaPop(Arena, Mark);
+}
+
 void
 Usage(char *ProgramName)
 {
-        printf("Usage: %s config-file [options]\n", basename(ProgramName));
+        printf("Usage: %s config-file... [options]\n", basename(ProgramName));
         puts("");
-        puts("Generates a c file with the same basename as config-file.");
+        puts("Generates a c file beside each config-file, named after its basename up to the last '.'.");
         puts("This file declares a C struct that matches the structures of the config file.");
         puts("");
-        puts("config-file: name of config file in current directory");
+        puts("config-file: path to a config file");
         puts("");
         puts("Options:");
-        puts("\t--struct-name: Name of generated C struct. Defaults to config-file basename.");
+        puts("\t--struct-name: Name of generated C struct. Defaults to config-file basename up to the");
+        puts("\t               last '.', which must then be a valid C identifier.");
         puts("\t--style: One of: CamelCase, snake_case, c");
         puts("\t         This affects the initialization function generated for the config struct.");
         puts("\t         eg.: With `--struct-name config'");
@@ -530,8 +3963,37 @@ Usage(char *ProgramName)
         puts("\t         [c]          void configinit(config *self);");
         puts("\t         [Casey]      void ConfigInit(config *Self);");
         puts("\t         If nothing is specified, defaults to `c' style.");
+        puts("\t--lookup: How the generated has-key and get functions find a key. One of:");
+        puts("\t          chain: Compare against every key in turn. This is the default.");
+        puts("\t          hash:  Probe a perfect hash table built at generation time.");
+        puts("\t          sorted: Binary search the name-sorted key descriptors.");
+        puts("\t--layout: How the generated struct holds each value. One of:");
+        puts("\t          pointer: A char * per key. This is the default.");
+        puts("\t          compact: A uint32_t offset per key into one string blob, read through");
+        puts("\t                   the generated value and length macros.");
+        puts("\t--typed: Emit integer, decimal and true/false values as int64_t, double and bool");
+        puts("\t         fields, with typed getters. Tag a value to override, eg.: !!string 5.");
+        puts("\t--static: Emit a const instance of the struct, eg.: config_instance,");
+        puts("\t          in place of the initialization function.");
+        puts("\t--instrument: Count hits per key and misses in the generated lookups, and emit");
+        puts("\t              a dump_stats function that writes the counts to a profile file.");
+        puts("\t--profile: A profile file from an --instrument build. The chain lookup checks keys");
+        puts("\t           from most hits to fewest, and keys with none in a separate cold function.");
+        puts("\t--header: Emit a header, with a .h extension, whose lookup functions are static");
+        puts("\t          inline. The init, visit, get_many and dump_stats functions and the --static");
+        puts("\t          instance are only defined where GSCFG_IMPLEMENTATION is defined before");
+        puts("\t          including it.");
         puts("\t--indent: Number of spaces to indent generated source code per indentation level.");
         puts("\t          Defaults to 8.");
+        puts("\t--jobs: Number of config files to generate concurrently.");
+        puts("\t        Defaults to the number of online processors.");
+        puts("\t--split: Generate each config file across all --jobs threads instead,");
+        puts("\t         splitting it between top-level keys. Output is unchanged.");
+        puts("\t--memory-limit: Maximum bytes of memory used per job while generating, eg.: 512M.");
+        puts("\t                With --split, it's shared by all of a job's threads.");
+        puts("\t                Defaults to unlimited.");
+        puts("\t--stats: Print sizes and per-phase timings for each config file to stdout.");
+        puts("\t         Optionally followed by a format: human (default) or json.");
         exit(EXIT_SUCCESS);
 }
 
@@ -542,66 +4004,93 @@ main(int ArgCount, char **Arguments)
         Args = GSArgsInit(alloca(GSArgsAllocSize()), ArgCount, Arguments);
         if(GSArgsHelpWanted(Args) || ArgCount == 1) Usage(GSArgsProgramName(Args));
 
-        char ConfigCFile[MaxStringLength];
-        char *ConfigFile = GSArgsAtIndex(Args, 1);
-        int StringLength = GSStringLength(ConfigFile);
-        char *ExtensionStart = strchr(ConfigFile, '.');
-        if(ExtensionStart != NULL)
+        size_t MemoryLimit = 0;
+        if(GSArgsIsPresent(Args, "--memory-limit"))
         {
-                StringLength = ExtensionStart - ConfigFile;
+                char *Limit = GSArgsAfter(Args, "--memory-limit");
+                if(Limit == NULL || (MemoryLimit = ParseByteSize(Limit)) == 0)
+                        GSAbortWithMessage("Invalid --memory-limit\n");
         }
-        sprintf(ConfigCFile, "%.*s", StringLength, ConfigFile);
 
-        char *StructName;
-        if(GSArgsIsPresent(Args, "--struct-name"))
-        {
-                GConfig.StructName = GSArgsAfter(Args, "--struct-name");
-        }
-        else
+        long Processors = sysconf(_SC_NPROCESSORS_ONLN);
+        unsigned int WorkerCount = (Processors > 0) ? (unsigned int)Processors : 1;
+        if(GSArgsIsPresent(Args, "--jobs"))
         {
-                GConfig.StructName = (char *)alloca(MaxStringLength);
-                sprintf(GConfig.StructName, "%.*s", StringLength, ConfigFile);
+                char *Jobs = GSArgsAfter(Args, "--jobs");
+                if(Jobs == NULL || (WorkerCount = strtoul(Jobs, NULL, 10)) == 0)
+                        GSAbortWithMessage("Invalid --jobs\n");
         }
 
-        GConfig.SourceStyle = SOURCE_STYLE_C;
-        if(GSArgsIsPresent(Args, "--style"))
+        stats_format_e StatsFormat = STATS_FORMAT_NONE;
+        if(GSArgsIsPresent(Args, "--stats"))
         {
-                char *StyleString = GSArgsAfter(Args, "--style");
-                if(GSStringIsEqual("CamelCase", StyleString, GSStringLength("CamelCase")))
-                {
-                        GConfig.SourceStyle = SOURCE_STYLE_CAMELCASE;
-                }
-                else if(GSStringIsEqual("snake_case", StyleString, GSStringLength("snake_case")))
+                char *Format = GSArgsAfter(Args, "--stats");
+                StatsFormat = STATS_FORMAT_HUMAN;
+                if(Format != NULL && GSStringIsEqual("json", Format, GSStringLength("json") + 1))
                 {
-                        GConfig.SourceStyle = SOURCE_STYLE_SNAKECASE;
-                }
-                else if(GSStringIsEqual("Casey", StyleString, GSStringLength("Casey")))
-                {
-                        GConfig.SourceStyle = SOURCE_STYLE_CASEY;
+                        StatsFormat = STATS_FORMAT_JSON;
                 }
         }
 
-        if(GSArgsIsPresent(Args, "--indent"))
+        /* With --split, files are generated one at a time, each across every worker. */
+        gs_bool IsSplit = GSArgsIsPresent(Args, "--split");
+        unsigned int SplitCount = 1;
+        if(IsSplit)
         {
-                char *Indent = GSArgsAfter(Args, "--indent");
-                GConfig.Indent = strtol(Indent, NULL, 10);
+                SplitCount = WorkerCount;
+                WorkerCount = 1;
         }
-        else
+
+        /* Job descriptions are small; the generator's working memory lives in each worker's arena. */
+        gs_arena Arena;
+        size_t ArenaSize = 64 * 1024;
+        void *ArenaMemory = malloc(ArenaSize);
+        if(ArenaMemory == NULL) GSAbortWithMessage("Couldn't allocate %lu bytes\n", ArenaSize);
+        GSArenaInit(&Arena, ArenaMemory, ArenaSize);
+        GSArenaAllowGrowth(&Arena, malloc, free, 0);
+
+        config Options;
+        ConfigFromArgs(&Options, Args);
+
+        job *Jobs = (job *)ArenaPush(&Arena, sizeof(job) * ArgCount);
+        unsigned int JobCount = 0;
+        for(int I = 1; I < ArgCount; I++)
         {
-                GConfig.Indent = 8;
+                char *Arg = GSArgsAtIndex(Args, I);
+                if(Arg[0] == '-' && Arg[1] == '-')
+                {
+                        if(OptionTakesValue(Args, I)) I++;
+                        continue;
+                }
+                JobInit(&Jobs[JobCount], Arg, &Options, &Arena);
+                Jobs[JobCount++].SplitCount = SplitCount;
         }
+        if(JobCount == 0) Usage(GSArgsProgramName(Args));
+        JobsCheckOutputs(Jobs, JobCount, &Arena);
 
-        size_t AllocSize = GSFileSize(ConfigFile);
-        gs_buffer Buffer;
-        GSBufferInit(&Buffer, (char *)alloca(AllocSize), AllocSize);
+        job_pool Pool;
+        JobPoolInit(&Pool, Jobs, JobCount, WorkerCount, MemoryLimit, &Arena);
+        JobPoolRun(&Pool, &Arena);
+
+        if(StatsFormat != STATS_FORMAT_NONE)
+        {
+                for(unsigned int I = 0; I < JobCount; I++)
+                {
+                        StatsPrint(&Jobs[I].Stats, Jobs[I].InputFileName, StatsFormat, stdout);
+                }
+        }
 
-        if(!GSFileCopyToBuffer(ConfigFile, &Buffer))
-                GSAbortWithMessage("Couldn't copy %s into memory\n", ConfigFile);
-        Buffer.Cursor = Buffer.Start;
+        /* Every job is still attempted; any that failed have already said why. */
+        int ExitStatus = EXIT_SUCCESS;
+        for(unsigned int I = 0; I < JobCount; I++)
+        {
+                if(!Jobs[I].IsWritten) ExitStatus = EXIT_FAILURE;
+        }
 
-        GenerateSourceFile(&Buffer, ConfigCFile);
+        GSArenaReset(&Arena);
+        free(ArenaMemory);
 
-        return(EXIT_SUCCESS);
+        return(ExitStatus);
 }
 
 #endif /* GS_CFG_VERSION */